@@ -22,6 +22,9 @@ namespace iroha {
       using BlockResult =
           expected::Result<std::unique_ptr<shared_model::interface::Block>,
                            std::string>;
+      using SerializedBlockResult =
+          expected::Result<shared_model::interface::types::JsonType,
+                           std::string>;
 
       virtual ~BlockQuery() = default;
 
@@ -33,6 +36,15 @@ namespace iroha {
       virtual BlockResult getBlock(
           shared_model::interface::types::HeightType height) = 0;
 
+      /**
+       * Retrieve block with given height in the format it is kept in block
+       * storage, without building a model object from it
+       * @param height - height of a block to retrieve
+       * @return JSON representation of iroha::protocol::Block
+       */
+      virtual SerializedBlockResult getSerializedBlock(
+          shared_model::interface::types::HeightType height) = 0;
+
       /**
        * Get height of the top block.
        * @return height
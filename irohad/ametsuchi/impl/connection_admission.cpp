@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/connection_admission.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    using namespace std::chrono_literals;
+
+    ConnectionAdmission::Permit::Permit(
+        std::shared_ptr<ConnectionAdmission> admission)
+        : admission_(std::move(admission)) {}
+
+    ConnectionAdmission::Permit::~Permit() {
+      admission_->release();
+    }
+
+    ConnectionAdmission::ConnectionAdmission(size_t capacity,
+                                             std::chrono::milliseconds max_wait)
+        : max_wait_(max_wait),
+          available_(capacity),
+          histogram_{{1ms, 2ms, 5ms, 10ms, 20ms, 50ms, 100ms, 200ms, 500ms, 1s},
+                     std::vector<uint64_t>(11, 0),
+                     0} {}
+
+    std::unique_ptr<ConnectionAdmission::Permit> ConnectionAdmission::admit() {
+      auto start = std::chrono::steady_clock::now();
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (not released_.wait_for(
+              lock, max_wait_, [this] { return available_ > 0; })) {
+        ++histogram_.rejected;
+        return nullptr;
+      }
+      --available_;
+
+      auto wait_time = std::chrono::steady_clock::now() - start;
+      auto bucket = std::lower_bound(
+          histogram_.bounds.begin(), histogram_.bounds.end(), wait_time);
+      ++histogram_.counts[bucket - histogram_.bounds.begin()];
+      return std::make_unique<Permit>(shared_from_this());
+    }
+
+    ConnectionAdmission::WaitTimeHistogram ConnectionAdmission::histogram()
+        const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return histogram_;
+    }
+
+    void ConnectionAdmission::release() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++available_;
+      }
+      released_.notify_one();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
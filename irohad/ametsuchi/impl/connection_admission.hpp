@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CONNECTION_ADMISSION_HPP
+#define IROHA_CONNECTION_ADMISSION_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Admission control in front of a connection pool. A session is only
+     * leased from the pool with a permit, so leasing never blocks, and
+     * requests, which can not get a permit in time, are rejected instead of
+     * queueing up behind each other. Time spent waiting for the permits is
+     * collected in a histogram.
+     *
+     * Must be created by std::make_shared, because the permits keep it alive.
+     */
+    class ConnectionAdmission
+        : public std::enable_shared_from_this<ConnectionAdmission> {
+     public:
+      /// Right to use one session of the pool, returned on destruction
+      class Permit {
+       public:
+        explicit Permit(std::shared_ptr<ConnectionAdmission> admission);
+
+        Permit(const Permit &) = delete;
+        Permit &operator=(const Permit &) = delete;
+
+        ~Permit();
+
+       private:
+        std::shared_ptr<ConnectionAdmission> admission_;
+      };
+
+      /// Distribution of time spent waiting for a permit
+      struct WaitTimeHistogram {
+        /// upper bounds of the buckets, the last bucket is unbounded
+        std::vector<std::chrono::milliseconds> bounds;
+        /// number of admitted requests in each bucket
+        std::vector<uint64_t> counts;
+        /// number of rejected requests
+        uint64_t rejected;
+      };
+
+      /**
+       * @param capacity - number of sessions in the pool
+       * @param max_wait - maximum time to wait for a permit
+       */
+      ConnectionAdmission(size_t capacity, std::chrono::milliseconds max_wait);
+
+      /**
+       * Wait for a free session
+       * @return permit, which must be kept while the session is used, nullptr
+       * if no session got free in time
+       */
+      std::unique_ptr<Permit> admit();
+
+      /// @return wait times of all requests since the creation
+      WaitTimeHistogram histogram() const;
+
+     private:
+      void release();
+
+      const std::chrono::milliseconds max_wait_;
+
+      mutable std::mutex mutex_;
+      std::condition_variable released_;
+      size_t available_;
+      WaitTimeHistogram histogram_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_CONNECTION_ADMISSION_HPP
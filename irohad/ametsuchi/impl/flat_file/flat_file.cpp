@@ -124,6 +124,17 @@ void FlatFile::dropAll() {
   available_blocks_.clear();
 }
 
+bool FlatFile::remove(Identifier id) {
+  const auto file_name = boost::filesystem::path{dump_dir_} / id_to_name(id);
+  boost::system::error_code error_code;
+  if (not boost::filesystem::remove(file_name, error_code)) {
+    log_->warn("Cannot remove file by index {}: {}", id, error_code.message());
+    return false;
+  }
+  available_blocks_.erase(id);
+  return true;
+}
+
 const BlockIdCollectionType &FlatFile::blockIdentifiers() const {
   return available_blocks_;
 }
@@ -73,6 +73,13 @@ namespace iroha {
 
       void dropAll() override;
 
+      /**
+       * Remove the file with the given id
+       * @param id - identifier of the file
+       * @return true if the file has been removed
+       */
+      bool remove(Identifier id);
+
       /**
        * @return collection of available block ids
        */
@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/flat_file_wsv_snapshot_storage.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <boost/algorithm/string/trim.hpp>
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::HashType;
+using shared_model::interface::types::HeightType;
+
+FlatFileWsvSnapshotStorage::FlatFileWsvSnapshotStorage(
+    std::unique_ptr<FlatFile> flat_file, logger::LoggerPtr log)
+    : flat_file_(std::move(flat_file)), log_(std::move(log)) {}
+
+std::string FlatFileWsvSnapshotStorage::directoryFor(
+    const std::string &block_store_dir) {
+  return boost::algorithm::trim_right_copy_if(block_store_dir,
+                                              [](char c) { return c == '/'; })
+      + "_wsv_snapshots";
+}
+
+bool FlatFileWsvSnapshotStorage::insert(const WsvSnapshot &snapshot) {
+  std::string header = snapshot.block_hash.hex() + '\n'
+      + snapshot.data_hash.hex() + '\n';
+
+  FlatFile::Bytes file;
+  file.reserve(header.size() + snapshot.data.size());
+  file.insert(file.end(), header.begin(), header.end());
+  file.insert(file.end(), snapshot.data.begin(), snapshot.data.end());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return flat_file_->add(snapshot.height, file);
+}
+
+boost::optional<WsvSnapshot> FlatFileWsvSnapshotStorage::get(
+    HeightType height) const {
+  boost::optional<FlatFile::Bytes> file;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    file = flat_file_->get(height);
+  }
+  if (not file) {
+    return boost::none;
+  }
+
+  auto block_hash_end = std::find(file->begin(), file->end(), '\n');
+  auto data_hash_end = std::find(
+      block_hash_end == file->end() ? file->end() : block_hash_end + 1,
+      file->end(),
+      '\n');
+  if (data_hash_end == file->end()) {
+    log_->error("Snapshot at height {} is damaged", height);
+    return boost::none;
+  }
+
+  return WsvSnapshot{
+      height,
+      HashType::fromHexString(std::string(file->begin(), block_hash_end)),
+      HashType::fromHexString(std::string(block_hash_end + 1, data_hash_end)),
+      std::string(data_hash_end + 1, file->end())};
+}
+
+boost::optional<HeightType> FlatFileWsvSnapshotStorage::lastHeight(
+    HeightType max_height) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto &heights = flat_file_->blockIdentifiers();
+  const auto bound = std::min<HeightType>(
+      max_height, std::numeric_limits<FlatFile::Identifier>::max());
+  auto it = heights.upper_bound(static_cast<FlatFile::Identifier>(bound));
+  if (it == heights.begin()) {
+    return boost::none;
+  }
+  return *std::prev(it);
+}
+
+void FlatFileWsvSnapshotStorage::keepLatest(size_t count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto &heights = flat_file_->blockIdentifiers();
+  while (heights.size() > count) {
+    auto height = *heights.begin();
+    if (not flat_file_->remove(height)) {
+      log_->warn("Failed to remove snapshot at height {}", height);
+      return;
+    }
+  }
+}
+
+void FlatFileWsvSnapshotStorage::dropAll() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  flat_file_->dropAll();
+}
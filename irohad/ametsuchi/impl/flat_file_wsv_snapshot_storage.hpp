@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FLAT_FILE_WSV_SNAPSHOT_STORAGE_HPP
+#define IROHA_FLAT_FILE_WSV_SNAPSHOT_STORAGE_HPP
+
+#include "ametsuchi/wsv_snapshot_storage.hpp"
+
+#include <mutex>
+
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Snapshot storage keeping one file per snapshot. The file starts with
+     * the hex encoded block and data hashes, one per line, followed by the
+     * serialized state
+     */
+    class FlatFileWsvSnapshotStorage : public WsvSnapshotStorage {
+     public:
+      FlatFileWsvSnapshotStorage(std::unique_ptr<FlatFile> flat_file,
+                                 logger::LoggerPtr log);
+
+      /**
+       * Directory for snapshots of the given block store. It is a sibling of
+       * the block store directory, since FlatFile removes foreign entries
+       * from its directory
+       * @param block_store_dir - directory of the block store
+       * @return snapshots directory
+       */
+      static std::string directoryFor(const std::string &block_store_dir);
+
+      bool insert(const WsvSnapshot &snapshot) override;
+
+      boost::optional<WsvSnapshot> get(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<shared_model::interface::types::HeightType> lastHeight(
+          shared_model::interface::types::HeightType max_height)
+          const override;
+
+      void keepLatest(size_t count) override;
+
+      void dropAll() override;
+
+     private:
+      /// guards the file list of flat_file_, which is used by several threads
+      mutable std::mutex mutex_;
+      std::unique_ptr<FlatFile> flat_file_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_FLAT_FILE_WSV_SNAPSHOT_STORAGE_HPP
@@ -0,0 +1,39 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POOL_OPTIONS_HPP
+#define IROHA_POOL_OPTIONS_HPP
+
+#include <chrono>
+#include <string>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Database connection pools of the storage. Client queries use a pool of
+     * their own, so that a burst of heavy queries can not take the sessions
+     * needed to validate and commit blocks.
+     */
+    struct PoolOptions {
+      /// number of sessions for validation, commit and the other ledger work
+      size_t pool_size = 10;
+      /// number of sessions for client queries
+      size_t query_pool_size = 4;
+      /**
+       * connection string of the client query sessions, e.g. of a local
+       * streaming replica; the ledger database is used if it is not set
+       */
+      boost::optional<std::string> query_connection;
+      /// maximum time a client query waits for a free session
+      std::chrono::milliseconds query_max_wait{1000};
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POOL_OPTIONS_HPP
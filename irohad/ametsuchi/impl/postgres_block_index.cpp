@@ -5,6 +5,9 @@
 
 #include "ametsuchi/impl/postgres_block_index.hpp"
 
+#include <map>
+#include <set>
+
 #include <boost/range/adaptor/indexed.hpp>
 
 #include "ametsuchi/tx_cache_response.hpp"
@@ -115,6 +118,65 @@ namespace {
           return query;
         });
   }
+
+  // Collect (account, asset) pairs the transaction is indexed under in
+  // position_by_account_asset
+  std::set<std::pair<shared_model::interface::types::AccountIdType,
+                     shared_model::interface::types::AssetIdType>>
+  getAccountAssets(
+      const shared_model::interface::types::AccountIdType &account_id,
+      const shared_model::interface::Transaction::CommandsType &commands) {
+    std::set<std::pair<shared_model::interface::types::AccountIdType,
+                       shared_model::interface::types::AssetIdType>>
+        account_assets;
+    for (const auto &cmd : commands) {
+      if (auto transfer = getTransferAsset(cmd)) {
+        const auto &asset_id = transfer.value().assetId();
+        account_assets.emplace(account_id, asset_id);
+        account_assets.emplace(transfer.value().srcAccountId(), asset_id);
+        account_assets.emplace(transfer.value().destAccountId(), asset_id);
+      }
+    }
+    return account_assets;
+  }
+
+  // Add number of block transactions to the counter of each creator
+  std::string makeCreatorTxCount(
+      const std::map<shared_model::interface::types::AccountIdType, size_t>
+          &counts) {
+    return std::accumulate(
+        counts.begin(),
+        counts.end(),
+        std::string{},
+        [](auto query, const auto &count) {
+          boost::format base(
+              "INSERT INTO tx_count_by_creator AS t(creator_id, count) "
+              "VALUES ('%s', %d) ON CONFLICT (creator_id) DO UPDATE "
+              "SET count = t.count + EXCLUDED.count;");
+          return query + (base % count.first % count.second).str();
+        });
+  }
+
+  // Add number of block transactions to the counter of each account asset
+  std::string makeAccountAssetTxCount(
+      const std::map<std::pair<shared_model::interface::types::AccountIdType,
+                               shared_model::interface::types::AssetIdType>,
+                     size_t> &counts) {
+    return std::accumulate(
+        counts.begin(),
+        counts.end(),
+        std::string{},
+        [](auto query, const auto &count) {
+          boost::format base(
+              "INSERT INTO tx_count_by_account_asset AS t(account_id, "
+              "asset_id, count) VALUES ('%s', '%s', %d) "
+              "ON CONFLICT (account_id, asset_id) DO UPDATE "
+              "SET count = t.count + EXCLUDED.count;");
+          return query
+              + (base % count.first.first % count.first.second % count.second)
+                    .str();
+        });
+  }
 }  // namespace
 
 namespace iroha {
@@ -128,14 +190,26 @@ namespace iroha {
       auto height = block.height();
       auto indexed_txs = block.transactions() | boost::adaptors::indexed(0);
       auto rejected_txs_hashes = block.rejected_transactions_hashes();
+      std::map<shared_model::interface::types::AccountIdType, size_t>
+          creator_counts;
+      std::map<std::pair<shared_model::interface::types::AccountIdType,
+                         shared_model::interface::types::AssetIdType>,
+               size_t>
+          account_asset_counts;
       std::string tx_index_query = std::accumulate(
           indexed_txs.begin(),
           indexed_txs.end(),
           std::string{},
-          [height](auto query, const auto &tx) {
+          [&](auto query, const auto &tx) {
             const auto &creator_id = tx.value().creatorAccountId();
             const auto index = tx.index();
 
+            ++creator_counts[creator_id];
+            for (const auto &account_asset :
+                 getAccountAssets(creator_id, tx.value().commands())) {
+              ++account_asset_counts[account_asset];
+            }
+
             query += makeAccountHeightIndex(creator_id, height);
             query += makeAccountAssetIndex(
                 creator_id, height, index, tx.value().commands());
@@ -154,7 +228,9 @@ namespace iroha {
                             return query;
                           });
 
-      auto index_query = tx_index_query + rejected_tx_index_query;
+      auto index_query = tx_index_query + rejected_tx_index_query
+          + makeCreatorTxCount(creator_counts)
+          + makeAccountAssetTxCount(account_asset_counts);
       try {
         sql_ << index_query;
       } catch (const std::exception &e) {
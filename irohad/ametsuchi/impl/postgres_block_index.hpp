@@ -31,6 +31,10 @@ namespace iroha {
        *     c. destination account
        *   2. account -> block for source and destination accounts
        *   3. (account, height) -> list of txes
+       *
+       * Numbers of transactions of each creator and of each (account, asset)
+       * are maintained as well, so that paginated transaction queries do not
+       * need to count the index rows.
        */
       void index(const shared_model::interface::Block &block) override;
 
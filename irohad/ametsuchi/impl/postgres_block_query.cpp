@@ -37,13 +37,22 @@ namespace iroha {
 
     BlockQuery::BlockResult PostgresBlockQuery::getBlock(
         shared_model::interface::types::HeightType height) {
+      return getSerializedBlock(height).match(
+          [this](const auto &serialized_block) {
+            return converter_->deserialize(serialized_block.value);
+          },
+          [](auto &&error) -> BlockResult { return std::move(error); });
+    }
+
+    BlockQuery::SerializedBlockResult PostgresBlockQuery::getSerializedBlock(
+        shared_model::interface::types::HeightType height) {
       auto serialized_block = block_store_.get(height);
       if (not serialized_block) {
         auto error =
             boost::format("Failed to retrieve block with height %d") % height;
         return expected::makeError(error.str());
       }
-      return converter_->deserialize(bytesToString(*serialized_block));
+      return expected::makeValue(bytesToString(*serialized_block));
     }
 
     shared_model::interface::types::HeightType
@@ -5,10 +5,15 @@
 
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 
+#include <cstring>
+#include <deque>
+
 #include <soci/postgresql/soci-postgresql.h>
 #include <boost/algorithm/string.hpp>
+#include <boost/endian/conversion.hpp>
 #include <boost/format.hpp>
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/wsv_cache_view.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/commands/add_asset_quantity.hpp"
 #include "interfaces/commands/add_peer.hpp"
@@ -31,50 +36,74 @@
 #include "utils/string_builder.hpp"
 
 namespace {
+  using Validation = iroha::ametsuchi::PostgresCommandExecutor::Validation;
+
+  /// fragment of a statement, which is substituted into its placeholder
+  struct Check {
+    Check(std::string sql) : sql(std::move(sql)) {}
+    Check(const char *sql) : sql(sql) {}
+
+    std::string sql;
+    /// permission checks are skipped when the cache knows the permissions,
+    /// the other rules of the command are checked anyway
+    bool is_permission_check = true;
+  };
+
+  /// @return fragment checking a rule of the command other than permissions
+  Check ruleCheck(std::string sql) {
+    Check check(std::move(sql));
+    check.is_permission_check = false;
+    return check;
+  }
+
   struct PreparedStatement {
     std::string command_name;
     std::string command_base;
-    std::vector<std::string> permission_checks;
+    std::vector<Check> permission_checks;
 
     static const std::string validationPrefix;
+    static const std::string noPermissionsPrefix;
     static const std::string noValidationPrefix;
   };
 
   const std::string PreparedStatement::validationPrefix = "WithValidation";
+  const std::string PreparedStatement::noPermissionsPrefix =
+      "WithOutPermissions";
   const std::string PreparedStatement::noValidationPrefix = "WithOutValidation";
 
-  // Transforms prepared statement into two strings:
-  //    1. SQL query with validation
-  //    2. SQL query without validation
-  std::pair<std::string, std::string> compileStatement(
-      const PreparedStatement &statement) {
-    // Create query with validation
-    auto with_validation = boost::format(statement.command_base)
-        % (statement.command_name + PreparedStatement::validationPrefix);
-
-    // append all necessary checks to the query
+  // Transforms prepared statement into SQL query with the checks, which are
+  // selected by the predicate, and the other ones left out
+  template <typename IsChecked>
+  std::string compileStatement(const PreparedStatement &statement,
+                               const std::string &prefix,
+                               IsChecked &&is_checked) {
+    auto query = boost::format(statement.command_base)
+        % (statement.command_name + prefix);
+
+    // append the necessary checks to the query, and empty strings to the
+    // places of the others
     for (const auto &check : statement.permission_checks) {
-      with_validation = with_validation % check;
+      query = query % (is_checked(check) ? check.sql : "");
     }
-
-    // Create query without validation
-    auto without_validation = boost::format(statement.command_base)
-        % (statement.command_name + PreparedStatement::noValidationPrefix);
-
-    // since checks are not needed, append empty strings to their place
-    for (size_t i = 0; i < statement.permission_checks.size(); i++) {
-      without_validation = without_validation % "";
-    }
-
-    return {with_validation.str(), without_validation.str()};
+    return query.str();
   }
 
+  // Prepares three variants of the statement:
+  //    1. SQL query with validation
+  //    2. SQL query without permission checks, but with the other rules
+  //    3. SQL query without validation
   void prepareStatement(soci::session &sql,
                         const PreparedStatement &statement) {
-    auto queries = compileStatement(statement);
-
-    sql << queries.first;
-    sql << queries.second;
+    sql << compileStatement(statement,
+                            PreparedStatement::validationPrefix,
+                            [](const auto &) { return true; });
+    sql << compileStatement(
+        statement,
+        PreparedStatement::noPermissionsPrefix,
+        [](const auto &check) { return not check.is_permission_check; });
+    sql << compileStatement(statement,
+                            PreparedStatement::noValidationPrefix,
+                            [](const auto &) { return false; });
   }
 
   template <typename QueryArgsCallable>
@@ -197,37 +226,187 @@ namespace {
   }
 
   /**
-   * Executes sql query
-   * Assumes that statement query returns 0 in case of success
-   * or error code in case of failure
+   * Parameters of a prepared statement execution in the libpq format. Text
+   * and integer values are sent in the binary format, so they are neither
+   * quoted by the client nor parsed by the server. Referenced strings must
+   * outlive the execution
+   */
+  class QueryParameters {
+   public:
+    /// Add a text parameter, which is passed as is
+    QueryParameters &text(const std::string &value) {
+      return add(value.data(), value.size(), kBinaryFormat);
+    }
+
+    /// Add an int parameter
+    QueryParameters &integer(int32_t value) {
+      integers_.push_back(boost::endian::native_to_big(value));
+      return add(reinterpret_cast<const char *>(&integers_.back()),
+                 sizeof(int32_t),
+                 kBinaryFormat);
+    }
+
+    /// Add a parameter in the text form, for the types with non-trivial
+    /// binary representation, e.g. bit or text[]
+    QueryParameters &literal(const std::string &value) {
+      return add(value.c_str(), value.size(), kTextFormat);
+    }
+
+    int size() const {
+      return values_.size();
+    }
+
+    const char *const *values() const {
+      return values_.data();
+    }
+
+    const int *lengths() const {
+      return lengths_.data();
+    }
+
+    const int *formats() const {
+      return formats_.data();
+    }
+
+    /// @return copies of the parameter values, which outlive the referenced
+    /// strings
+    std::vector<std::string> copyValues() const {
+      std::vector<std::string> values;
+      values.reserve(values_.size());
+      for (size_t i = 0; i < values_.size(); ++i) {
+        values.emplace_back(values_[i], lengths_[i]);
+      }
+      return values;
+    }
+
+    static constexpr int kTextFormat = 0;
+    static constexpr int kBinaryFormat = 1;
+
+   private:
+    QueryParameters &add(const char *value, size_t length, int format) {
+      values_.push_back(value);
+      lengths_.push_back(length);
+      formats_.push_back(format);
+      return *this;
+    }
+
+    std::vector<const char *> values_;
+    std::vector<int> lengths_;
+    std::vector<int> formats_;
+    // deque does not move the stored values on push_back
+    std::deque<int32_t> integers_;
+  };
+
+  constexpr int QueryParameters::kTextFormat;
+  constexpr int QueryParameters::kBinaryFormat;
+
+  /**
+   * Get the command result from the result of its statement
+   * Assumes that statement returns 0 in case of success
+   * or error code in case of failure, either in text or in binary format
+   * @tparam QueryArgsCallable - type of callable to get query arguments
+   * @param result - statement result
+   * @param command_name - which command executed the statement
+   * @param query_args - callable to get a string representation of query
+   * arguments
+   * @return CommandResult with command name and error message
+   */
+  template <typename QueryArgsCallable>
+  iroha::ametsuchi::CommandResult getCommandResult(
+      const PGresult &result,
+      std::string command_name,
+      QueryArgsCallable &&query_args) noexcept {
+    if (PQresultStatus(&result) != PGRES_TUPLES_OK) {
+      return getCommandError(std::move(command_name),
+                             PQresultErrorMessage(&result),
+                             std::forward<QueryArgsCallable>(query_args));
+    }
+
+    if (PQntuples(&result) != 1 or PQnfields(&result) != 1
+        or PQgetisnull(&result, 0, 0)) {
+      return makeCommandError(std::move(command_name),
+                              1,
+                              std::forward<QueryArgsCallable>(query_args));
+    }
+
+    const char *value = PQgetvalue(&result, 0, 0);
+    int32_t code;
+    if (PQfformat(&result, 0) == QueryParameters::kBinaryFormat) {
+      if (PQgetlength(&result, 0, 0) != sizeof(code)) {
+        return makeCommandError(std::move(command_name),
+                                1,
+                                std::forward<QueryArgsCallable>(query_args));
+      }
+      std::memcpy(&code, value, sizeof(code));
+      code = boost::endian::big_to_native(code);
+    } else {
+      code = std::strtol(value, nullptr, 10);
+    }
+
+    if (code != 0) {
+      return makeCommandError(std::move(command_name),
+                              code,
+                              std::forward<QueryArgsCallable>(query_args));
+    }
+    return {};
+  }
+
+  /**
+   * Executes prepared statement with the libpq extended query protocol, or
+   * stores the statement name and parameters if the execution is deferred
    * @tparam QueryArgsCallable - type of callable to get query arguments
    * @param sql - connection on which to execute statement
-   * @param cmd - sql query to be executed
+   * @param deferred_commands - collection for the deferred statements, none
+   * if the statement should be executed immediately
+   * @param statement_name - name of the statement prepared in the session
+   * @param parameters - statement parameters
    * @param command_name - which command executes a query
    * @param query_args - callable to get a string representation of query
    * arguments
-   * @return CommandResult with command name and error message
+   * @return CommandResult with command name and error message, always
+   * successful for the deferred execution
    */
   template <typename QueryArgsCallable>
   iroha::ametsuchi::CommandResult executeQuery(
       soci::session &sql,
-      const std::string &cmd,
+      boost::optional<std::vector<
+          iroha::ametsuchi::PostgresCommandExecutor::DeferredCommand>>
+          &deferred_commands,
+      const std::string &statement_name,
+      const QueryParameters &parameters,
       std::string command_name,
       QueryArgsCallable &&query_args) noexcept {
-    uint32_t result;
-    try {
-      sql << cmd, soci::into(result);
-      if (result != 0) {
-        return makeCommandError(std::move(command_name),
-                                result,
-                                std::forward<QueryArgsCallable>(query_args));
-      }
+    if (deferred_commands) {
+      deferred_commands->push_back(
+          {statement_name,
+           parameters.copyValues(),
+           std::vector<int>(parameters.formats(),
+                            parameters.formats() + parameters.size()),
+           std::move(command_name),
+           query_args()});
       return {};
-    } catch (const std::exception &e) {
+    }
+
+    auto *backend =
+        static_cast<soci::postgresql_session_backend *>(sql.get_backend());
+    std::unique_ptr<PGresult, decltype(&PQclear)> result(
+        PQexecPrepared(backend->conn_,
+                       statement_name.c_str(),
+                       parameters.size(),
+                       parameters.values(),
+                       parameters.lengths(),
+                       parameters.formats(),
+                       QueryParameters::kBinaryFormat),
+        &PQclear);
+
+    if (not result) {
       return getCommandError(std::move(command_name),
-                             e.what(),
+                             PQerrorMessage(backend->conn_),
                              std::forward<QueryArgsCallable>(query_args));
     }
+    return getCommandResult(*result,
+                            std::move(command_name),
+                            std::forward<QueryArgsCallable>(query_args));
   }
 
   std::string checkAccountRolePermission(
@@ -313,14 +492,41 @@ namespace {
         .str();
   }
 
-  template <typename Format>
-  void appendCommandName(const std::string &name,
-                         Format &cmd,
-                         bool do_validation) {
-    auto command_name = name
-        + (do_validation ? PreparedStatement::validationPrefix
-                         : PreparedStatement::noValidationPrefix);
-    cmd % command_name;
+  std::string statementName(const std::string &name, Validation validation) {
+    switch (validation) {
+      case Validation::kFull:
+        return name + PreparedStatement::validationPrefix;
+      case Validation::kWithoutPermissions:
+        return name + PreparedStatement::noPermissionsPrefix;
+      case Validation::kNone:
+        break;
+    }
+    return name + PreparedStatement::noValidationPrefix;
+  }
+
+  /**
+   * @return domain part of the account or asset id, e.g. domain of
+   * account@domain
+   */
+  std::string domainOf(const std::string &id, char separator) {
+    auto position = id.find(separator);
+    return position == std::string::npos ? std::string{}
+                                         : id.substr(position + 1);
+  }
+
+  /**
+   * Cached counterpart of checkAccountHasRoleOrGrantablePerm
+   * @return true if the permission is known to be present
+   */
+  bool hasRoleOrGrantablePermission(
+      iroha::ametsuchi::WsvCacheView &cache,
+      shared_model::interface::permissions::Role role,
+      shared_model::interface::permissions::Grantable grantable,
+      const shared_model::interface::types::AccountIdType &creator_id,
+      const shared_model::interface::types::AccountIdType &account_id) {
+    return cache.hasGrantablePermission(creator_id, account_id, grantable)
+        or (creator_id == account_id
+            and cache.hasAccountPermission(creator_id, role));
   }
 
   /**
@@ -454,9 +660,9 @@ namespace iroha {
           has_signatory AS (SELECT * FROM signatory WHERE public_key = $4),
           insert_account AS
           (
-              INSERT INTO account(account_id, domain_id, quorum, data)
+              INSERT INTO account(account_id, domain_id, quorum)
               (
-                  SELECT $2, $3, 1, '{}' WHERE (EXISTS
+                  SELECT $2, $3, 1 WHERE (EXISTS
                       (SELECT * FROM insert_signatory) OR EXISTS
                       (SELECT * FROM has_signatory)
                   ) AND EXISTS (SELECT * FROM get_domain_default_role)
@@ -580,10 +786,12 @@ namespace iroha {
           PREPARE %s (text, text, text) AS
           WITH
           %s
+          %s
           delete_account_signatory AS (DELETE FROM account_has_signatory
               WHERE account_id = $2
               AND public_key = $3
               %s
+              %s
               RETURNING (1)),
           delete_signatory AS
           (
@@ -604,6 +812,8 @@ namespace iroha {
                   ELSE 1
               END
               %s
+              %s
+              %s
               ELSE 1
           END AS result)";
 
@@ -625,14 +835,17 @@ namespace iroha {
                   ELSE 1 END AS result)";
 
     const std::string PostgresCommandExecutor::setAccountDetailBase = R"(
-          PREPARE %s (text, text, text[], text[], text, text) AS
+          PREPARE %s (text, text, text, text) AS
           WITH %s
               inserted AS
               (
-                  UPDATE account SET data = jsonb_set(
-                  CASE WHEN data ?$1 THEN data ELSE
-                  jsonb_set(data, $3, $6::jsonb) END,
-                  $4, $5::jsonb) WHERE account_id=$2 %s
+                  INSERT INTO account_detail(account_id, writer, key, value)
+                  (
+                      SELECT $2, $1, $3, $4::jsonb #>> '{}' WHERE EXISTS
+                          (SELECT * FROM account WHERE account_id=$2) %s
+                  )
+                  ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = EXCLUDED.value
                   RETURNING (1)
               )
               SELECT CASE WHEN EXISTS (SELECT * FROM inserted) THEN 0
@@ -650,9 +863,11 @@ namespace iroha {
               UPDATE account SET quorum=$3
               WHERE account_id=$2
               %s
+              %s
               RETURNING (1)
           )
           SELECT CASE WHEN EXISTS (SELECT * FROM updated) THEN 0
+              %s
               %s
               ELSE 1
           END AS result)";
@@ -789,12 +1004,17 @@ namespace iroha {
           .str();
     }
 
+    using shared_model::interface::permissions::Grantable;
+    using shared_model::interface::permissions::Role;
+
     PostgresCommandExecutor::PostgresCommandExecutor(
         soci::session &sql,
         std::shared_ptr<shared_model::interface::PermissionToString>
-            perm_converter)
+            perm_converter,
+        std::shared_ptr<WsvCacheView> wsv_cache)
         : sql_(sql),
           do_validation_(true),
+          wsv_cache_(std::move(wsv_cache)),
           perm_converter_{std::move(perm_converter)} {}
 
     void PostgresCommandExecutor::setCreatorAccountId(
@@ -807,6 +1027,48 @@ namespace iroha {
       do_validation_ = do_validation;
     }
 
+    void PostgresCommandExecutor::deferExecution(bool defer) {
+      if (not defer) {
+        deferred_commands_ = boost::none;
+      } else if (not deferred_commands_) {
+        deferred_commands_.emplace();
+      }
+    }
+
+    std::vector<PostgresCommandExecutor::DeferredCommand>
+    PostgresCommandExecutor::takeDeferredCommands() {
+      std::vector<DeferredCommand> commands;
+      if (deferred_commands_) {
+        commands.swap(*deferred_commands_);
+      }
+      return commands;
+    }
+
+    PostgresCommandExecutor::Validation
+    PostgresCommandExecutor::validationMode() const {
+      return do_validation_ ? Validation::kFull : Validation::kNone;
+    }
+
+    template <typename IsPermitted>
+    PostgresCommandExecutor::Validation PostgresCommandExecutor::validationMode(
+        IsPermitted &&is_permitted) const {
+      if (do_validation_ and wsv_cache_ and is_permitted(*wsv_cache_)) {
+        return Validation::kWithoutPermissions;
+      }
+      return validationMode();
+    }
+
+    CommandResult PostgresCommandExecutor::getDeferredCommandResult(
+        DeferredCommand command, const PGresult *result) {
+      auto query_args = [&command] { return std::move(command.query_args); };
+      if (result == nullptr) {
+        return makeCommandError(
+            std::move(command.command_name), 1, std::move(query_args));
+      }
+      return getCommandResult(
+          *result, std::move(command.command_name), std::move(query_args));
+    }
+
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddAssetQuantity &command) {
       auto &account_id = creator_account_id_;
@@ -814,12 +1076,18 @@ namespace iroha {
       auto amount = command.amount().toStringRepr();
       int precision = command.amount().precision();
 
-      // 14.09.2018 nickaleks: IR-1707 move common logic to separate function
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', %4%, '%5%')");
-
-      appendCommandName("addAssetQuantity", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(account_id, Role::kAddAssetQty)
+            or (domainOf(account_id, '@') == domainOf(asset_id, '#')
+                and cache.hasAccountPermission(account_id,
+                                               Role::kAddDomainAssetQty));
+      });
 
-      cmd = (cmd % account_id % asset_id % precision % amount);
+      auto params = QueryParameters()
+                        .text(account_id)
+                        .text(asset_id)
+                        .integer(precision)
+                        .text(amount);
 
       auto str_args = [&account_id, &asset_id, &amount, precision] {
         return getQueryArgsStringBuilder()
@@ -830,19 +1098,27 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "AddAssetQuantity", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("addAssetQuantity", validation),
+                          params,
+                          "AddAssetQuantity",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddPeer &command) {
       auto &peer = command.peer();
+      auto pubkey = peer.pubkey().hex();
 
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
-
-      appendCommandName("addPeer", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(creator_account_id_, Role::kAddPeer);
+      });
 
-      cmd = (cmd % creator_account_id_ % peer.pubkey().hex() % peer.address());
+      auto params = QueryParameters()
+                        .text(creator_account_id_)
+                        .text(pubkey)
+                        .text(peer.address());
 
       auto str_args = [&peer] {
         return getQueryArgsStringBuilder()
@@ -850,18 +1126,33 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AddPeer", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("addPeer", validation),
+                          params,
+                          "AddPeer",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddSignatory &command) {
       auto &account_id = command.accountId();
       auto pubkey = command.pubkey().hex();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
 
-      appendCommandName("addSignatory", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return hasRoleOrGrantablePermission(cache,
+                                            Role::kAddSignatory,
+                                            Grantable::kAddMySignatory,
+                                            creator_account_id_,
+                                            account_id);
+      });
+      if (wsv_cache_) {
+        wsv_cache_->invalidateSignatories(account_id);
+      }
 
-      cmd = (cmd % creator_account_id_ % account_id % pubkey);
+      auto params =
+          QueryParameters().text(creator_account_id_).text(account_id).text(
+              pubkey);
 
       auto str_args = [&account_id, &pubkey] {
         return getQueryArgsStringBuilder()
@@ -870,18 +1161,28 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AddSignatory", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("addSignatory", validation),
+                          params,
+                          "AddSignatory",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AppendRole &command) {
       auto &account_id = command.accountId();
       auto &role_name = command.roleName();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
 
-      appendCommandName("appendRole", cmd, do_validation_);
+      // appended role permissions are not cached, so it is always validated
+      auto validation = validationMode();
+      if (wsv_cache_) {
+        wsv_cache_->invalidateAccountPermissions(account_id);
+      }
 
-      cmd = (cmd % creator_account_id_ % account_id % role_name);
+      auto params =
+          QueryParameters().text(creator_account_id_).text(account_id).text(
+              role_name);
 
       auto str_args = [&account_id, &role_name] {
         return getQueryArgsStringBuilder()
@@ -890,22 +1191,34 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AppendRole", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("appendRole", validation),
+                          params,
+                          "AppendRole",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::CreateAccount &command) {
       auto &account_name = command.accountName();
       auto &domain_id = command.domainId();
-      auto &pubkey = command.pubkey().hex();
+      auto pubkey = command.pubkey().hex();
       shared_model::interface::types::AccountIdType account_id =
           account_name + "@" + domain_id;
 
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%')");
-
-      appendCommandName("createAccount", cmd, do_validation_);
+      // default role permissions are not cached, so it is always validated
+      auto validation = validationMode();
+      if (wsv_cache_) {
+        wsv_cache_->invalidateAccountPermissions(account_id);
+        wsv_cache_->invalidateSignatories(account_id);
+      }
 
-      cmd = (cmd % creator_account_id_ % account_id % domain_id % pubkey);
+      auto params = QueryParameters()
+                        .text(creator_account_id_)
+                        .text(account_id)
+                        .text(domain_id)
+                        .text(pubkey);
 
       auto str_args = [&account_id, &domain_id, &pubkey] {
         return getQueryArgsStringBuilder()
@@ -915,8 +1228,12 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "CreateAccount", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("createAccount", validation),
+                          params,
+                          "CreateAccount",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -924,11 +1241,17 @@ namespace iroha {
       auto &domain_id = command.domainId();
       auto asset_id = command.assetName() + "#" + domain_id;
       int precision = command.precision();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', %5%)");
 
-      appendCommandName("createAsset", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(creator_account_id_,
+                                          Role::kCreateAsset);
+      });
 
-      cmd = (cmd % creator_account_id_ % asset_id % domain_id % precision);
+      auto params = QueryParameters()
+                        .text(creator_account_id_)
+                        .text(asset_id)
+                        .text(domain_id)
+                        .integer(precision);
 
       auto str_args = [&domain_id, &asset_id, precision] {
         return getQueryArgsStringBuilder()
@@ -938,18 +1261,27 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateAsset", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("createAsset", validation),
+                          params,
+                          "CreateAsset",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::CreateDomain &command) {
       auto &domain_id = command.domainId();
       auto &default_role = command.userDefaultRole();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
 
-      appendCommandName("createDomain", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(creator_account_id_,
+                                          Role::kCreateDomain);
+      });
 
-      cmd = (cmd % creator_account_id_ % domain_id % default_role);
+      auto params =
+          QueryParameters().text(creator_account_id_).text(domain_id).text(
+              default_role);
 
       auto str_args = [&domain_id, &default_role] {
         return getQueryArgsStringBuilder()
@@ -958,7 +1290,12 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateDomain", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("createDomain", validation),
+                          params,
+                          "CreateDomain",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -966,11 +1303,16 @@ namespace iroha {
       auto &role_id = command.roleName();
       auto &permissions = command.rolePermissions();
       auto perm_str = permissions.toBitstring();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
 
-      appendCommandName("createRole", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(creator_account_id_,
+                                          Role::kCreateRole)
+            and cache.hasAccountPermissions(creator_account_id_, permissions);
+      });
 
-      cmd = (cmd % creator_account_id_ % role_id % perm_str);
+      auto params =
+          QueryParameters().text(creator_account_id_).text(role_id).literal(
+              perm_str);
 
       auto str_args = [&role_id, &perm_str] {
         // TODO [IR-1889] Akvinikym 21.11.18: integrate
@@ -981,18 +1323,30 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateRole", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("createRole", validation),
+                          params,
+                          "CreateRole",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::DetachRole &command) {
       auto &account_id = command.accountId();
       auto &role_name = command.roleName();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
 
-      appendCommandName("detachRole", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(creator_account_id_,
+                                          Role::kDetachRole);
+      });
+      if (wsv_cache_) {
+        wsv_cache_->invalidateAccountPermissions(account_id);
+      }
 
-      cmd = (cmd % creator_account_id_ % account_id % role_name);
+      auto params =
+          QueryParameters().text(creator_account_id_).text(account_id).text(
+              role_name);
 
       auto str_args = [&account_id, &role_name] {
         return getQueryArgsStringBuilder()
@@ -1001,7 +1355,12 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "DetachRole", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("detachRole", validation),
+                          params,
+                          "DetachRole",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1015,12 +1374,22 @@ namespace iroha {
       const auto perm_str =
           shared_model::interface::GrantablePermissionSet({permission})
               .toBitstring();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%')");
 
-      appendCommandName("grantPermission", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(
+            creator_account_id_,
+            shared_model::interface::permissions::permissionFor(permission));
+      });
+      if (wsv_cache_) {
+        wsv_cache_->invalidateGrantablePermissions(permittee_account_id,
+                                                   creator_account_id_);
+      }
 
-      cmd =
-          (cmd % creator_account_id_ % permittee_account_id % perm_str % perm);
+      auto params = QueryParameters()
+                        .text(creator_account_id_)
+                        .text(permittee_account_id)
+                        .literal(perm_str)
+                        .literal(perm);
 
       auto str_args = [&creator_account_id = creator_account_id_,
                        &permittee_account_id,
@@ -1032,19 +1401,33 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "GrantPermission", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("grantPermission", validation),
+                          params,
+                          "GrantPermission",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::RemoveSignatory &command) {
       auto &account_id = command.accountId();
-      auto &pubkey = command.pubkey().hex();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
+      auto pubkey = command.pubkey().hex();
 
-      appendCommandName("removeSignatory", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return hasRoleOrGrantablePermission(cache,
+                                            Role::kRemoveSignatory,
+                                            Grantable::kRemoveMySignatory,
+                                            creator_account_id_,
+                                            account_id);
+      });
+      if (wsv_cache_) {
+        wsv_cache_->invalidateSignatories(account_id);
+      }
 
-      cmd = (cmd % creator_account_id_ % account_id % pubkey);
+      auto params =
+          QueryParameters().text(creator_account_id_).text(account_id).text(
+              pubkey);
 
       auto str_args = [&account_id, &pubkey] {
         return getQueryArgsStringBuilder()
@@ -1053,8 +1436,12 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "RemoveSignatory", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("removeSignatory", validation),
+                          params,
+                          "RemoveSignatory",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1070,12 +1457,20 @@ namespace iroha {
                              .set(permission)
                              .toBitstring();
 
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%')");
-
-      appendCommandName("revokePermission", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasGrantablePermission(
+            permittee_account_id, creator_account_id_, permission);
+      });
+      if (wsv_cache_) {
+        wsv_cache_->invalidateGrantablePermissions(permittee_account_id,
+                                                   creator_account_id_);
+      }
 
-      cmd = (cmd % creator_account_id_ % permittee_account_id % perms
-             % without_perm_str);
+      auto params = QueryParameters()
+                        .text(creator_account_id_)
+                        .text(permittee_account_id)
+                        .literal(perms)
+                        .literal(without_perm_str);
 
       auto str_args = [&creator_account_id = creator_account_id_,
                        &permittee_account_id,
@@ -1087,8 +1482,12 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "RevokePermission", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("revokePermission", validation),
+                          params,
+                          "RevokePermission",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1100,18 +1499,24 @@ namespace iroha {
         // When creator is not known, it is genesis block
         creator_account_id_ = "genesis";
       }
-      std::string json = "{" + creator_account_id_ + "}";
-      std::string empty_json = "{}";
-      std::string filled_json = "{" + creator_account_id_ + ", " + key + "}";
+      // the value is decoded as a json string, as it was before details got
+      // their own table
       std::string val = "\"" + value + "\"";
 
-      auto cmd = boost::format(
-          "EXECUTE %1% ('%2%', '%3%', '%4%', '%5%', '%6%', '%7%')");
-
-      appendCommandName("setAccountDetail", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % account_id % json % filled_json % val
-             % empty_json);
+      auto validation = validationMode([&](auto &cache) {
+        return creator_account_id_ == account_id
+            or cache.hasGrantablePermission(creator_account_id_,
+                                            account_id,
+                                            Grantable::kSetMyAccountDetail)
+            or cache.hasAccountPermission(creator_account_id_,
+                                          Role::kSetDetail);
+      });
+
+      auto params = QueryParameters()
+                        .text(creator_account_id_)
+                        .text(account_id)
+                        .text(key)
+                        .text(val);
 
       auto str_args = [&account_id, &key, &value] {
         return getQueryArgsStringBuilder()
@@ -1121,19 +1526,33 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "SetAccountDetail", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("setAccountDetail", validation),
+                          params,
+                          "SetAccountDetail",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::SetQuorum &command) {
       auto &account_id = command.accountId();
       int quorum = command.newQuorum();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', %4%)");
 
-      appendCommandName("setQuorum", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return hasRoleOrGrantablePermission(cache,
+                                            Role::kSetQuorum,
+                                            Grantable::kSetMyQuorum,
+                                            creator_account_id_,
+                                            account_id);
+      });
+      if (wsv_cache_) {
+        wsv_cache_->invalidateSignatories(account_id);
+      }
 
-      cmd = (cmd % creator_account_id_ % account_id % quorum);
+      auto params =
+          QueryParameters().text(creator_account_id_).text(account_id).integer(
+              quorum);
 
       auto str_args = [&account_id, quorum] {
         return getQueryArgsStringBuilder()
@@ -1142,7 +1561,12 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "SetQuorum", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("setQuorum", validation),
+                          params,
+                          "SetQuorum",
+                          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1150,11 +1574,20 @@ namespace iroha {
       auto &asset_id = command.assetId();
       auto amount = command.amount().toStringRepr();
       uint32_t precision = command.amount().precision();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', %4%, '%5%')");
 
-      appendCommandName("subtractAssetQuantity", cmd, do_validation_);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(creator_account_id_,
+                                          Role::kSubtractAssetQty)
+            or (domainOf(creator_account_id_, '@') == domainOf(asset_id, '#')
+                and cache.hasAccountPermission(creator_account_id_,
+                                               Role::kSubtractDomainAssetQty));
+      });
 
-      cmd = (cmd % creator_account_id_ % asset_id % precision % amount);
+      auto params = QueryParameters()
+                        .text(creator_account_id_)
+                        .text(asset_id)
+                        .integer(precision)
+                        .text(amount);
 
       auto str_args = [&creator_account_id = creator_account_id_,
                        &asset_id,
@@ -1169,7 +1602,12 @@ namespace iroha {
       };
 
       return executeQuery(
-          sql_, cmd.str(), "SubtractAssetQuantity", std::move(str_args));
+          sql_,
+          deferred_commands_,
+          statementName("subtractAssetQuantity", validation),
+          params,
+          "SubtractAssetQuantity",
+          std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1179,13 +1617,25 @@ namespace iroha {
       auto &asset_id = command.assetId();
       auto amount = command.amount().toStringRepr();
       uint32_t precision = command.amount().precision();
-      auto cmd =
-          boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%', %6%, '%7%')");
 
-      appendCommandName("transferAsset", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % src_account_id % dest_account_id
-             % asset_id % precision % amount);
+      auto validation = validationMode([&](auto &cache) {
+        return cache.hasAccountPermission(dest_account_id, Role::kReceive)
+            and (creator_account_id_ == src_account_id
+                     ? cache.hasAccountPermission(creator_account_id_,
+                                                  Role::kTransfer)
+                     : cache.hasGrantablePermission(
+                           creator_account_id_,
+                           src_account_id,
+                           Grantable::kTransferMyAssets));
+      });
+
+      auto params = QueryParameters()
+                        .text(creator_account_id_)
+                        .text(src_account_id)
+                        .text(dest_account_id)
+                        .text(asset_id)
+                        .integer(precision)
+                        .text(amount);
 
       auto str_args =
           [&src_account_id, &dest_account_id, &asset_id, &amount, precision] {
@@ -1198,8 +1648,12 @@ namespace iroha {
                 .finalize();
           };
 
-      return executeQuery(
-          sql_, cmd.str(), "TransferAsset", std::move(str_args));
+      return executeQuery(sql_,
+                          deferred_commands_,
+                          statementName("transferAsset", validation),
+                          params,
+                          "TransferAsset",
+                          std::move(str_args));
     }
 
     void PostgresCommandExecutor::prepareStatements(soci::session &sql) {
@@ -1386,7 +1840,15 @@ namespace iroha {
           {"removeSignatory",
            removeSignatoryBase,
            {(boost::format(R"(
-          has_perm AS (%s),
+          has_perm AS (%s),)")
+             % checkAccountHasRoleOrGrantablePerm(
+                   shared_model::interface::permissions::Role::kRemoveSignatory,
+                   shared_model::interface::permissions::Grantable::
+                       kRemoveMySignatory,
+                   "$1",
+                   "$2"))
+                .str(),
+            ruleCheck(R"(
           get_account AS (
               SELECT quorum FROM account WHERE account_id = $2 LIMIT 1
            ),
@@ -1402,26 +1864,22 @@ namespace iroha {
               SELECT quorum FROM get_account
               WHERE quorum < (SELECT COUNT(*) FROM get_signatories)
           ),
-          )")
-             % checkAccountHasRoleOrGrantablePerm(
-                   shared_model::interface::permissions::Role::kRemoveSignatory,
-                   shared_model::interface::permissions::Grantable::
-                       kRemoveMySignatory,
-                   "$1",
-                   "$2"))
-                .str(),
+          )"),
             R"(
-              AND (SELECT * FROM has_perm)
+              AND (SELECT * FROM has_perm))",
+            ruleCheck(R"(
               AND EXISTS (SELECT * FROM get_account)
               AND EXISTS (SELECT * FROM get_signatories)
               AND EXISTS (SELECT * FROM check_account_signatories)
-          )",
+          )"),
+            ruleCheck(R"(
+              WHEN NOT EXISTS (SELECT * FROM get_account) THEN 3)"),
             R"(
-              WHEN NOT EXISTS (SELECT * FROM get_account) THEN 3
-              WHEN NOT (SELECT * FROM has_perm) THEN 2
+              WHEN NOT (SELECT * FROM has_perm) THEN 2)",
+            ruleCheck(R"(
               WHEN NOT EXISTS (SELECT * FROM get_signatory) THEN 4
               WHEN NOT EXISTS (SELECT * FROM check_account_signatories) THEN 5
-          )"}});
+          )")}});
 
       statements.push_back({"revokePermission",
                             revokePermissionBase,
@@ -1462,7 +1920,7 @@ namespace iroha {
       statements.push_back(
           {"setQuorum",
            setQuorumBase,
-           {R"( get_signatories AS (
+           {ruleCheck(R"( get_signatories AS (
                     SELECT public_key FROM account_has_signatory
                     WHERE account_id = $2
                 ),
@@ -1470,7 +1928,7 @@ namespace iroha {
                     SELECT 1 FROM account
                     WHERE $3 <= (SELECT COUNT(*) FROM get_signatories)
                     AND account_id = $2
-                ),)",
+                ),)"),
             (boost::format(R"(
           has_perm AS (%s),)")
              % checkAccountHasRoleOrGrantablePerm(
@@ -1480,15 +1938,16 @@ namespace iroha {
                    "$1",
                    "$2"))
                 .str(),
-            R"(AND EXISTS
+            ruleCheck(R"(AND EXISTS
               (SELECT * FROM get_signatories)
-              AND EXISTS (SELECT * FROM check_account_signatories)
-              AND (SELECT * FROM has_perm))",
+              AND EXISTS (SELECT * FROM check_account_signatories))"),
+            R"(AND (SELECT * FROM has_perm))",
             R"(
-              WHEN NOT (SELECT * FROM has_perm) THEN 2
+              WHEN NOT (SELECT * FROM has_perm) THEN 2)",
+            ruleCheck(R"(
               WHEN NOT EXISTS (SELECT * FROM get_signatories) THEN 4
               WHEN NOT EXISTS (SELECT * FROM check_account_signatories) THEN 5
-              )"}});
+              )")}});
 
       statements.push_back({"subtractAssetQuantity",
                             subtractAssetQuantityBase,
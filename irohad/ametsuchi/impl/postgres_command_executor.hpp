@@ -7,6 +7,8 @@
 #define IROHA_POSTGRES_COMMAND_EXECUTOR_HPP
 
 #include "ametsuchi/command_executor.hpp"
+
+#include <libpq-fe.h>
 #include "ametsuchi/impl/soci_utils.hpp"
 
 namespace shared_model {
@@ -18,12 +20,46 @@ namespace shared_model {
 namespace iroha {
   namespace ametsuchi {
 
+    class WsvCacheView;
+
     class PostgresCommandExecutor : public CommandExecutor {
      public:
+      /// Command prepared statement call for the deferred execution
+      struct DeferredCommand {
+        /// name of the statement prepared in the session
+        std::string statement_name;
+        /// values of the statement parameters
+        std::vector<std::string> parameters;
+        /// formats of the parameters in the libpq notation, 0 for text and 1
+        /// for binary
+        std::vector<int> parameter_formats;
+        std::string command_name;
+        std::string query_args;
+      };
+
+      /// Checks, which are run by a command statement
+      enum class Validation {
+        /// permissions and the other rules of the command
+        kFull,
+        /// only the rules other than permissions, which are known from the
+        /// cache, e.g. existence of the account and signatories vs quorum
+        kWithoutPermissions,
+        /// nothing, the validation is off
+        kNone
+      };
+
+      /**
+       * @param transaction - session to execute commands in
+       * @param perm_converter - converter of permissions to string
+       * @param wsv_cache - cache telling which permission checks can be
+       * skipped, nullptr if every command has to be checked by the database.
+       * The executor marks the cached data changed by the commands
+       */
       PostgresCommandExecutor(
           soci::session &transaction,
           std::shared_ptr<shared_model::interface::PermissionToString>
-              perm_converter);
+              perm_converter,
+          std::shared_ptr<WsvCacheView> wsv_cache = nullptr);
 
       void setCreatorAccountId(
           const shared_model::interface::types::AccountIdType
@@ -31,6 +67,32 @@ namespace iroha {
 
       void doValidation(bool do_validation) override;
 
+      /**
+       * Switch the deferred execution mode. In this mode the visited commands
+       * are not executed, but their prepared statements and bound parameters
+       * are collected, so that they can be sent to the database together with
+       * other statements. The results
+       * returned for the commands are always successful then
+       * @param defer - whether the execution should be deferred
+       */
+      void deferExecution(bool defer);
+
+      /**
+       * @return commands deferred since the previous call, in the visiting
+       * order
+       */
+      std::vector<DeferredCommand> takeDeferredCommands();
+
+      /**
+       * Get the result of the deferred command execution
+       * @param command - executed command
+       * @param result - result of the command statement, nullptr if the
+       * statement was not executed
+       * @return CommandResult with command name and error message
+       */
+      static CommandResult getDeferredCommandResult(DeferredCommand command,
+                                                    const PGresult *result);
+
       CommandResult operator()(
           const shared_model::interface::AddAssetQuantity &command) override;
 
@@ -83,8 +145,23 @@ namespace iroha {
       static void prepareStatements(soci::session &sql);
 
      private:
+      /**
+       * @return checks of a command statement, which permissions are not
+       * cached
+       */
+      Validation validationMode() const;
+
+      /**
+       * @return checks of a command statement, permission checks are skipped
+       * if the cache knows that the command is permitted
+       */
+      template <typename IsPermitted>
+      Validation validationMode(IsPermitted &&is_permitted) const;
+
       soci::session &sql_;
       bool do_validation_;
+      std::shared_ptr<WsvCacheView> wsv_cache_;
+      boost::optional<std::vector<DeferredCommand>> deferred_commands_;
 
       shared_model::interface::types::AccountIdType creator_account_id_;
       std::shared_ptr<shared_model::interface::PermissionToString>
@@ -19,6 +19,8 @@
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "common/byteutils.hpp"
 #include "cryptography/public_key.hpp"
+#include "interfaces/queries/account_detail_pagination_meta.hpp"
+#include "interfaces/queries/asset_pagination_meta.hpp"
 #include "interfaces/queries/blocks_query.hpp"
 #include "interfaces/queries/get_account.hpp"
 #include "interfaces/queries/get_account_asset_transactions.hpp"
@@ -123,6 +125,69 @@ namespace {
         .str();
   }
 
+  /**
+   * Generate an expression building all details of the account in the form
+   * they are returned to clients: {"writer": {"key": "value"}}
+   * @param account_id - expression with the account id
+   * @return jsonb expression, an empty object if there are no details
+   */
+  std::string accountDetailsJson(const std::string &account_id) {
+    return (boost::format(R"((SELECT COALESCE(jsonb_object_agg(writer, details),
+              '{}'::jsonb) FROM (SELECT writer,
+              jsonb_object_agg(key, to_jsonb(value)) AS details
+              FROM account_detail WHERE account_id = %s
+              GROUP BY writer) AS writers))")
+            % account_id)
+        .str();
+  }
+
+  /**
+   * Generate a condition restricting account details to the key and the
+   * writer of the query, if they are set
+   * @param query - account detail query
+   * @return SQL condition to be appended to the WHERE clause
+   */
+  std::string accountDetailFilter(
+      const shared_model::interface::GetAccountDetail &query) {
+    std::string filter;
+    if (auto writer = query.writer()) {
+      filter += (boost::format(" AND writer = '%s'") % *writer).str();
+    }
+    if (auto key = query.key()) {
+      filter += (boost::format(" AND key = '%s'") % *key).str();
+    }
+    return filter;
+  }
+
+  /// Id of an account detail record read from the database
+  class AccountDetailRecordId final
+      : public shared_model::interface::AccountDetailRecordId {
+   public:
+    AccountDetailRecordId(
+        shared_model::interface::types::AccountIdType writer,
+        shared_model::interface::types::AccountDetailKeyType key)
+        : writer_(std::move(writer)), key_(std::move(key)) {}
+
+    const shared_model::interface::types::AccountIdType &writer()
+        const override {
+      return writer_;
+    }
+
+    const shared_model::interface::types::AccountDetailKeyType &key()
+        const override {
+      return key_;
+    }
+
+   protected:
+    ModelType *clone() const override {
+      return new AccountDetailRecordId(*this);
+    }
+
+   private:
+    shared_model::interface::types::AccountIdType writer_;
+    shared_model::interface::types::AccountDetailKeyType key_;
+  };
+
   /// Query result is a tuple of optionals, since there could be no entry
   template <typename... Value>
   using QueryType = boost::tuple<boost::optional<Value>...>;
@@ -310,6 +375,17 @@ namespace iroha {
       return boost::apply_visitor(visitor_, query.get());
     }
 
+    QueryExecutorResult PostgresQueryExecutor::validateAndExecutePage(
+        const shared_model::interface::Query &query,
+        const bool validate_signatories,
+        const boost::optional<shared_model::interface::types::HashType>
+            &first_tx_hash) {
+      visitor_.setFirstTxHash(first_tx_hash);
+      auto response = validateAndExecute(query, validate_signatories);
+      visitor_.setFirstTxHash(boost::none);
+      return response;
+    }
+
     bool PostgresQueryExecutor::validate(
         const shared_model::interface::BlocksQuery &query,
         const bool validate_signatories = true) {
@@ -371,6 +447,19 @@ namespace iroha {
       query_hash_ = query_hash;
     }
 
+    void PostgresQueryExecutorVisitor::setFirstTxHash(
+        boost::optional<shared_model::interface::types::HashType>
+            first_tx_hash) {
+      first_tx_hash_ = std::move(first_tx_hash);
+    }
+
+    boost::optional<shared_model::interface::types::HashType>
+    PostgresQueryExecutorVisitor::firstTxHash(
+        const shared_model::interface::TxPaginationMeta &pagination_meta)
+        const {
+      return first_tx_hash_ ? first_tx_hash_ : pagination_meta.firstTxHash();
+    }
+
     std::unique_ptr<shared_model::interface::QueryResponse>
     PostgresQueryExecutorVisitor::logAndReturnErrorResponse(
         QueryErrorType error_type,
@@ -415,6 +504,7 @@ namespace iroha {
         const Query &q,
         QueryChecker &&qry_checker,
         const std::string &related_txs,
+        const std::string &tx_count,
         QueryApplier applier,
         Permissions... perms) {
       using QueryTuple = QueryType<shared_model::interface::types::HeightType,
@@ -422,24 +512,16 @@ namespace iroha {
                                    uint64_t>;
       using PermissionTuple = boost::tuple<int>;
       const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
+      auto first_hash = firstTxHash(pagination_info);
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
       auto base = boost::format(R"(WITH has_perms AS (%s),
-      my_txs AS (%s),
       first_hash AS (%s),
       total_size AS (
-        SELECT COUNT(*) FROM my_txs
+        SELECT COALESCE((%s), 0) AS count
       ),
-      t AS (
-        SELECT my_txs.height, my_txs.index
-        FROM my_txs JOIN
-        first_hash ON my_txs.height > first_hash.height
-        OR (my_txs.height = first_hash.height AND
-            my_txs.index >= first_hash.index)
-        LIMIT :page_size
-      )
+      t AS (%s)
       SELECT height, index, count, perm FROM t
       RIGHT OUTER JOIN has_perms ON TRUE
       JOIN total_size ON TRUE
@@ -449,17 +531,11 @@ namespace iroha {
       auto first_by_hash = R"(SELECT height, index FROM position_by_hash
       WHERE hash = :hash LIMIT 1)";
 
-      // select first ever tx
-      auto first_tx = R"(SELECT height, index FROM position_by_hash
-      ORDER BY height, index ASC LIMIT 1)";
+      // position before any tx
+      auto first_tx = R"(SELECT 0::bigint AS height, 0::bigint AS index)";
 
       auto cmd = base % hasQueryPermission(creator_id_, q.accountId(), perms...)
-          % related_txs;
-      if (first_hash) {
-        cmd = base % first_by_hash;
-      } else {
-        cmd = base % first_tx;
-      }
+          % (first_hash ? first_by_hash : first_tx) % tx_count % related_txs;
 
       auto query = cmd.str();
 
@@ -532,6 +608,126 @@ namespace iroha {
           notEnoughPermissionsResponse(perm_converter_, perms...));
     }
 
+    QueryExecutorResult
+    PostgresQueryExecutorVisitor::executeAccountDetailPageQuery(
+        const shared_model::interface::GetAccountDetail &q,
+        const shared_model::interface::AccountDetailPaginationMeta
+            &pagination_meta) {
+      using QueryTuple =
+          QueryType<shared_model::interface::types::DetailType,
+                    shared_model::interface::types::AccountDetailsNumberType,
+                    shared_model::interface::types::AccountIdType,
+                    shared_model::interface::types::AccountDetailKeyType,
+                    int,
+                    int>;
+      using PermissionTuple = boost::tuple<int>;
+
+      // the page starts with the requested record and is walked in the order
+      // of the primary key; every record is not less than a pair of empty
+      // strings
+      auto first_record_id = pagination_meta.firstRecordId();
+      const shared_model::interface::types::AccountIdType first_writer =
+          first_record_id ? first_record_id->writer() : "";
+      const shared_model::interface::types::AccountDetailKeyType first_key =
+          first_record_id ? first_record_id->key() : "";
+      const auto page_size = pagination_meta.pageSize();
+
+      // one extra record is retrieved to populate next_record_id
+      auto cmd = (boost::format(R"(WITH has_perms AS (%1%),
+      total_number AS (
+          SELECT COUNT(*) AS total_number FROM account_detail
+          WHERE account_id = :account_id%2%
+      ),
+      page AS (
+          SELECT writer, key, value,
+              row_number() OVER (ORDER BY writer, key) AS position
+          FROM account_detail
+          WHERE account_id = :account_id%2%
+              AND (writer, key) >= (:first_writer, :first_key)
+          ORDER BY writer, key LIMIT %3% + 1
+      ),
+      detail AS (
+          SELECT COALESCE(jsonb_object_agg(writer, details), '{}'::jsonb)
+              #>> '{}' AS json
+          FROM (SELECT writer, jsonb_object_agg(key, to_jsonb(value))
+              AS details FROM page WHERE position <= %3%
+              GROUP BY writer) AS writers
+      ),
+      next_record AS (
+          SELECT COALESCE(MAX(writer), '') AS next_writer,
+              COALESCE(MAX(key), '') AS next_key,
+              COUNT(*) AS has_next
+          FROM page WHERE position > %3%
+      ),
+      first_record AS (
+          SELECT COUNT(*) AS first_found FROM page
+          WHERE position = 1 AND writer = :first_writer
+              AND key = :first_key
+      )
+      SELECT json, total_number, next_writer, next_key, has_next,
+          first_found, perm FROM detail
+      RIGHT OUTER JOIN has_perms ON TRUE
+      JOIN total_number ON TRUE
+      JOIN next_record ON TRUE
+      JOIN first_record ON TRUE
+      )")
+                  % hasQueryPermission(creator_id_,
+                                       q.accountId(),
+                                       Role::kGetMyAccDetail,
+                                       Role::kGetAllAccDetail,
+                                       Role::kGetDomainAccDetail)
+                  % accountDetailFilter(q) % page_size)
+                     .str();
+
+      return executeQuery<QueryTuple, PermissionTuple>(
+          [&] {
+            return (sql_.prepare << cmd,
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(first_writer, "first_writer"),
+                    soci::use(first_key, "first_key"));
+          },
+          [&](auto range, auto &) {
+            if (range.empty()) {
+              return this->logAndReturnErrorResponse(
+                  QueryErrorType::kNoAccountDetail, q.accountId(), 0);
+            }
+
+            return apply(
+                range.front(),
+                [&](auto &json,
+                    auto &total_number,
+                    auto &next_writer,
+                    auto &next_key,
+                    auto &has_next,
+                    auto &first_found) {
+                  // the requested record is the first one in the page,
+                  // unless the account does not have it
+                  if (first_record_id and not first_found) {
+                    auto error =
+                        (boost::format("invalid pagination record id: %s")
+                         % first_record_id->toString())
+                            .str();
+                    return this->logAndReturnErrorResponse(
+                        QueryErrorType::kStatefulFailed, error, 4);
+                  }
+
+                  if (not has_next) {
+                    return query_response_factory_
+                        ->createAccountDetailResponse(
+                            json, total_number, boost::none, query_hash_);
+                  }
+                  const AccountDetailRecordId next_record_id{next_writer,
+                                                             next_key};
+                  return query_response_factory_->createAccountDetailResponse(
+                      json, total_number, next_record_id, query_hash_);
+                });
+          },
+          notEnoughPermissionsResponse(perm_converter_,
+                                       Role::kGetMyAccDetail,
+                                       Role::kGetAllAccDetail,
+                                       Role::kGetDomainAccDetail));
+    }
+
     QueryExecutorResult PostgresQueryExecutorVisitor::operator()(
         const shared_model::interface::GetAccount &q) {
       using QueryTuple =
@@ -544,7 +740,8 @@ namespace iroha {
 
       auto cmd = (boost::format(R"(WITH has_perms AS (%s),
       t AS (
-          SELECT a.account_id, a.domain_id, a.quorum, a.data, ARRAY_AGG(ar.role_id) AS roles
+          SELECT a.account_id, a.domain_id, a.quorum, %s AS data,
+              ARRAY_AGG(ar.role_id) AS roles
           FROM account AS a, account_has_roles AS ar
           WHERE a.account_id = :target_account_id
           AND ar.account_id = a.account_id
@@ -557,7 +754,8 @@ namespace iroha {
                                        q.accountId(),
                                        Role::kGetMyAccount,
                                        Role::kGetAllAccounts,
-                                       Role::kGetDomainAccounts))
+                                       Role::kGetDomainAccounts)
+                  % accountDetailsJson("a.account_id"))
                      .str();
 
       auto query_apply = [this](auto &account_id,
@@ -690,13 +888,20 @@ namespace iroha {
 
     QueryExecutorResult PostgresQueryExecutorVisitor::operator()(
         const shared_model::interface::GetAccountTransactions &q) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
+      // transactions are walked from the requested one in the order of
+      // the index, without looking at the preceding ones
+      std::string related_txs = R"(SELECT height, index
       FROM index_by_creator_height
       WHERE creator_id = :account_id
-      ORDER BY height, index ASC)";
+      AND (height, index) >= (SELECT height, index FROM first_hash)
+      ORDER BY height, index ASC
+      LIMIT :page_size)";
+
+      std::string tx_count = R"(SELECT count FROM tx_count_by_creator
+      WHERE creator_id = :account_id)";
 
       const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
+      auto first_hash = firstTxHash(pagination_info);
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
@@ -704,13 +909,13 @@ namespace iroha {
         return [&] {
           if (first_hash) {
             return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(first_hash->hex(), "hash"),
+                    soci::use(query_size, "page_size"));
           } else {
             return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(query_size));
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(query_size, "page_size"));
           }
         };
       };
@@ -727,6 +932,7 @@ namespace iroha {
       return executeTransactionsQuery(q,
                                       std::move(check_query),
                                       related_txs,
+                                      tx_count,
                                       apply_query,
                                       Role::kGetMyAccTxs,
                                       Role::kGetAllAccTxs,
@@ -809,14 +1015,22 @@ namespace iroha {
 
     QueryExecutorResult PostgresQueryExecutorVisitor::operator()(
         const shared_model::interface::GetAccountAssetTransactions &q) {
+      // transactions are walked from the requested one in the order of
+      // the index, without looking at the preceding ones
       std::string related_txs = R"(SELECT DISTINCT height, index
           FROM position_by_account_asset
           WHERE account_id = :account_id
           AND asset_id = :asset_id
-          ORDER BY height, index ASC)";
+          AND (height, index) >= (SELECT height, index FROM first_hash)
+          ORDER BY height, index ASC
+          LIMIT :page_size)";
+
+      std::string tx_count = R"(SELECT count FROM tx_count_by_account_asset
+          WHERE account_id = :account_id
+          AND asset_id = :asset_id)";
 
       const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
+      auto first_hash = firstTxHash(pagination_info);
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
@@ -824,15 +1038,15 @@ namespace iroha {
         return [&] {
           if (first_hash) {
             return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(q.assetId(), "asset_id"),
+                    soci::use(first_hash->hex(), "hash"),
+                    soci::use(query_size, "page_size"));
           } else {
             return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(query_size));
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(q.assetId(), "asset_id"),
+                    soci::use(query_size, "page_size"));
           }
         };
       };
@@ -855,6 +1069,7 @@ namespace iroha {
       return executeTransactionsQuery(q,
                                       std::move(check_query),
                                       related_txs,
+                                      tx_count,
                                       apply_query,
                                       Role::kGetMyAccAstTxs,
                                       Role::kGetAllAccAstTxs,
@@ -866,43 +1081,94 @@ namespace iroha {
       using QueryTuple =
           QueryType<shared_model::interface::types::AccountIdType,
                     shared_model::interface::types::AssetIdType,
-                    std::string>;
+                    std::string,
+                    shared_model::interface::types::AccountAssetsNumberType>;
       using PermissionTuple = boost::tuple<int>;
 
+      // the page starts with the requested asset and is walked in the order
+      // of the primary key; every asset id is not less than an empty string
+      auto pagination_meta = q.paginationMeta();
+      auto first_asset_id = pagination_meta
+          ? pagination_meta->firstAssetId()
+          : boost::none;
+      const shared_model::interface::types::AssetIdType page_start =
+          first_asset_id ? *first_asset_id : "";
+      // retrieve one extra asset to populate next_asset_id
+      auto page_limit = pagination_meta
+          ? std::to_string(pagination_meta->pageSize() + 1ull)
+          : std::string{"ALL"};
+
       auto cmd = (boost::format(R"(WITH has_perms AS (%s),
+      total_number AS (
+          SELECT COUNT(*) AS total_number FROM account_has_asset
+          WHERE account_id = :account_id
+      ),
       t AS (
           SELECT * FROM account_has_asset
-          WHERE account_id = :account_id
+          WHERE account_id = :account_id AND asset_id >= :first_asset_id
+          ORDER BY asset_id LIMIT %s
       )
-      SELECT account_id, asset_id, amount, perm FROM t
+      SELECT account_id, asset_id, amount, total_number, perm FROM t
       RIGHT OUTER JOIN has_perms ON TRUE
+      JOIN total_number ON TRUE
       )")
                   % hasQueryPermission(creator_id_,
                                        q.accountId(),
                                        Role::kGetMyAccAst,
                                        Role::kGetAllAccAst,
-                                       Role::kGetDomainAccAst))
+                                       Role::kGetDomainAccAst)
+                  % page_limit)
                      .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] { return (sql_.prepare << cmd, soci::use(q.accountId())); },
+          [&] {
+            return (sql_.prepare << cmd,
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(page_start, "first_asset_id"));
+          },
           [&](auto range, auto &) {
             std::vector<
                 std::tuple<shared_model::interface::types::AccountIdType,
                            shared_model::interface::types::AssetIdType,
                            shared_model::interface::Amount>>
                 assets;
-            boost::for_each(range, [&assets](auto t) {
+            shared_model::interface::types::AccountAssetsNumberType
+                total_number = 0;
+            boost::for_each(range, [&assets, &total_number](auto t) {
               apply(t,
-                    [&assets](auto &account_id, auto &asset_id, auto &amount) {
+                    [&assets, &total_number](auto &account_id,
+                                             auto &asset_id,
+                                             auto &amount,
+                                             auto &total) {
                       assets.push_back(std::make_tuple(
                           std::move(account_id),
                           std::move(asset_id),
                           shared_model::interface::Amount(amount)));
+                      total_number = total;
                     });
             });
+
+            // the requested asset is the first one in the page, unless the
+            // account does not have it
+            if (first_asset_id
+                and (assets.empty()
+                     or std::get<1>(assets.front()) != *first_asset_id)) {
+              auto error = (boost::format("invalid pagination asset id: %s")
+                            % *first_asset_id)
+                               .str();
+              return this->logAndReturnErrorResponse(
+                  QueryErrorType::kStatefulFailed, error, 4);
+            }
+
+            boost::optional<shared_model::interface::types::AssetIdType>
+                next_asset_id;
+            if (pagination_meta
+                and assets.size() > pagination_meta->pageSize()) {
+              next_asset_id = std::get<1>(assets.back());
+              assets.pop_back();
+            }
             return query_response_factory_->createAccountAssetResponse(
-                assets, query_hash_);
+                assets, total_number, next_asset_id, query_hash_);
           },
           notEnoughPermissionsResponse(perm_converter_,
                                        Role::kGetMyAccAst,
@@ -912,50 +1178,64 @@ namespace iroha {
 
     QueryExecutorResult PostgresQueryExecutorVisitor::operator()(
         const shared_model::interface::GetAccountDetail &q) {
-      using QueryTuple = QueryType<shared_model::interface::types::DetailType>;
+      if (auto pagination_meta = q.paginationMeta()) {
+        return executeAccountDetailPageQuery(q, *pagination_meta);
+      }
+
+      using QueryTuple =
+          QueryType<shared_model::interface::types::DetailType,
+                    shared_model::interface::types::AccountDetailsNumberType>;
       using PermissionTuple = boost::tuple<int>;
 
+      // the responses repeat the formatting of the json functions over the
+      // single jsonb document, which used to keep all the details
       std::string query_detail;
       if (q.key() and q.writer()) {
-        auto filled_json = (boost::format("{\"%s\", \"%s\"}") % q.writer().get()
-                            % q.key().get());
-        query_detail = (boost::format(R"(SELECT json_build_object('%s'::text,
-            json_build_object('%s'::text, (SELECT data #>> '%s'
-            FROM account WHERE account_id = :account_id))) AS json)")
-                        % q.writer().get() % q.key().get() % filled_json)
+        query_detail = (boost::format(R"(SELECT json_build_object('%1%'::text,
+            json_build_object('%2%'::text, (SELECT value FROM account_detail
+            WHERE account_id = :account_id AND writer = '%1%'
+            AND key = '%2%'))) AS json)")
+                        % q.writer().get() % q.key().get())
                            .str();
       } else if (q.key() and not q.writer()) {
+        // writers are ordered the way jsonb orders object keys
         query_detail =
             (boost::format(
-                 R"(SELECT json_object_agg(key, value) AS json FROM (SELECT
-            json_build_object(kv.key, json_build_object('%1%'::text,
-            kv.value -> '%1%')) FROM jsonb_each((SELECT data FROM account
-            WHERE account_id = :account_id)) kv WHERE kv.value ? '%1%') AS
-            jsons, json_each(json_build_object))")
+                 R"(SELECT json_object_agg(writer, json_build_object(
+            '%1%'::text, to_jsonb(value))
+            ORDER BY octet_length(writer), writer COLLATE "C") AS json
+            FROM account_detail
+            WHERE account_id = :account_id AND key = '%1%')")
              % q.key().get())
                 .str();
       } else if (not q.key() and q.writer()) {
         query_detail = (boost::format(R"(SELECT json_build_object('%1%'::text,
-          (SELECT data -> '%1%' FROM account WHERE account_id =
-           :account_id)) AS json)")
+          (SELECT jsonb_object_agg(key, to_jsonb(value)) FROM account_detail
+           WHERE account_id = :account_id AND writer = '%1%')) AS json)")
                         % q.writer().get())
                            .str();
       } else {
-        query_detail = (boost::format(R"(SELECT data#>>'{}' AS json FROM account
-            WHERE account_id = :account_id)"))
+        query_detail = (boost::format(R"(SELECT %s #>> '{}' AS json
+            FROM account WHERE account_id = :account_id)")
+                        % accountDetailsJson("account.account_id"))
                            .str();
       }
       auto cmd = (boost::format(R"(WITH has_perms AS (%s),
-      detail AS (%s)
-      SELECT json, perm FROM detail
+      detail AS (%s),
+      total_number AS (
+          SELECT COUNT(*) AS total_number FROM account_detail
+          WHERE account_id = :account_id%s
+      )
+      SELECT json, total_number, perm FROM detail
       RIGHT OUTER JOIN has_perms ON TRUE
+      JOIN total_number ON TRUE
       )")
                   % hasQueryPermission(creator_id_,
                                        q.accountId(),
                                        Role::kGetMyAccDetail,
                                        Role::kGetAllAccDetail,
                                        Role::kGetDomainAccDetail)
-                  % query_detail)
+                  % query_detail % accountDetailFilter(q))
                      .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
@@ -969,10 +1249,11 @@ namespace iroha {
                   QueryErrorType::kNoAccountDetail, q.accountId(), 0);
             }
 
-            return apply(range.front(), [this](auto &json) {
-              return query_response_factory_->createAccountDetailResponse(
-                  json, query_hash_);
-            });
+            return apply(
+                range.front(), [this](auto &json, auto &total_number) {
+                  return query_response_factory_->createAccountDetailResponse(
+                      json, total_number, boost::none, query_hash_);
+                });
           },
           notEnoughPermissionsResponse(perm_converter_,
                                        Role::kGetMyAccDetail,
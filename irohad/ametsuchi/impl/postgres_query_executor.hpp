@@ -30,8 +30,10 @@
 #include "interfaces/iroha_internal/block_json_converter.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "interfaces/permission_to_string.hpp"
+#include "interfaces/queries/account_detail_pagination_meta.hpp"
 #include "interfaces/queries/blocks_query.hpp"
 #include "interfaces/queries/query.hpp"
+#include "interfaces/queries/tx_pagination_meta.hpp"
 #include "interfaces/query_responses/query_response.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -66,6 +68,15 @@ namespace iroha {
 
       void setQueryHash(const shared_model::crypto::Hash &query_hash);
 
+      /**
+       * Set the first transaction of the page of transaction queries instead
+       * of the one from the pagination meta of the query
+       * @param first_tx_hash - hash of the transaction, none to use the meta
+       */
+      void setFirstTxHash(
+          boost::optional<shared_model::interface::types::HashType>
+              first_tx_hash);
+
       /**
        * Check that account has a specific role permission
        * @param permission to be in that account
@@ -113,6 +124,11 @@ namespace iroha {
           const shared_model::interface::GetPendingTransactions &q);
 
      private:
+      /// @return first transaction of the page of a transaction query
+      boost::optional<shared_model::interface::types::HashType> firstTxHash(
+          const shared_model::interface::TxPaginationMeta &pagination_meta)
+          const;
+
       /**
        * Get transactions from block using range from range_gen and filtered by
        * predicate pred
@@ -165,8 +181,11 @@ namespace iroha {
        * @param query - query object
        * @param qry_checker - fallback checker of the query, needed if paging
        * hash is not specified and 0 transaction are returned as a query result
-       * @param related_txs - SQL query which returns transaction relevant
-       * to this query
+       * @param related_txs - SQL query which returns a page of transactions
+       * relevant to this query, which starts at the position selected by
+       * first_hash query and is limited by :page_size
+       * @param tx_count - SQL query which returns the total number of
+       * transactions relevant to this query
        * @param applier - function which accepts SQL
        * and returns another function which executes that query
        * @param perms - permissions, necessary to execute the query
@@ -180,9 +199,22 @@ namespace iroha {
           const Query &query,
           QueryChecker &&qry_checker,
           const std::string &related_txs,
+          const std::string &tx_count,
           QueryApplier applier,
           Permissions... perms);
 
+      /**
+       * Execute account detail query, which returns a page of details
+       * ordered by writer and key
+       * @param query - query object
+       * @param pagination_meta - requested page
+       * @return Result of a query execution
+       */
+      QueryExecutorResult executeAccountDetailPageQuery(
+          const shared_model::interface::GetAccountDetail &query,
+          const shared_model::interface::AccountDetailPaginationMeta
+              &pagination_meta);
+
       /**
        * Check if entry with such key exists in the database
        * @tparam ReturnValueType - type of the value to be returned in the
@@ -229,6 +261,7 @@ namespace iroha {
       KeyValueStorage &block_store_;
       shared_model::interface::types::AccountIdType creator_id_;
       shared_model::interface::types::HashType query_hash_;
+      boost::optional<shared_model::interface::types::HashType> first_tx_hash_;
       std::shared_ptr<PendingTransactionStorage> pending_txs_storage_;
       std::shared_ptr<shared_model::interface::BlockJsonConverter> converter_;
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
@@ -256,6 +289,12 @@ namespace iroha {
           const shared_model::interface::Query &query,
           const bool validate_signatories) override;
 
+      QueryExecutorResult validateAndExecutePage(
+          const shared_model::interface::Query &query,
+          const bool validate_signatories,
+          const boost::optional<shared_model::interface::types::HashType>
+              &first_tx_hash) override;
+
       bool validate(const shared_model::interface::BlocksQuery &query,
                     const bool validate_signatories) override;
 
@@ -0,0 +1,177 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace {
+  /**
+   * WSV tables with the columns their rows are sorted by. The order of the
+   * tables satisfies foreign key constraints on load
+   */
+  const std::vector<std::pair<std::string, std::string>> kTables = {
+      {"role", "role_id"},
+      {"domain", "domain_id"},
+      {"signatory", "public_key"},
+      {"account", "account_id"},
+      {"account_detail", "account_id, writer, key"},
+      {"account_has_signatory", "account_id, public_key"},
+      {"peer", "public_key"},
+      {"asset", "asset_id"},
+      {"account_has_asset", "account_id, asset_id"},
+      {"role_has_permissions", "role_id"},
+      {"account_has_roles", "account_id, role_id"},
+      {"account_has_grantable_permissions",
+       "permittee_account_id, account_id"},
+      {"position_by_hash", "hash, height, index"},
+      {"tx_status_by_hash", "hash, status"},
+      {"height_by_account_set", "account_id, height"},
+      {"index_by_creator_height", "id"},
+      {"position_by_account_asset", "account_id, asset_id, height, index"}};
+
+  /// @return table with the given name, nullptr if it is not a WSV table
+  const std::pair<std::string, std::string> *findTable(
+      const std::string &name) {
+    auto it = std::find_if(kTables.begin(),
+                           kTables.end(),
+                           [&name](const auto &table) {
+                             return table.first == name;
+                           });
+    return it == kTables.end() ? nullptr : &*it;
+  }
+
+  const std::string kFinishLoadQuery =
+      // the serial column keeps its values, so the sequence has to follow them
+      "SELECT setval(pg_get_serial_sequence('index_by_creator_height', "
+      "'id'), coalesce(max(id), 0) + 1, false) "
+      "FROM index_by_creator_height;\n"
+      // transaction counters are not dumped, they are derived from the indices
+      "INSERT INTO tx_count_by_creator(creator_id, count) "
+      "SELECT creator_id, COUNT(*) FROM index_by_creator_height "
+      "GROUP BY creator_id;\n"
+      "INSERT INTO tx_count_by_account_asset(account_id, asset_id, count) "
+      "SELECT account_id, asset_id, COUNT(DISTINCT (height, index)) "
+      "FROM position_by_account_asset GROUP BY account_id, asset_id;";
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr size_t PostgresWsvSnapshot::kRowsPerStatement;
+
+    PostgresWsvSnapshot::PostgresWsvSnapshot(soci::session &sql) : sql_(sql) {}
+
+    expected::Result<void, std::string> PostgresWsvSnapshot::begin() {
+      try {
+        sql_ << "BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY";
+        // the snapshot of the transaction is taken by its first statement
+        sql_ << "SELECT 1";
+        return {};
+      } catch (const std::exception &e) {
+        return expected::makeError(std::string("Failed to start WSV dump: ")
+                                   + e.what());
+      }
+    }
+
+    expected::Result<std::string, std::string> PostgresWsvSnapshot::dump() {
+      try {
+        const std::string fetch = "FETCH "
+            + std::to_string(kRowsPerStatement) + " FROM wsv_snapshot_dump";
+        std::string data;
+        for (const auto &table : kTables) {
+          data += table.first + '\n';
+          sql_ << "DECLARE wsv_snapshot_dump NO SCROLL CURSOR FOR "
+                  "SELECT row_to_json(t)::text FROM "
+                  + table.first + " t ORDER BY " + table.second;
+          size_t fetched;
+          do {
+            fetched = 0;
+            soci::rowset<std::string> rows = (sql_.prepare << fetch);
+            for (const auto &row : rows) {
+              data += row;
+              data += '\n';
+              ++fetched;
+            }
+          } while (fetched == kRowsPerStatement);
+          sql_ << "CLOSE wsv_snapshot_dump";
+        }
+        sql_ << "COMMIT";
+        return expected::makeValue(std::move(data));
+      } catch (const std::exception &e) {
+        try {
+          sql_ << "ROLLBACK";
+        } catch (const std::exception &) {
+          // the session is broken, the transaction is gone with it
+        }
+        return expected::makeError(std::string("Failed to dump WSV: ")
+                                   + e.what());
+      }
+    }
+
+    expected::Result<void, std::string> PostgresWsvSnapshot::load(
+        const std::string &data) {
+      const std::pair<std::string, std::string> *table = nullptr;
+      // rows of the current table, which are not inserted yet, separated by
+      // commas
+      std::string rows;
+      size_t rows_number = 0;
+      auto insert_rows = [this, &table, &rows, &rows_number] {
+        if (rows_number == 0) {
+          return;
+        }
+        std::string array = "[" + rows + "]";
+        sql_ << "INSERT INTO " + table->first
+                + " SELECT * FROM json_populate_recordset(NULL::"
+                + table->first + ", CAST(:rows AS json))",
+            soci::use(array);
+        rows.clear();
+        rows_number = 0;
+      };
+
+      try {
+        size_t line_begin = 0;
+        while (line_begin < data.size()) {
+          auto line_end = data.find('\n', line_begin);
+          if (line_end == std::string::npos) {
+            line_end = data.size();
+          }
+          auto line = data.substr(line_begin, line_end - line_begin);
+          line_begin = line_end + 1;
+
+          if (line.empty() or line.front() != '{') {
+            insert_rows();
+            table = findTable(line);
+            if (table == nullptr) {
+              return expected::makeError(
+                  "Failed to load WSV: unknown table " + line);
+            }
+            continue;
+          }
+          if (table == nullptr) {
+            return expected::makeError(
+                std::string("Failed to load WSV: unsupported format"));
+          }
+          if (rows_number != 0) {
+            rows += ',';
+          }
+          rows += line;
+          if (++rows_number == kRowsPerStatement) {
+            insert_rows();
+          }
+        }
+        insert_rows();
+        sql_ << kFinishLoadQuery;
+        return {};
+      } catch (const std::exception &e) {
+        return expected::makeError(std::string("Failed to load WSV: ")
+                                   + e.what());
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_WSV_SNAPSHOT_HPP
+#define IROHA_POSTGRES_WSV_SNAPSHOT_HPP
+
+#include <string>
+
+#include <soci/soci.h>
+#include "common/result.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Serializes the content of the world state view tables and loads it
+     * back. Each table is written as a line with its name followed by its
+     * rows, one JSON object per line. Rows are ordered by their keys, so equal
+     * states have equal serializations. Rows are read and written in chunks,
+     * so no single database value grows with the size of the state
+     */
+    class PostgresWsvSnapshot {
+     public:
+      explicit PostgresWsvSnapshot(soci::session &sql);
+
+      /**
+       * Start a read only transaction, which sees the state committed so far
+       * until the dump is finished. It is the only part of the dump, which
+       * has to be done before the next commit
+       * @return error message if the transaction has not been started
+       */
+      expected::Result<void, std::string> begin();
+
+      /**
+       * Serialize all WSV tables as seen by the transaction started by
+       * begin(), and finish the transaction
+       * @return serialized state or error message
+       */
+      expected::Result<std::string, std::string> dump();
+
+      /**
+       * Insert the serialized state into empty WSV tables. Must be called
+       * inside a transaction
+       * @param data - state serialized by dump()
+       * @return error message if the state has not been loaded
+       */
+      expected::Result<void, std::string> load(const std::string &data);
+
+      /// number of rows fetched or inserted by one statement
+      static constexpr size_t kRowsPerStatement = 1000;
+
+     private:
+      soci::session &sql_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_WSV_SNAPSHOT_HPP
@@ -12,7 +12,9 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
+#include "ametsuchi/impl/connection_admission.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/flat_file_wsv_snapshot_storage.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
@@ -21,7 +23,9 @@
 #include "ametsuchi/impl/postgres_query_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "common/bind.hpp"
 #include "common/byteutils.hpp"
@@ -56,6 +60,19 @@ namespace {
     log->debug("{}", formatPostgresMessage(message));
   }
 
+  std::string formatWaitTimes(
+      const iroha::ametsuchi::ConnectionAdmission::WaitTimeHistogram
+          &histogram) {
+    std::string result;
+    for (size_t i = 0; i < histogram.bounds.size(); ++i) {
+      result += "<=" + std::to_string(histogram.bounds[i].count())
+          + "ms: " + std::to_string(histogram.counts[i]) + ", ";
+    }
+    return result + ">" + std::to_string(histogram.bounds.back().count())
+        + "ms: " + std::to_string(histogram.counts.back())
+        + ", rejected: " + std::to_string(histogram.rejected);
+  }
+
 }  // namespace
 
 namespace iroha {
@@ -251,14 +268,18 @@ namespace iroha {
     const char *kTmpWsv = "TemporaryWsv";
 
     ConnectionContext::ConnectionContext(
-        std::unique_ptr<KeyValueStorage> block_store)
-        : block_store(std::move(block_store)) {}
+        std::unique_ptr<KeyValueStorage> block_store,
+        std::shared_ptr<WsvSnapshotStorage> wsv_snapshot_storage)
+        : block_store(std::move(block_store)),
+          wsv_snapshot_storage(std::move(wsv_snapshot_storage)) {}
 
     StorageImpl::StorageImpl(
         std::string block_store_dir,
         PostgresOptions postgres_options,
         std::unique_ptr<KeyValueStorage> block_store,
+        std::shared_ptr<WsvSnapshotStorage> wsv_snapshot_storage,
         std::shared_ptr<soci::connection_pool> connection,
+        std::shared_ptr<soci::connection_pool> query_connection,
         std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory,
         std::shared_ptr<shared_model::interface::BlockJsonConverter> converter,
         std::shared_ptr<shared_model::interface::PermissionToString>
@@ -266,24 +287,31 @@ namespace iroha {
         std::unique_ptr<BlockStorageFactory> block_storage_factory,
         std::unique_ptr<ReconnectionStrategyFactory>
             reconnection_strategy_factory,
-        size_t pool_size,
+        PoolOptions pool_options,
+        WsvSnapshotOptions wsv_snapshot_options,
         bool enable_prepared_blocks,
         logger::LoggerManagerTreePtr log_manager)
         : block_store_dir_(std::move(block_store_dir)),
           postgres_options_(std::move(postgres_options)),
           block_store_(std::move(block_store)),
+          wsv_snapshot_storage_(std::move(wsv_snapshot_storage)),
           connection_(std::move(connection)),
+          query_connection_(std::move(query_connection)),
+          query_admission_(std::make_shared<ConnectionAdmission>(
+              pool_options.query_pool_size, pool_options.query_max_wait)),
           factory_(std::move(factory)),
           notifier_(notifier_lifetime_),
           converter_(std::move(converter)),
           perm_converter_(std::move(perm_converter)),
           block_storage_factory_(std::move(block_storage_factory)),
+          wsv_cache_(std::make_shared<WsvCache>()),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()),
           reconnection_strategy_factory_(
               std::move(reconnection_strategy_factory)),
           callback_factory_(std::make_unique<FailoverCallbackFactory>()),
-          pool_size_(pool_size),
+          pool_options_(std::move(pool_options)),
+          wsv_snapshot_options_(wsv_snapshot_options),
           prepared_blocks_enabled_(enable_prepared_blocks),
           block_is_prepared(false),
           prepared_block_name_("prepared_block"
@@ -313,43 +341,95 @@ namespace iroha {
       };
 
       /// lambda contains actions which should be invoked once for each session
-      auto init_failover_callback = [&](soci::session &session) {
-        static size_t connection_index = 0;
-        auto restore_session = [connection_initialization](soci::session &s) {
-          return connection_initialization(s, [](auto &) {}, [](auto &) {});
-        };
-
-        auto &callback = callback_factory_->makeFailoverCallback(
-            session,
-            restore_session,
-            postgres_options_.optionsStringWithoutDbName(),
-            reconnection_strategy_factory_->create(),
-            log_manager_
-                ->getChild("SOCI connection "
-                           + std::to_string(connection_index++))
-                ->getLogger());
-
-        session.set_failover_callback(callback);
-      };
-
-      assert(pool_size > 0);
+      auto make_failover_callback_initialization =
+          [&](FailoverCallback::InitFunctionType restore_session,
+              std::string options) {
+            return [&, restore_session, options](soci::session &session) {
+              static size_t connection_index = 0;
+              auto &callback = callback_factory_->makeFailoverCallback(
+                  session,
+                  restore_session,
+                  options,
+                  reconnection_strategy_factory_->create(),
+                  log_manager_
+                      ->getChild("SOCI connection "
+                                 + std::to_string(connection_index++))
+                      ->getLogger());
+
+              session.set_failover_callback(callback);
+            };
+          };
+      auto init_failover_callback = make_failover_callback_initialization(
+          [connection_initialization](soci::session &s) {
+            return connection_initialization(s, [](auto &) {}, [](auto &) {});
+          },
+          postgres_options_.optionsStringWithoutDbName());
 
       connection_initialization(
           connection_->at(0), init_db, init_failover_callback);
-      for (size_t i = 1; i != pool_size_; i++) {
+      for (size_t i = 1; i != pool_options_.pool_size; i++) {
         soci::session &session = connection_->at(i);
         connection_initialization(
             session, [](auto &) {}, init_failover_callback);
       }
+
+      // client query sessions may be connected to a read-only replica, so
+      // the statements of the command executor are not prepared in them
+      auto query_session_initialization = [&](soci::session &session) {
+        auto *backend = static_cast<soci::postgresql_session_backend *>(
+            session.get_backend());
+        PQsetNoticeProcessor(backend->conn_, &processPqNotice, log_.get());
+      };
+      auto init_query_failover_callback = make_failover_callback_initialization(
+          query_session_initialization,
+          PostgresOptions(
+              pool_options_.query_connection.value_or(
+                  postgres_options_.optionsString()))
+              .optionsStringWithoutDbName());
+      for (size_t i = 0; i != pool_options_.query_pool_size; i++) {
+        soci::session &session = query_connection_->at(i);
+        query_session_initialization(session);
+        init_query_failover_callback(session);
+      }
     }
 
     expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
     StorageImpl::createTemporaryWsv() {
+      return leaseTemporaryWsv(boost::none);
+    }
+
+    expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+    StorageImpl::createTemporaryWsv(std::chrono::milliseconds max_wait) {
+      return leaseTemporaryWsv(max_wait);
+    }
+
+    expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+    StorageImpl::leaseTemporaryWsv(
+        boost::optional<std::chrono::milliseconds> max_wait) {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
       if (connection_ == nullptr) {
         return expected::makeError("Connection was closed");
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      TemporaryWsvImpl::SessionPtr sql;
+      if (max_wait) {
+        // the pooled session is used directly and given back to the pool
+        // with the wsv, because a proxy session can only block on the pool
+        size_t position;
+        if (not connection_->try_lease(
+                position, static_cast<int>(max_wait->count()))) {
+          return expected::makeError(
+              (boost::format("No database session got free in %d ms")
+               % max_wait->count())
+                  .str());
+        }
+        sql = TemporaryWsvImpl::SessionPtr(
+            &connection_->at(position),
+            [connection = connection_, position](soci::session *) {
+              connection->give_back(position);
+            });
+      } else {
+        sql = std::make_unique<soci::session>(*connection_);
+      }
       // if we create temporary storage, then we intend to validate a new
       // proposal. this means that any state prepared before that moment is
       // not needed and must be removed to prevent locking
@@ -362,6 +442,7 @@ namespace iroha {
               std::move(sql),
               factory_,
               perm_converter_,
+              wsv_cache_,
               log_manager_->getChild("TemporaryWorldStateView")));
     }
 
@@ -394,21 +475,39 @@ namespace iroha {
         std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
             response_factory) const {
+      // the permit guarantees that leasing a session does not block
+      std::shared_ptr<ConnectionAdmission::Permit> permit =
+          query_admission_->admit();
+      if (not permit) {
+        auto histogram = query_admission_->histogram();
+        log_->warn(
+            "createQueryExecutor: no query connection got free in {} ms, {} "
+            "queries rejected",
+            pool_options_.query_max_wait.count(),
+            histogram.rejected);
+        return boost::none;
+      }
+
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
-      if (not connection_) {
+      if (not query_connection_) {
         log_->info(
             "createQueryExecutor: connection to database is not initialised");
         return boost::none;
       }
-      return boost::make_optional<std::shared_ptr<QueryExecutor>>(
-          std::make_shared<PostgresQueryExecutor>(
-              std::make_unique<soci::session>(*connection_),
+      // the permit is returned after the session of the executor
+      return boost::make_optional(std::shared_ptr<QueryExecutor>(
+          new PostgresQueryExecutor(
+              std::make_unique<soci::session>(*query_connection_),
               *block_store_,
               std::move(pending_txs_storage),
               converter_,
               std::move(response_factory),
               perm_converter_,
-              log_manager_->getChild("QueryExecutor")));
+              log_manager_->getChild("QueryExecutor")),
+          [permit = std::move(permit)](QueryExecutor *executor) mutable {
+            delete executor;
+            permit.reset();
+          }));
     }
 
     bool StorageImpl::insertBlock(
@@ -474,10 +573,12 @@ namespace iroha {
     }
 
     void StorageImpl::reset() {
+      waitForWsvSnapshot();
       resetWsv().match(
           [this](auto &&v) {
             log_->debug("drop blocks from disk");
             block_store_->dropAll();
+            wsv_snapshot_storage_->dropAll();
           },
           [this](auto &&e) {
             log_->warn("Failed to drop WSV. Reason: {}", e.error);
@@ -493,12 +594,43 @@ namespace iroha {
           rollbackPrepared(sql);
         }
         sql << reset_;
+        wsv_cache_->invalidate();
       } catch (std::exception &e) {
         return expected::makeError(e.what());
       }
       return expected::Value<void>();
     }
 
+    expected::Result<void, std::string> StorageImpl::loadWsvSnapshot(
+        const WsvSnapshot &snapshot) {
+      log_->info("load WSV snapshot at height {}", snapshot.height);
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
+      if (connection_ == nullptr) {
+        return expected::makeError("Connection was closed");
+      }
+      try {
+        soci::session sql(*connection_);
+        // rollback possible prepared transaction
+        if (block_is_prepared) {
+          rollbackPrepared(sql);
+        }
+        sql << "BEGIN";
+        sql << reset_;
+        return PostgresWsvSnapshot(sql).load(snapshot.data).match(
+            [this, &sql](const auto &) -> expected::Result<void, std::string> {
+              sql << "COMMIT";
+              wsv_cache_->invalidate();
+              return {};
+            },
+            [&sql](const auto &error) -> expected::Result<void, std::string> {
+              sql << "ROLLBACK";
+              return error;
+            });
+      } catch (std::exception &e) {
+        return expected::makeError(e.what());
+      }
+    }
+
     void StorageImpl::resetPeers() {
       log_->info("Remove everything from peers table");
       try {
@@ -518,6 +650,7 @@ namespace iroha {
 
       if (auto dbname = postgres_options_.dbname()) {
         auto &db = dbname.value();
+        waitForWsvSnapshot();
         std::unique_lock<std::shared_timed_mutex> lock(drop_mutex);
         log_->info("Drop database {}", db);
         freeConnections();
@@ -530,16 +663,19 @@ namespace iroha {
           log_->warn("Drop database was failed. Reason: {}", e.what());
         }
       } else {
+        waitForWsvSnapshot();
         // Clear all the tables first, as it takes much less time because the
         // foreign key triggers are ignored.
         soci::session(*connection_) << reset_;
         // Empty tables can now be dropped very fast.
         soci::session(*connection_) << drop_;
       }
+      wsv_cache_->invalidate();
 
       // erase blocks
       log_->info("drop block store");
       block_store_->dropAll();
+      wsv_snapshot_storage_->dropAll();
     }
 
     void StorageImpl::freeConnections() {
@@ -553,13 +689,20 @@ namespace iroha {
         rollbackPrepared(sql);
       }
       std::vector<std::shared_ptr<soci::session>> connections;
-      for (size_t i = 0; i < pool_size_; i++) {
+      for (size_t i = 0; i < pool_options_.pool_size; i++) {
         connections.push_back(std::make_shared<soci::session>(*connection_));
         connections[i]->close();
         log_->debug("Closed connection {}", i);
       }
+      for (size_t i = 0; i < pool_options_.query_pool_size; i++) {
+        connections.push_back(
+            std::make_shared<soci::session>(*query_connection_));
+        connections.back()->close();
+        log_->debug("Closed query connection {}", i);
+      }
       connections.clear();
       connection_.reset();
+      query_connection_.reset();
     }
 
     expected::Result<bool, std::string> StorageImpl::createDatabaseIfNotExist(
@@ -603,7 +746,20 @@ namespace iroha {
       }
       log->info("block store created");
 
-      return expected::makeValue(ConnectionContext(std::move(*block_store)));
+      auto snapshot_dir =
+          FlatFileWsvSnapshotStorage::directoryFor(block_store_dir);
+      auto snapshot_store = FlatFile::create(snapshot_dir, log);
+      if (not snapshot_store) {
+        return expected::makeError(
+            (boost::format("Cannot create WSV snapshot store in %s")
+             % snapshot_dir)
+                .str());
+      }
+
+      return expected::makeValue(ConnectionContext(
+          std::move(*block_store),
+          std::make_shared<FlatFileWsvSnapshotStorage>(
+              std::move(*snapshot_store), log)));
     }
 
     expected::Result<std::shared_ptr<soci::connection_pool>, std::string>
@@ -634,7 +790,16 @@ namespace iroha {
         std::unique_ptr<ReconnectionStrategyFactory>
             reconnection_strategy_factory,
         logger::LoggerManagerTreePtr log_manager,
-        size_t pool_size) {
+        PoolOptions pool_options,
+        WsvSnapshotOptions wsv_snapshot_options) {
+      if (pool_options.pool_size < 1 or pool_options.query_pool_size < 1) {
+        return expected::makeError(
+            (boost::format("Connection pool sizes must be at least 1, got %d "
+                           "and %d for queries")
+             % pool_options.pool_size % pool_options.query_pool_size)
+                .str());
+      }
+
       boost::optional<std::string> string_res = boost::none;
 
       PostgresOptions options(postgres_options);
@@ -652,34 +817,51 @@ namespace iroha {
 
       auto ctx_result =
           initConnections(block_store_dir, log_manager->getLogger());
-      auto db_result = initPostgresConnection(postgres_options, pool_size);
+      auto db_result =
+          initPostgresConnection(postgres_options, pool_options.pool_size);
+      auto query_postgres_options =
+          pool_options.query_connection.value_or(postgres_options);
+      auto query_db_result = initPostgresConnection(
+          query_postgres_options, pool_options.query_pool_size);
       expected::Result<std::shared_ptr<StorageImpl>, std::string> storage;
       std::move(ctx_result)
           .match(
               [&](auto &&ctx) {
                 std::move(db_result).match(
                     [&](auto &&connection) {
-                      soci::session sql(*connection.value);
-                      bool enable_prepared_transactions =
-                          preparedTransactionsAvailable(sql);
-                      try {
-                        storage = expected::makeValue(
-                            std::shared_ptr<StorageImpl>(new StorageImpl(
-                                block_store_dir,
-                                options,
-                                std::move(ctx.value.block_store),
-                                std::move(connection.value),
-                                factory,
-                                converter,
-                                perm_converter,
-                                std::move(block_storage_factory),
-                                std::move(reconnection_strategy_factory),
-                                pool_size,
-                                enable_prepared_transactions,
-                                std::move(log_manager))));
-                      } catch (const std::exception &e) {
-                        storage = expected::makeError(e.what());
-                      }
+                      std::move(query_db_result)
+                          .match(
+                              [&](auto &&query_connection) {
+                                soci::session sql(*connection.value);
+                                bool enable_prepared_transactions =
+                                    preparedTransactionsAvailable(sql);
+                                try {
+                                  std::shared_ptr<StorageImpl> value(
+                                      new StorageImpl(
+                                          block_store_dir,
+                                          options,
+                                          std::move(ctx.value.block_store),
+                                          std::move(
+                                              ctx.value.wsv_snapshot_storage),
+                                          std::move(connection.value),
+                                          std::move(query_connection.value),
+                                          factory,
+                                          converter,
+                                          perm_converter,
+                                          std::move(block_storage_factory),
+                                          std::move(
+                                              reconnection_strategy_factory),
+                                          std::move(pool_options),
+                                          wsv_snapshot_options,
+                                          enable_prepared_transactions,
+                                          std::move(log_manager)));
+                                  storage = expected::makeValue(
+                                      std::move(value));
+                                } catch (const std::exception &e) {
+                                  storage = expected::makeError(e.what());
+                                }
+                              },
+                              [&](const auto &error) { storage = error; });
                     },
                     [&](const auto &error) { storage = error; });
               },
@@ -694,10 +876,14 @@ namespace iroha {
       try {
         *(storage->sql_) << "COMMIT";
         storage->committed = true;
+        wsv_cache_->invalidate();
 
         storage->block_storage_->forEach(
             [this](const auto &block) { this->storeBlock(block); });
 
+        takeWsvSnapshotIfNeeded(storage->getTopBlockHeight(),
+                                storage->getTopBlockHash());
+
         return PostgresWsvQuery(*(storage->sql_),
                                 factory_,
                                 log_manager_->getChild("WsvQuery")->getLogger())
@@ -737,6 +923,7 @@ namespace iroha {
         }
         soci::session sql(*connection_);
         sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
+        wsv_cache_->invalidate();
         PostgresBlockIndex block_index(
             sql, log_manager_->getChild("BlockIndex")->getLogger());
         block_index.index(*block);
@@ -745,9 +932,10 @@ namespace iroha {
                                 factory_,
                                 log_manager_->getChild("WsvQuery")->getLogger())
                        .getPeers()
-                   | [this, &block, &sql](auto &&peers)
+                   | [this, &block](auto &&peers)
                    -> boost::optional<std::unique_ptr<LedgerState>> {
           if (this->storeBlock(block)) {
+            this->takeWsvSnapshotIfNeeded(block->height(), block->hash());
             return boost::optional<std::unique_ptr<LedgerState>>(
                 std::make_unique<LedgerState>(
                     std::move(peers), block->height(), block->hash()));
@@ -774,6 +962,11 @@ namespace iroha {
           log_manager_->getChild("WsvQuery")->getLogger());
     }
 
+    std::shared_ptr<WsvSnapshotStorage> StorageImpl::getWsvSnapshotStorage()
+        const {
+      return wsv_snapshot_storage_;
+    }
+
     std::shared_ptr<BlockQuery> StorageImpl::getBlockQuery() const {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
       if (not connection_) {
@@ -805,6 +998,10 @@ namespace iroha {
       } else {
         soci::session &sql = *wsv_impl.sql_;
         try {
+          auto finalization = wsv_impl.takePendingFinalization();
+          if (not finalization.empty()) {
+            sql << finalization;
+          }
           sql << "PREPARE TRANSACTION '" + prepared_block_name_ + "';";
           block_is_prepared = true;
         } catch (const std::exception &e) {
@@ -816,6 +1013,7 @@ namespace iroha {
     }
 
     StorageImpl::~StorageImpl() {
+      waitForWsvSnapshot();
       notifier_lifetime_.unsubscribe();
       freeConnections();
     }
@@ -835,6 +1033,8 @@ namespace iroha {
           [this, &block](const auto &v) {
             if (block_store_->add(block->height(), stringToBytes(v.value))) {
               notifier_.get_subscriber().on_next(block);
+              log_->debug("Query connection wait times: {}",
+                          formatWaitTimes(query_admission_->histogram()));
               return true;
             } else {
               log_->error("Block insertion failed: {}", *block);
@@ -847,12 +1047,83 @@ namespace iroha {
           });
     }
 
+    void StorageImpl::takeWsvSnapshotIfNeeded(
+        shared_model::interface::types::HeightType height,
+        const shared_model::interface::types::HashType &hash) {
+      if (wsv_snapshot_options_.period == 0 or height == 0) {
+        return;
+      }
+      auto last_height = wsv_snapshot_storage_->lastHeight(height).value_or(0);
+      if (height < last_height + wsv_snapshot_options_.period) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> lock(wsv_snapshot_mutex_);
+      if (wsv_snapshot_task_.valid()
+          and wsv_snapshot_task_.wait_for(std::chrono::seconds(0))
+              != std::future_status::ready) {
+        log_->info("postpone WSV snapshot at height {}, the previous one is "
+                   "still being taken",
+                   height);
+        return;
+      }
+
+      // the dump has its own connection, so it neither takes a session from
+      // the pool nor delays the next commits. Its transaction is started
+      // before the next commit, so it sees exactly the state at the height
+      std::unique_ptr<soci::session> sql;
+      try {
+        sql = std::make_unique<soci::session>(
+            *soci::factory_postgresql(), postgres_options_.optionsString());
+      } catch (const std::exception &e) {
+        log_->warn("Failed to connect for WSV snapshot: {}",
+                   formatPostgresMessage(e.what()));
+        return;
+      }
+      auto started = PostgresWsvSnapshot(*sql).begin().match(
+          [](const auto &) { return true; },
+          [this](const auto &error) {
+            log_->warn("{}", error.error);
+            return false;
+          });
+      if (not started) {
+        return;
+      }
+
+      log_->info("take WSV snapshot at height {}", height);
+      wsv_snapshot_task_ = std::async(
+          std::launch::async,
+          [this, sql = std::move(sql), height, hash] {
+            PostgresWsvSnapshot(*sql).dump().match(
+                [this, height, &hash](auto &&data) {
+                  auto data_hash = makeWsvSnapshotHash(data.value);
+                  if (not wsv_snapshot_storage_->insert(WsvSnapshot{
+                          height, hash, data_hash, std::move(data.value)})) {
+                    log_->warn("Failed to store WSV snapshot at height {}",
+                               height);
+                    return;
+                  }
+                  log_->info("WSV snapshot at height {} is stored", height);
+                  wsv_snapshot_storage_->keepLatest(wsv_snapshot_options_.kept);
+                },
+                [this](const auto &error) { log_->warn("{}", error.error); });
+          });
+    }
+
+    void StorageImpl::waitForWsvSnapshot() {
+      std::lock_guard<std::mutex> lock(wsv_snapshot_mutex_);
+      if (wsv_snapshot_task_.valid()) {
+        wsv_snapshot_task_.wait();
+      }
+    }
+
     const std::string &StorageImpl::drop_ = R"(
 DROP TABLE IF EXISTS account_has_signatory;
 DROP TABLE IF EXISTS account_has_asset;
 DROP TABLE IF EXISTS role_has_permissions CASCADE;
 DROP TABLE IF EXISTS account_has_roles;
 DROP TABLE IF EXISTS account_has_grantable_permissions CASCADE;
+DROP TABLE IF EXISTS account_detail;
 DROP TABLE IF EXISTS account;
 DROP TABLE IF EXISTS asset;
 DROP TABLE IF EXISTS domain;
@@ -866,6 +1137,8 @@ DROP TABLE IF EXISTS height_by_account_set;
 DROP TABLE IF EXISTS index_by_creator_height;
 DROP TABLE IF EXISTS position_by_account_asset;
 DROP TABLE IF EXISTS position_by_hash;
+DROP TABLE IF EXISTS tx_count_by_creator;
+DROP TABLE IF EXISTS tx_count_by_account_asset;
 )";
 
     const std::string &StorageImpl::reset_ = R"(
@@ -874,6 +1147,7 @@ TRUNCATE TABLE account_has_asset RESTART IDENTITY CASCADE;
 TRUNCATE TABLE role_has_permissions RESTART IDENTITY CASCADE;
 TRUNCATE TABLE account_has_roles RESTART IDENTITY CASCADE;
 TRUNCATE TABLE account_has_grantable_permissions RESTART IDENTITY CASCADE;
+TRUNCATE TABLE account_detail RESTART IDENTITY CASCADE;
 TRUNCATE TABLE account RESTART IDENTITY CASCADE;
 TRUNCATE TABLE asset RESTART IDENTITY CASCADE;
 TRUNCATE TABLE domain RESTART IDENTITY CASCADE;
@@ -885,6 +1159,8 @@ TRUNCATE TABLE tx_status_by_hash RESTART IDENTITY CASCADE;
 TRUNCATE TABLE height_by_account_set RESTART IDENTITY CASCADE;
 TRUNCATE TABLE index_by_creator_height RESTART IDENTITY CASCADE;
 TRUNCATE TABLE position_by_account_asset RESTART IDENTITY CASCADE;
+TRUNCATE TABLE tx_count_by_creator RESTART IDENTITY CASCADE;
+TRUNCATE TABLE tx_count_by_account_asset RESTART IDENTITY CASCADE;
 )";
 
     const std::string &StorageImpl::reset_peers_ = R"(
@@ -910,9 +1186,34 @@ CREATE TABLE IF NOT EXISTS account (
     account_id character varying(288),
     domain_id character varying(255) NOT NULL REFERENCES domain,
     quorum int NOT NULL,
-    data JSONB,
     PRIMARY KEY (account_id)
 );
+CREATE TABLE IF NOT EXISTS account_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value text NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
+CREATE INDEX IF NOT EXISTS account_detail_account_key_index
+    ON account_detail (account_id, key);
+-- move the details of databases created before account_detail table, which
+-- kept them in account.data as {writer: {key: value}}
+DO $$
+BEGIN
+    IF EXISTS (SELECT * FROM information_schema.columns
+               WHERE table_schema = current_schema()
+               AND table_name = 'account' AND column_name = 'data') THEN
+        INSERT INTO account_detail(account_id, writer, key, value)
+        SELECT account_id, writer.key, detail.key, detail.value #>> '{}'
+        FROM account,
+            jsonb_each(CASE WHEN jsonb_typeof(data) = 'object'
+                       THEN data END) AS writer,
+            jsonb_each(CASE WHEN jsonb_typeof(writer.value) = 'object'
+                       THEN writer.value END) AS detail;
+        ALTER TABLE account DROP COLUMN data;
+    END IF;
+END $$;
 CREATE TABLE IF NOT EXISTS account_has_signatory (
     account_id character varying(288) NOT NULL REFERENCES account,
     public_key varchar NOT NULL REFERENCES signatory,
@@ -985,6 +1286,41 @@ CREATE TABLE IF NOT EXISTS position_by_account_asset (
     height bigint,
     index bigint
 );
+CREATE INDEX IF NOT EXISTS position_by_hash_hash_index
+    ON position_by_hash USING hash (hash);
+CREATE INDEX IF NOT EXISTS index_by_creator_height_position_index
+    ON index_by_creator_height (creator_id, height, index);
+CREATE INDEX IF NOT EXISTS position_by_account_asset_position_index
+    ON position_by_account_asset (account_id, asset_id, height, index);
+-- fill the transaction counters of databases created before them
+DO $$
+BEGIN
+    IF NOT EXISTS (SELECT * FROM information_schema.tables
+                   WHERE table_schema = current_schema()
+                   AND table_name = 'tx_count_by_creator') THEN
+        CREATE TABLE tx_count_by_creator (
+            creator_id text,
+            count bigint NOT NULL,
+            PRIMARY KEY (creator_id)
+        );
+        INSERT INTO tx_count_by_creator(creator_id, count)
+        SELECT creator_id, COUNT(*) FROM index_by_creator_height
+        GROUP BY creator_id;
+    END IF;
+    IF NOT EXISTS (SELECT * FROM information_schema.tables
+                   WHERE table_schema = current_schema()
+                   AND table_name = 'tx_count_by_account_asset') THEN
+        CREATE TABLE tx_count_by_account_asset (
+            account_id text,
+            asset_id text,
+            count bigint NOT NULL,
+            PRIMARY KEY (account_id, asset_id)
+        );
+        INSERT INTO tx_count_by_account_asset(account_id, asset_id, count)
+        SELECT account_id, asset_id, COUNT(DISTINCT (height, index))
+        FROM position_by_account_asset GROUP BY account_id, asset_id;
+    END IF;
+END $$;
 )";
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -9,15 +9,21 @@
 #include "ametsuchi/storage.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <cmath>
+#include <future>
+#include <mutex>
 #include <shared_mutex>
 
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 #include "ametsuchi/block_storage_factory.hpp"
+#include "ametsuchi/impl/pool_options.hpp"
+#include "ametsuchi/impl/wsv_snapshot_options.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
+#include "ametsuchi/wsv_snapshot_storage.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/iroha_internal/block_json_converter.hpp"
 #include "interfaces/permission_to_string.hpp"
@@ -29,11 +35,16 @@ namespace iroha {
 
     class FlatFile;
     class FailoverCallbackFactory;
+    class WsvCache;
+    class ConnectionAdmission;
 
     struct ConnectionContext {
-      explicit ConnectionContext(std::unique_ptr<KeyValueStorage> block_store);
+      ConnectionContext(
+          std::unique_ptr<KeyValueStorage> block_store,
+          std::shared_ptr<WsvSnapshotStorage> wsv_snapshot_storage);
 
       std::unique_ptr<KeyValueStorage> block_store;
+      std::shared_ptr<WsvSnapshotStorage> wsv_snapshot_storage;
     };
 
     class StorageImpl : public Storage {
@@ -63,11 +74,15 @@ namespace iroha {
           std::unique_ptr<ReconnectionStrategyFactory>
               reconnection_strategy_factory,
           logger::LoggerManagerTreePtr log_manager,
-          size_t pool_size = 10);
+          PoolOptions pool_options = PoolOptions(),
+          WsvSnapshotOptions wsv_snapshot_options = WsvSnapshotOptions());
 
       expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() override;
 
+      expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+      createTemporaryWsv(std::chrono::milliseconds max_wait) override;
+
       expected::Result<std::unique_ptr<MutableStorage>, std::string>
       createMutableStorage() override;
 
@@ -95,6 +110,9 @@ namespace iroha {
 
       expected::Result<void, std::string> resetWsv() override;
 
+      expected::Result<void, std::string> loadWsvSnapshot(
+          const WsvSnapshot &snapshot) override;
+
       void resetPeers() override;
 
       void dropStorage() override;
@@ -111,6 +129,9 @@ namespace iroha {
 
       std::shared_ptr<BlockQuery> getBlockQuery() const override;
 
+      std::shared_ptr<WsvSnapshotStorage> getWsvSnapshotStorage()
+          const override;
+
       rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
       on_commit() override;
 
@@ -122,7 +143,9 @@ namespace iroha {
       StorageImpl(std::string block_store_dir,
                   PostgresOptions postgres_options,
                   std::unique_ptr<KeyValueStorage> block_store,
+                  std::shared_ptr<WsvSnapshotStorage> wsv_snapshot_storage,
                   std::shared_ptr<soci::connection_pool> connection,
+                  std::shared_ptr<soci::connection_pool> query_connection,
                   std::shared_ptr<shared_model::interface::CommonObjectsFactory>
                       factory,
                   std::shared_ptr<shared_model::interface::BlockJsonConverter>
@@ -132,7 +155,8 @@ namespace iroha {
                   std::unique_ptr<BlockStorageFactory> block_storage_factory,
                   std::unique_ptr<ReconnectionStrategyFactory>
                       reconnection_strategy_factory,
-                  size_t pool_size,
+                  PoolOptions pool_options,
+                  WsvSnapshotOptions wsv_snapshot_options,
                   bool enable_prepared_blocks,
                   logger::LoggerManagerTreePtr log_manager);
 
@@ -145,6 +169,14 @@ namespace iroha {
       const PostgresOptions postgres_options_;
 
      private:
+      /**
+       * Create temporary wsv on a session of the pool
+       * @param max_wait - maximum time to wait for a free session, none to
+       * wait as long as needed
+       */
+      expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+      leaseTemporaryWsv(boost::optional<std::chrono::milliseconds> max_wait);
+
       /**
        * revert prepared transaction
        */
@@ -156,10 +188,34 @@ namespace iroha {
       bool storeBlock(
           std::shared_ptr<const shared_model::interface::Block> block);
 
+      /**
+       * take a WSV snapshot if enough blocks were committed since the last one
+       * and the previous snapshot is finished. Only the transaction of the
+       * dump is started here, the state is dumped and stored in background
+       * @param height - height of the top committed block
+       * @param hash - hash of the top committed block
+       */
+      void takeWsvSnapshotIfNeeded(
+          shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HashType &hash);
+
+      /**
+       * wait until the snapshot being taken in background, if any, is stored
+       */
+      void waitForWsvSnapshot();
+
       std::unique_ptr<KeyValueStorage> block_store_;
 
+      std::shared_ptr<WsvSnapshotStorage> wsv_snapshot_storage_;
+
       std::shared_ptr<soci::connection_pool> connection_;
 
+      /// sessions of client queries, separated from the ledger work
+      std::shared_ptr<soci::connection_pool> query_connection_;
+
+      /// limits waiting for the client query sessions
+      std::shared_ptr<ConnectionAdmission> query_admission_;
+
       std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory_;
 
       rxcpp::composite_subscription notifier_lifetime_;
@@ -174,6 +230,9 @@ namespace iroha {
 
       std::unique_ptr<BlockStorageFactory> block_storage_factory_;
 
+      /// committed WSV data read by stateful validation
+      std::shared_ptr<WsvCache> wsv_cache_;
+
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
 
@@ -184,7 +243,15 @@ namespace iroha {
 
       std::unique_ptr<FailoverCallbackFactory> callback_factory_;
 
-      const size_t pool_size_;
+      const PoolOptions pool_options_;
+
+      const WsvSnapshotOptions wsv_snapshot_options_;
+
+      /// guards wsv_snapshot_task_
+      std::mutex wsv_snapshot_mutex_;
+
+      /// snapshot being taken in background, if any
+      std::future<void> wsv_snapshot_task_;
 
       bool prepared_blocks_enabled_;
 
@@ -5,8 +5,9 @@
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 
-#include <boost/format.hpp>
+#include <soci/postgresql/soci-postgresql.h>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/wsv_cache_view.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/commands/command.hpp"
 #include "interfaces/permission_to_string.hpp"
@@ -14,117 +15,424 @@
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 
+namespace {
+  const std::string kTransactionSavepoint = "savepoint_temp_wsv";
+
+  using ResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  constexpr int kTextFormat = 0;
+  constexpr int kBinaryFormat = 1;
+
+  /// Statement of a batch with its bound parameters
+  struct Statement {
+    /// whether the text is a name of the statement prepared in the session,
+    /// or a query to be parsed
+    bool is_prepared;
+    std::string text;
+    std::vector<std::string> parameters;
+    /// formats of the parameters, text or binary
+    std::vector<int> parameter_formats;
+    /// format of the result columns, text or binary
+    int result_format;
+  };
+
+  /// Pointers to the statement parameter values in the libpq format
+  struct ParameterPointers {
+    explicit ParameterPointers(const Statement &statement) {
+      for (const auto &parameter : statement.parameters) {
+        values.push_back(parameter.data());
+        lengths.push_back(parameter.size());
+      }
+    }
+
+    std::vector<const char *> values;
+    std::vector<int> lengths;
+  };
+
+  /**
+   * Query, which verifies whether transaction has at least quorum signatures
+   * and they are a subset of creator account signatories. The parameters are
+   * the creator account id and the array of signature public keys
+   */
+  const std::string kSignaturesQuery = R"(
+      SELECT sum(count) = cardinality($2::text[])
+             AND sum(quorum) <= cardinality($2::text[])
+      FROM
+          (SELECT count(public_key)
+          FROM unnest($2::text[]) AS CTE1(public_key)
+          WHERE public_key IN
+              (SELECT public_key
+              FROM account_has_signatory
+              WHERE account_id = $1) ) AS CTE2(count),
+          (SELECT quorum
+          FROM account
+          WHERE account_id = $1) AS CTE3(quorum))";
+
+  /// @return statement without parameters, which returns nothing
+  Statement utilityStatement(std::string query) {
+    return {false, std::move(query), {}, {}, kTextFormat};
+  }
+
+  /// @return statement checking the signatures of the transaction
+  Statement signaturesStatement(
+      const shared_model::interface::Transaction &transaction) {
+    // public keys are hex strings, so they need no quoting in the array
+    std::string keys = "{";
+    for (const auto &signature : transaction.signatures()) {
+      if (keys.size() > 1) {
+        keys += ',';
+      }
+      keys += signature.publicKey().hex();
+    }
+    keys += '}';
+    return {false,
+            kSignaturesQuery,
+            {transaction.creatorAccountId(), std::move(keys)},
+            {kTextFormat, kTextFormat},
+            kTextFormat};
+  }
+
+#ifdef LIBPQ_HAS_PIPELINING
+  /// Queue the statement in the pipeline
+  /// @return 1 if the statement is queued, 0 otherwise
+  int sendStatement(PGconn *conn, const Statement &statement) {
+    ParameterPointers parameters(statement);
+    if (statement.is_prepared) {
+      return PQsendQueryPrepared(conn,
+                                 statement.text.c_str(),
+                                 parameters.values.size(),
+                                 parameters.values.data(),
+                                 parameters.lengths.data(),
+                                 statement.parameter_formats.data(),
+                                 statement.result_format);
+    }
+    return PQsendQueryParams(conn,
+                             statement.text.c_str(),
+                             parameters.values.size(),
+                             nullptr,
+                             parameters.values.data(),
+                             parameters.lengths.data(),
+                             statement.parameter_formats.data(),
+                             statement.result_format);
+  }
+
+  /**
+   * Read the rest of the pipeline up to the synchronization point and leave
+   * the pipeline mode. The connection is reset if it can not leave the
+   * pipeline mode, so that the pooled session is never left in it
+   * @param conn - connection in the pipeline mode
+   * @param is_synced - whether the synchronization point is sent
+   * @return error of the connection, if it had to be reset
+   */
+  boost::optional<std::string> exitPipeline(PGconn *conn, bool is_synced) {
+    // aborted statements are reported with PGRES_PIPELINE_ABORTED followed
+    // by nullptr each, so nullptr does not mean the end of the pipeline
+    while (is_synced and PQstatus(conn) == CONNECTION_OK) {
+      ResultPtr result(PQgetResult(conn), &PQclear);
+      if (result and PQresultStatus(result.get()) == PGRES_PIPELINE_SYNC) {
+        break;
+      }
+    }
+    if (PQexitPipelineMode(conn) == 1) {
+      return boost::none;
+    }
+    std::string error = PQerrorMessage(conn);
+    PQreset(conn);
+    return error;
+  }
+#else
+  /// Execute the statement and wait for its result
+  /// @return result of the statement, nullptr if it was not sent
+  PGresult *executeStatement(PGconn *conn, const Statement &statement) {
+    ParameterPointers parameters(statement);
+    if (statement.is_prepared) {
+      return PQexecPrepared(conn,
+                            statement.text.c_str(),
+                            parameters.values.size(),
+                            parameters.values.data(),
+                            parameters.lengths.data(),
+                            statement.parameter_formats.data(),
+                            statement.result_format);
+    }
+    return PQexecParams(conn,
+                        statement.text.c_str(),
+                        parameters.values.size(),
+                        nullptr,
+                        parameters.values.data(),
+                        parameters.lengths.data(),
+                        statement.parameter_formats.data(),
+                        statement.result_format);
+  }
+#endif
+
+  /**
+   * Execute the statements and collect their results. The statements are
+   * sent in one round trip in the libpq pipeline mode, or one by one if
+   * libpq has no pipeline mode. The parameters are always bound, so nothing
+   * is quoted by the client. Execution stops at the first failed statement,
+   * so the results of the following statements are missing
+   * @param sql - session to execute the statements in
+   * @param statements - statements to execute
+   * @return results of the executed statements, or the connection error
+   */
+  iroha::expected::Result<std::vector<ResultPtr>, std::string> executeBatch(
+      soci::session &sql, const std::vector<Statement> &statements) {
+    auto *conn =
+        static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+            ->conn_;
+    std::vector<ResultPtr> results;
+#ifdef LIBPQ_HAS_PIPELINING
+    if (PQenterPipelineMode(conn) == 0) {
+      return iroha::expected::makeError(std::string(PQerrorMessage(conn)));
+    }
+    auto send_error = [conn](bool is_synced) {
+      std::string error = PQerrorMessage(conn);
+      exitPipeline(conn, is_synced);
+      return iroha::expected::makeError(std::move(error));
+    };
+    for (const auto &statement : statements) {
+      if (sendStatement(conn, statement) == 0) {
+        return send_error(PQpipelineSync(conn) == 1);
+      }
+    }
+    if (PQpipelineSync(conn) == 0) {
+      return send_error(false);
+    }
+
+    // statements after a failed one are aborted by the server
+    bool is_aborted = false;
+    for (size_t i = 0; i < statements.size() and not is_aborted; ++i) {
+      ResultPtr result(PQgetResult(conn), &PQclear);
+      if (not result) {
+        break;
+      }
+      // the result of each statement is terminated with nullptr
+      while (auto *terminator = PQgetResult(conn)) {
+        PQclear(terminator);
+      }
+      auto status = PQresultStatus(result.get());
+      is_aborted = status == PGRES_PIPELINE_ABORTED;
+      if (not is_aborted) {
+        results.push_back(std::move(result));
+      }
+    }
+    if (auto error = exitPipeline(conn, true)) {
+      return iroha::expected::makeError(std::move(*error));
+    }
+#else
+    for (const auto &statement : statements) {
+      ResultPtr result(executeStatement(conn, statement), &PQclear);
+      if (not result) {
+        return iroha::expected::makeError(std::string(PQerrorMessage(conn)));
+      }
+      auto status = PQresultStatus(result.get());
+      results.push_back(std::move(result));
+      if (status != PGRES_COMMAND_OK and status != PGRES_TUPLES_OK) {
+        break;
+      }
+    }
+#endif
+    return iroha::expected::makeValue(std::move(results));
+  }
+
+  /// @return error of a transaction, which failed signatures validation
+  iroha::expected::Error<iroha::validation::CommandError> signaturesError(
+      const shared_model::interface::Transaction &transaction) {
+    auto error_str = "Transaction " + transaction.toString()
+        + " failed signatures validation";
+    // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
+    // with named constant
+    return iroha::expected::makeError(iroha::validation::CommandError{
+        "signatures validation", 2, error_str, false});
+  }
+
+  /// @return error message of the statement, or a note if it was not run
+  std::string resultError(const std::vector<ResultPtr> &results,
+                          size_t index) {
+    return index < results.size() ? PQresultErrorMessage(results[index].get())
+                                  : "statement was not executed";
+  }
+}  // namespace
+
 namespace iroha {
   namespace ametsuchi {
     TemporaryWsvImpl::TemporaryWsvImpl(
-        std::unique_ptr<soci::session> sql,
+        SessionPtr sql,
         std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
+        std::shared_ptr<WsvCache> wsv_cache,
         logger::LoggerManagerTreePtr log_manager)
         : sql_(std::move(sql)),
+          wsv_cache_(std::make_shared<WsvCacheView>(
+              std::move(wsv_cache),
+              *sql_,
+              [this] {
+                auto finalization = takePendingFinalization();
+                if (not finalization.empty()) {
+                  *sql_ << finalization;
+                }
+              },
+              log_manager->getChild("WsvCache")->getLogger())),
           command_executor_(std::make_unique<PostgresCommandExecutor>(
-              *sql_, std::move(perm_converter))),
+              *sql_, std::move(perm_converter), wsv_cache_)),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()) {
       *sql_ << "BEGIN";
+      command_executor_->doValidation(true);
+      command_executor_->deferExecution(true);
+    }
+
+    boost::optional<bool> TemporaryWsvImpl::checkCachedSignatures(
+        const shared_model::interface::Transaction &transaction) {
+      auto signatories =
+          wsv_cache_->getSignatories(transaction.creatorAccountId());
+      if (not signatories) {
+        return boost::none;
+      }
+      size_t signatures_number = 0;
+      for (const auto &signature : transaction.signatures()) {
+        if (signatories->public_keys.count(signature.publicKey().hex()) == 0) {
+          return false;
+        }
+        ++signatures_number;
+      }
+      return signatories->quorum <= signatures_number;
+    }
+
+    std::string TemporaryWsvImpl::takePendingFinalization() {
+      std::string finalization;
+      finalization.swap(pending_finalization_);
+      return finalization;
+    }
+
+    expected::Result<void, validation::CommandError> TemporaryWsvImpl::apply(
+        const shared_model::interface::Transaction &transaction) {
+      // signatures are checked in the database only if the signatories of
+      // the creator are not cached
+      auto cached_signatures = checkCachedSignatures(transaction);
+      if (cached_signatures and not *cached_signatures) {
+        return signaturesError(transaction);
+      }
+      return applyCommands(transaction, not cached_signatures);
     }
 
     expected::Result<void, validation::CommandError>
-    TemporaryWsvImpl::validateSignatures(
+    TemporaryWsvImpl::applyValidated(
         const shared_model::interface::Transaction &transaction) {
-      auto keys_range = transaction.signatures()
-          | boost::adaptors::transformed(
-                            [](const auto &s) { return s.publicKey().hex(); });
-      auto keys = std::accumulate(
-          std::next(std::begin(keys_range)),
-          std::end(keys_range),
-          keys_range.front(),
-          [](auto acc, const auto &val) { return acc + "'), ('" + val; });
-      // not using bool since it is not supported by SOCI
-      boost::optional<uint8_t> signatories_valid;
-
-      boost::format query(R"(SELECT sum(count) = :signatures_count
-                          AND sum(quorum) <= :signatures_count
-                  FROM
-                      (SELECT count(public_key)
-                      FROM ( VALUES ('%s') ) AS CTE1(public_key)
-                      WHERE public_key IN
-                          (SELECT public_key
-                          FROM account_has_signatory
-                          WHERE account_id = :account_id ) ) AS CTE2(count),
-                          (SELECT quorum
-                          FROM account
-                          WHERE account_id = :account_id) AS CTE3(quorum))");
+      command_executor_->doValidation(false);
+      auto result = applyCommands(transaction, false);
+      command_executor_->doValidation(true);
+      return result;
+    }
 
-      try {
-        auto keys_range_size = boost::size(keys_range);
-        *sql_ << (query % keys).str(), soci::into(signatories_valid),
-            soci::use(keys_range_size, "signatures_count"),
-            soci::use(transaction.creatorAccountId(), "account_id");
-      } catch (const std::exception &e) {
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::applyCommands(
+        const shared_model::interface::Transaction &transaction,
+        bool check_signatures) {
+      command_executor_->setCreatorAccountId(transaction.creatorAccountId());
+      for (const auto &command : transaction.commands()) {
+        boost::apply_visitor(*command_executor_, command.get());
+      }
+      auto commands = command_executor_->takeDeferredCommands();
+
+      std::vector<Statement> statements;
+      auto finalization = takePendingFinalization();
+      if (not finalization.empty()) {
+        statements.push_back(utilityStatement(std::move(finalization)));
+      }
+      // index of the savepoint creation result
+      const size_t savepoint_index = statements.size();
+      // index of the signatures check result, if it is in the batch
+      const size_t signatures_index = savepoint_index + 1;
+      statements.push_back(
+          utilityStatement("SAVEPOINT " + kTransactionSavepoint));
+      if (check_signatures) {
+        statements.push_back(signaturesStatement(transaction));
+      }
+      const size_t commands_index = statements.size();
+      for (auto &command : commands) {
+        statements.push_back({true,
+                              command.statement_name,
+                              std::move(command.parameters),
+                              std::move(command.parameter_formats),
+                              kBinaryFormat});
+      }
+
+      auto db_error = [&transaction](const std::string &error) {
         auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation with db error: " + e.what();
+            + " failed signatures validation with db error: " + error;
         // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
         // with named constant
         return expected::makeError(validation::CommandError{
             "signatures validation", 1, error_str, false});
+      };
+
+      std::vector<ResultPtr> results;
+      boost::optional<std::string> send_error;
+      executeBatch(*sql_, statements)
+          .match(
+              [&results](auto &&value) { results = std::move(value.value); },
+              [&send_error](const auto &error) { send_error = error.error; });
+      if (send_error) {
+        return db_error(*send_error);
       }
 
-      if (signatories_valid and *signatories_valid) {
-        return {};
-      } else {
-        auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation";
-        // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
-        // with named constant
-        return expected::makeError(validation::CommandError{
-            "signatures validation", 2, error_str, false});
+      // the savepoint exists since here, unless the query failed before
+      for (size_t i = 0; i <= savepoint_index; ++i) {
+        if (i >= results.size()
+            or PQresultStatus(results[i].get()) != PGRES_COMMAND_OK) {
+          log_->error("Could not create savepoint: {}",
+                      resultError(results, i));
+          return db_error(resultError(results, i));
+        }
       }
-    }
+      pending_finalization_ =
+          "ROLLBACK TO SAVEPOINT " + kTransactionSavepoint + ";";
 
-    expected::Result<void, validation::CommandError> TemporaryWsvImpl::apply(
-        const shared_model::interface::Transaction &transaction) {
-      const auto &tx_creator = transaction.creatorAccountId();
-      command_executor_->setCreatorAccountId(tx_creator);
-      command_executor_->doValidation(true);
-      auto execute_command =
-          [this](auto &command) -> expected::Result<void, CommandError> {
-        // Validate and execute command
-        return boost::apply_visitor(*command_executor_, command.get());
-      };
+      if (check_signatures) {
+        if (signatures_index >= results.size()
+            or PQresultStatus(results[signatures_index].get())
+                != PGRES_TUPLES_OK) {
+          return db_error(resultError(results, signatures_index));
+        }
+        const auto *signatures = results[signatures_index].get();
+        if (PQntuples(signatures) != 1 or PQgetisnull(signatures, 0, 0)
+            or std::string(PQgetvalue(signatures, 0, 0)) != "t") {
+          return signaturesError(transaction);
+        }
+      }
 
-      auto savepoint_wrapper = createSavepoint("savepoint_temp_wsv");
-
-      return validateSignatures(transaction) |
-                 [savepoint = std::move(savepoint_wrapper),
-                  &execute_command,
-                  &transaction]()
-                 -> expected::Result<void, validation::CommandError> {
-        // check transaction's commands validity
-        const auto &commands = transaction.commands();
-        validation::CommandError cmd_error;
-        for (size_t i = 0; i < commands.size(); ++i) {
-          // in case of failed command, rollback and return
-          auto cmd_is_valid =
-              execute_command(commands[i])
-                  .match([](const auto &) { return true; },
-                         [i, &cmd_error](const auto &error) {
-                           cmd_error = {error.error.command_name,
-                                        error.error.error_code,
-                                        error.error.error_extra,
-                                        true,
-                                        i};
-                           return false;
-                         });
-          if (not cmd_is_valid) {
-            return expected::makeError(cmd_error);
-          }
+      // check transaction's commands validity
+      for (size_t i = 0; i < commands.size(); ++i) {
+        const auto result_index = commands_index + i;
+        auto result = result_index < results.size()
+            ? results[result_index].get()
+            : nullptr;
+        auto cmd_error =
+            PostgresCommandExecutor::getDeferredCommandResult(
+                std::move(commands[i]), result)
+                .match([](const auto &)
+                           -> boost::optional<validation::CommandError> {
+                         return boost::none;
+                       },
+                       [i](const auto &error) {
+                         return boost::make_optional(validation::CommandError{
+                             error.error.command_name,
+                             error.error.error_code,
+                             error.error.error_extra,
+                             true,
+                             i});
+                       });
+        // in case of failed command, rollback and return
+        if (cmd_error) {
+          return expected::makeError(std::move(*cmd_error));
         }
-        // success
-        savepoint->release();
-        return {};
-      };
+      }
+      // success
+      pending_finalization_ =
+          "RELEASE SAVEPOINT " + kTransactionSavepoint + ";";
+      return {};
     }
 
     std::unique_ptr<TemporaryWsv::SavepointWrapper>
@@ -145,14 +453,15 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::SavepointWrapperImpl::SavepointWrapperImpl(
-        const iroha::ametsuchi::TemporaryWsvImpl &wsv,
+        TemporaryWsvImpl &wsv,
         std::string savepoint_name,
         logger::LoggerPtr log)
-        : sql_{*wsv.sql_},
+        : wsv_{wsv},
           savepoint_name_{std::move(savepoint_name)},
           is_released_{false},
           log_(std::move(log)) {
-      sql_ << "SAVEPOINT " + savepoint_name_ + ";";
+      *wsv_.sql_ << wsv_.takePendingFinalization() + "SAVEPOINT "
+              + savepoint_name_ + ";";
     }
 
     void TemporaryWsvImpl::SavepointWrapperImpl::release() {
@@ -162,9 +471,11 @@ namespace iroha {
     TemporaryWsvImpl::SavepointWrapperImpl::~SavepointWrapperImpl() {
       try {
         if (not is_released_) {
-          sql_ << "ROLLBACK TO SAVEPOINT " + savepoint_name_ + ";";
+          *wsv_.sql_ << wsv_.takePendingFinalization()
+                  + "ROLLBACK TO SAVEPOINT " + savepoint_name_ + ";";
         } else {
-          sql_ << "RELEASE SAVEPOINT " + savepoint_name_ + ";";
+          *wsv_.sql_ << wsv_.takePendingFinalization() + "RELEASE SAVEPOINT "
+                  + savepoint_name_ + ";";
         }
       } catch (std::exception &e) {
         log_->error("SQL error. Reason: {}", e.what());
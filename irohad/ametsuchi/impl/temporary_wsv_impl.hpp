@@ -8,6 +8,8 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <functional>
+
 #include <soci/soci.h>
 #include "ametsuchi/command_executor.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
@@ -23,12 +25,27 @@ namespace shared_model {
 namespace iroha {
 
   namespace ametsuchi {
+    class PostgresCommandExecutor;
+    class WsvCache;
+    class WsvCacheView;
+
+    /**
+     * Temporary WSV, which applies each transaction in one round trip to the
+     * database: the transaction savepoint, the signatures check and all the
+     * commands are sent in one libpq pipeline with bound parameters. The
+     * savepoint is released or rolled back by the statements of the next
+     * transaction, or before any other statement is executed in the session
+     */
     class TemporaryWsvImpl : public TemporaryWsv {
       friend class StorageImpl;
 
      public:
+      /// Session of the WSV, the deleter may return it to its pool instead
+      using SessionPtr =
+          std::unique_ptr<soci::session, std::function<void(soci::session *)>>;
+
       struct SavepointWrapperImpl : public TemporaryWsv::SavepointWrapper {
-        SavepointWrapperImpl(const TemporaryWsvImpl &wsv,
+        SavepointWrapperImpl(TemporaryWsvImpl &wsv,
                              std::string savepoint_name,
                              logger::LoggerPtr log);
 
@@ -37,23 +54,27 @@ namespace iroha {
         ~SavepointWrapperImpl() override;
 
        private:
-        soci::session &sql_;
+        TemporaryWsvImpl &wsv_;
         std::string savepoint_name_;
         bool is_released_;
         logger::LoggerPtr log_;
       };
 
       TemporaryWsvImpl(
-          std::unique_ptr<soci::session> sql,
+          SessionPtr sql,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
               factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
+          std::shared_ptr<WsvCache> wsv_cache,
           logger::LoggerManagerTreePtr log_manager);
 
       expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) override;
 
+      expected::Result<void, validation::CommandError> applyValidated(
+          const shared_model::interface::Transaction &transaction) override;
+
       std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
           const std::string &name) override;
 
@@ -61,14 +82,34 @@ namespace iroha {
 
      private:
       /**
-       * Verifies whether transaction has at least quorum signatures and they
-       * are a subset of creator account signatories
+       * Check transaction signatures against the cached signatories of the
+       * creator account
+       * @return check result, none if the signatories are not cached
        */
-      expected::Result<void, validation::CommandError> validateSignatures(
+      boost::optional<bool> checkCachedSignatures(
           const shared_model::interface::Transaction &transaction);
 
-      std::unique_ptr<soci::session> sql_;
-      std::unique_ptr<CommandExecutor> command_executor_;
+      /**
+       * Apply transaction commands in one round trip
+       * @param check_signatures - whether the signatures check is sent along
+       * with the commands
+       */
+      expected::Result<void, validation::CommandError> applyCommands(
+          const shared_model::interface::Transaction &transaction,
+          bool check_signatures);
+
+      /**
+       * Take the statement finishing the savepoint of the last applied
+       * transaction. It must be executed before any other statement in the
+       * session
+       * @return statement, or empty string if there is nothing to finish
+       */
+      std::string takePendingFinalization();
+
+      SessionPtr sql_;
+      std::shared_ptr<WsvCacheView> wsv_cache_;
+      std::unique_ptr<PostgresCommandExecutor> command_executor_;
+      std::string pending_finalization_;
 
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
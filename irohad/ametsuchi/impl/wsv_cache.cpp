@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+namespace {
+  /// @return value stored under the key, or none
+  template <typename Map, typename Key>
+  boost::optional<typename Map::mapped_type> find(const Map &map,
+                                                  const Key &key) {
+    auto it = map.find(key);
+    if (it == map.end()) {
+      return boost::none;
+    }
+    return it->second;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    using shared_model::interface::GrantablePermissionSet;
+    using shared_model::interface::RolePermissionSet;
+    using shared_model::interface::types::AccountIdType;
+
+    WsvCache::Generation WsvCache::generation() const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return generation_;
+    }
+
+    boost::optional<RolePermissionSet> WsvCache::getAccountPermissions(
+        const AccountIdType &account_id) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return find(account_permissions_, account_id);
+    }
+
+    void WsvCache::putAccountPermissions(const AccountIdType &account_id,
+                                         const RolePermissionSet &permissions,
+                                         Generation generation) {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      if (generation == generation_) {
+        account_permissions_[account_id] = permissions;
+      }
+    }
+
+    boost::optional<GrantablePermissionSet> WsvCache::getGrantablePermissions(
+        const AccountIdType &permittee_id,
+        const AccountIdType &account_id) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return find(grantable_permissions_,
+                  std::make_pair(permittee_id, account_id));
+    }
+
+    void WsvCache::putGrantablePermissions(
+        const AccountIdType &permittee_id,
+        const AccountIdType &account_id,
+        const GrantablePermissionSet &permissions,
+        Generation generation) {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      if (generation == generation_) {
+        grantable_permissions_[std::make_pair(permittee_id, account_id)] =
+            permissions;
+      }
+    }
+
+    boost::optional<WsvCache::Signatories> WsvCache::getSignatories(
+        const AccountIdType &account_id) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return find(signatories_, account_id);
+    }
+
+    void WsvCache::putSignatories(const AccountIdType &account_id,
+                                  Signatories signatories,
+                                  Generation generation) {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      if (generation == generation_) {
+        signatories_[account_id] = std::move(signatories);
+      }
+    }
+
+    void WsvCache::invalidate() {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      ++generation_;
+      account_permissions_.clear();
+      grantable_permissions_.clear();
+      signatories_.clear();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
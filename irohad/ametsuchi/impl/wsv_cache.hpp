@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_CACHE_HPP
+#define IROHA_WSV_CACHE_HPP
+
+#include <map>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/permissions.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * In-process cache of the committed WSV data, which is read by stateful
+     * validation of every transaction: effective permissions of accounts,
+     * grantable permissions and signatories. Entries are loaded on demand
+     * and all of them are dropped when a block is committed.
+     *
+     * Each invalidation starts a new generation. An entry loaded from the
+     * database is only stored if no invalidation happened since the
+     * generation was read, so the cache never keeps the data loaded before
+     * a commit.
+     */
+    class WsvCache {
+     public:
+      using Generation = uint64_t;
+
+      /// Quorum and signatories of an account
+      struct Signatories {
+        shared_model::interface::types::QuorumType quorum;
+        /// public keys in hex
+        std::unordered_set<std::string> public_keys;
+      };
+
+      /// @return current generation, which must be read before loading data
+      Generation generation() const;
+
+      /**
+       * @return union of permissions of all account roles, none if it is not
+       * cached
+       */
+      boost::optional<shared_model::interface::RolePermissionSet>
+      getAccountPermissions(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      /**
+       * Store account permissions
+       * @param generation - generation read before the permissions were
+       * loaded
+       */
+      void putAccountPermissions(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::RolePermissionSet &permissions,
+          Generation generation);
+
+      /**
+       * @return permissions granted by account to permittee, none if they are
+       * not cached
+       */
+      boost::optional<shared_model::interface::GrantablePermissionSet>
+      getGrantablePermissions(
+          const shared_model::interface::types::AccountIdType &permittee_id,
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      /**
+       * Store permissions granted by account to permittee
+       * @param generation - generation read before the permissions were
+       * loaded
+       */
+      void putGrantablePermissions(
+          const shared_model::interface::types::AccountIdType &permittee_id,
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::GrantablePermissionSet &permissions,
+          Generation generation);
+
+      /// @return account signatories, none if they are not cached
+      boost::optional<Signatories> getSignatories(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      /**
+       * Store account signatories
+       * @param generation - generation read before the signatories were
+       * loaded
+       */
+      void putSignatories(
+          const shared_model::interface::types::AccountIdType &account_id,
+          Signatories signatories,
+          Generation generation);
+
+      /**
+       * Drop all entries and start a new generation. Must be called after
+       * the changes of WSV are committed to the database
+       */
+      void invalidate();
+
+     private:
+      mutable std::shared_timed_mutex mutex_;
+      Generation generation_ = 0;
+
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         shared_model::interface::RolePermissionSet>
+          account_permissions_;
+      std::map<std::pair<shared_model::interface::types::AccountIdType,
+                         shared_model::interface::types::AccountIdType>,
+               shared_model::interface::GrantablePermissionSet>
+          grantable_permissions_;
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         Signatories>
+          signatories_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_CACHE_HPP
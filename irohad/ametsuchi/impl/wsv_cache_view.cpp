@@ -0,0 +1,170 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache_view.hpp"
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    using shared_model::interface::GrantablePermissionSet;
+    using shared_model::interface::RolePermissionSet;
+    using shared_model::interface::types::AccountIdType;
+
+    WsvCacheView::WsvCacheView(std::shared_ptr<WsvCache> cache,
+                               soci::session &sql,
+                               std::function<void()> prepare_session,
+                               logger::LoggerPtr log)
+        : cache_(std::move(cache)),
+          sql_(sql),
+          prepare_session_(std::move(prepare_session)),
+          log_(std::move(log)) {}
+
+    bool WsvCacheView::hasAccountPermission(
+        const AccountIdType &account_id,
+        shared_model::interface::permissions::Role permission) {
+      auto permissions = getAccountPermissions(account_id);
+      return permissions and permissions->test(permission);
+    }
+
+    bool WsvCacheView::hasAccountPermissions(
+        const AccountIdType &account_id,
+        const RolePermissionSet &permissions) {
+      auto account_permissions = getAccountPermissions(account_id);
+      return account_permissions
+          and permissions.isSubsetOf(*account_permissions);
+    }
+
+    bool WsvCacheView::hasGrantablePermission(
+        const AccountIdType &permittee_id,
+        const AccountIdType &account_id,
+        shared_model::interface::permissions::Grantable permission) {
+      auto permissions = getGrantablePermissions(permittee_id, account_id);
+      return permissions and permissions->test(permission);
+    }
+
+    boost::optional<RolePermissionSet> WsvCacheView::getAccountPermissions(
+        const AccountIdType &account_id) {
+      if (changed_account_permissions_.count(account_id) > 0) {
+        return boost::none;
+      }
+      if (auto permissions = cache_->getAccountPermissions(account_id)) {
+        return permissions;
+      }
+
+      auto generation = cache_->generation();
+      try {
+        prepare_session_();
+        std::string bits;
+        sql_ << "SELECT COALESCE(bit_or(rp.permission), '0'::bit("
+                + std::to_string(RolePermissionSet::size())
+                + ")) FROM role_has_permissions AS rp "
+                  "JOIN account_has_roles AS ar ON ar.role_id = rp.role_id "
+                  "WHERE ar.account_id = :account_id",
+            soci::into(bits), soci::use(account_id);
+        RolePermissionSet permissions{bits};
+        cache_->putAccountPermissions(account_id, permissions, generation);
+        return permissions;
+      } catch (const std::exception &e) {
+        log_->error("Failed to load permissions of {}: {}",
+                    account_id,
+                    e.what());
+        return boost::none;
+      }
+    }
+
+    boost::optional<GrantablePermissionSet>
+    WsvCacheView::getGrantablePermissions(const AccountIdType &permittee_id,
+                                          const AccountIdType &account_id) {
+      if (changed_grantable_permissions_.count(
+              std::make_pair(permittee_id, account_id))
+          > 0) {
+        return boost::none;
+      }
+      if (auto permissions =
+              cache_->getGrantablePermissions(permittee_id, account_id)) {
+        return permissions;
+      }
+
+      auto generation = cache_->generation();
+      try {
+        prepare_session_();
+        std::string bits;
+        sql_ << "SELECT COALESCE(bit_or(permission), '0'::bit("
+                + std::to_string(GrantablePermissionSet::size())
+                + ")) FROM account_has_grantable_permissions "
+                  "WHERE permittee_account_id = :permittee_id "
+                  "AND account_id = :account_id",
+            soci::into(bits), soci::use(permittee_id, "permittee_id"),
+            soci::use(account_id, "account_id");
+        GrantablePermissionSet permissions{bits};
+        cache_->putGrantablePermissions(
+            permittee_id, account_id, permissions, generation);
+        return permissions;
+      } catch (const std::exception &e) {
+        log_->error("Failed to load permissions granted by {} to {}: {}",
+                    account_id,
+                    permittee_id,
+                    e.what());
+        return boost::none;
+      }
+    }
+
+    boost::optional<WsvCache::Signatories> WsvCacheView::getSignatories(
+        const AccountIdType &account_id) {
+      if (changed_signatories_.count(account_id) > 0) {
+        return boost::none;
+      }
+      if (auto signatories = cache_->getSignatories(account_id)) {
+        return signatories;
+      }
+
+      auto generation = cache_->generation();
+      try {
+        prepare_session_();
+        boost::optional<int> quorum;
+        sql_ << "SELECT quorum FROM account WHERE account_id = :account_id",
+            soci::into(quorum), soci::use(account_id);
+        if (not quorum) {
+          // the account may still be created
+          return boost::none;
+        }
+
+        WsvCache::Signatories signatories{
+            static_cast<shared_model::interface::types::QuorumType>(*quorum),
+            {}};
+        soci::rowset<std::string> public_keys =
+            (sql_.prepare << "SELECT public_key FROM account_has_signatory "
+                             "WHERE account_id = :account_id",
+             soci::use(account_id));
+        signatories.public_keys.insert(public_keys.begin(), public_keys.end());
+
+        cache_->putSignatories(account_id, signatories, generation);
+        return signatories;
+      } catch (const std::exception &e) {
+        log_->error("Failed to load signatories of {}: {}",
+                    account_id,
+                    e.what());
+        return boost::none;
+      }
+    }
+
+    void WsvCacheView::invalidateAccountPermissions(
+        const AccountIdType &account_id) {
+      changed_account_permissions_.insert(account_id);
+    }
+
+    void WsvCacheView::invalidateGrantablePermissions(
+        const AccountIdType &permittee_id, const AccountIdType &account_id) {
+      changed_grantable_permissions_.emplace(permittee_id, account_id);
+    }
+
+    void WsvCacheView::invalidateSignatories(const AccountIdType &account_id) {
+      changed_signatories_.insert(account_id);
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_CACHE_VIEW_HPP
+#define IROHA_WSV_CACHE_VIEW_HPP
+
+#include <functional>
+#include <memory>
+#include <set>
+
+#include <soci/soci.h>
+#include "ametsuchi/impl/wsv_cache.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * View of WsvCache from a database session with uncommitted changes.
+     * Missing entries are loaded through the session. Entries, which could
+     * have been changed in the session, are invalidated by the owner of the
+     * session and are never answered from the cache afterwards, neither are
+     * they loaded into it. An invalidated entry stays invalid even if the
+     * change is rolled back, which only costs a database lookup.
+     *
+     * The checks answer true only if the permission is known to be present,
+     * so a false answer means that the database has to be asked.
+     */
+    class WsvCacheView {
+     public:
+      /**
+       * @param cache - shared cache of the committed data
+       * @param sql - session to load missing entries
+       * @param prepare_session - called before an entry is loaded, so that
+       * the statements pending in the session can be executed first
+       * @param log - logger
+       */
+      WsvCacheView(std::shared_ptr<WsvCache> cache,
+                   soci::session &sql,
+                   std::function<void()> prepare_session,
+                   logger::LoggerPtr log);
+
+      /// @return true if the account is known to have the role permission
+      bool hasAccountPermission(
+          const shared_model::interface::types::AccountIdType &account_id,
+          shared_model::interface::permissions::Role permission);
+
+      /// @return true if the account is known to have all role permissions
+      bool hasAccountPermissions(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::RolePermissionSet &permissions);
+
+      /**
+       * @return true if the permission is known to be granted by account to
+       * permittee
+       */
+      bool hasGrantablePermission(
+          const shared_model::interface::types::AccountIdType &permittee_id,
+          const shared_model::interface::types::AccountIdType &account_id,
+          shared_model::interface::permissions::Grantable permission);
+
+      /// @return account signatories, none if they are not known
+      boost::optional<WsvCache::Signatories> getSignatories(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /// Mark role permissions of the account as changed in the session
+      void invalidateAccountPermissions(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /// Mark permissions granted by account to permittee as changed
+      void invalidateGrantablePermissions(
+          const shared_model::interface::types::AccountIdType &permittee_id,
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /// Mark quorum and signatories of the account as changed
+      void invalidateSignatories(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+     private:
+      boost::optional<shared_model::interface::RolePermissionSet>
+      getAccountPermissions(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      boost::optional<shared_model::interface::GrantablePermissionSet>
+      getGrantablePermissions(
+          const shared_model::interface::types::AccountIdType &permittee_id,
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      std::shared_ptr<WsvCache> cache_;
+      soci::session &sql_;
+      std::function<void()> prepare_session_;
+
+      std::set<shared_model::interface::types::AccountIdType>
+          changed_account_permissions_;
+      std::set<std::pair<shared_model::interface::types::AccountIdType,
+                         shared_model::interface::types::AccountIdType>>
+          changed_grantable_permissions_;
+      std::set<shared_model::interface::types::AccountIdType>
+          changed_signatories_;
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_CACHE_VIEW_HPP
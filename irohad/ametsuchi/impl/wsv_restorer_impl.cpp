@@ -5,14 +5,33 @@
 
 #include "wsv_restorer_impl.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/block_storage.hpp"
 #include "ametsuchi/block_storage_factory.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/storage.hpp"
+#include "ametsuchi/wsv_snapshot_storage.hpp"
+#include "common/ordered_pipeline.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+using shared_model::interface::Block;
+using shared_model::interface::types::HashType;
+using shared_model::interface::types::HeightType;
 
 namespace {
+  // number of threads decoding the stored blocks
+  const size_t kDecodingWorkers =
+      std::max(1u, std::thread::hardware_concurrency());
+  // maximum number of decoded blocks waiting to be applied
+  const size_t kMaxBlocksAhead = 4 * kDecodingWorkers;
+  // number of applied blocks between two progress reports
+  const HeightType kProgressReportPeriod = 1000;
+
   /**
    * Stub implementation used to restore WSV. Check the method descriptions for
    * details
@@ -61,34 +80,174 @@ namespace {
   };
 
   /**
-   * Reapply blocks from existing storage to WSV
+   * Load the latest WSV snapshot which matches the local block storage
+   * @param storage - current storage
+   * @param block_query - current block storage
+   * @param log - logger
+   * @return height and block hash of the loaded snapshot or boost::none if
+   * there is no usable snapshot
+   */
+  boost::optional<std::pair<HeightType, HashType>> loadLatestSnapshot(
+      iroha::ametsuchi::Storage &storage,
+      iroha::ametsuchi::BlockQuery &block_query,
+      const logger::LoggerPtr &log) {
+    auto snapshots = storage.getWsvSnapshotStorage();
+    if (not snapshots) {
+      return boost::none;
+    }
+
+    auto max_height = block_query.getTopBlockHeight();
+    while (auto height = snapshots->lastHeight(max_height)) {
+      auto snapshot = snapshots->get(*height);
+      auto loaded = snapshot
+          and (iroha::ametsuchi::checkWsvSnapshot(*snapshot, block_query) |
+               [&] { return storage.loadWsvSnapshot(*snapshot); })
+                  .match([](const auto &) { return true; },
+                         [&log, &height](const auto &error) {
+                           log->warn("Skipping WSV snapshot at height {}: {}",
+                                     *height,
+                                     error.error);
+                           return false;
+                         });
+      if (loaded) {
+        log->info("Loaded WSV snapshot at height {}", *height);
+        return std::make_pair(*height, snapshot->block_hash);
+      }
+      if (*height == 0) {
+        break;
+      }
+      max_height = *height - 1;
+    }
+    return boost::none;
+  }
+
+  /**
+   * Reapply blocks from existing storage to WSV.
+   *
+   * Blocks are read ahead of the writer, decoded and checked on a pool of
+   * workers and applied in one transaction without a savepoint per block
    * @param storage - current storage
    * @param mutable_storage - mutable storage without blocks
    * @param block_query - current block storage
+   * @param converter - converter of the stored blocks
+   * @param start_height - height of the first block to apply
+   * @param start_prev_hash - hash, which the first block must refer to, none
+   * if the blocks are applied from the genesis
+   * @param log - logger for the progress reports
    */
   iroha::expected::Result<boost::optional<std::unique_ptr<iroha::LedgerState>>,
                           std::string>
   reindexBlocks(
       iroha::ametsuchi::Storage &storage,
       std::unique_ptr<iroha::ametsuchi::MutableStorage> &mutable_storage,
-      std::shared_ptr<iroha::ametsuchi::BlockQuery> &block_query) {
-    // apply all blocks starting from the genesis
-    auto top_height = block_query->getTopBlockHeight();
-    for (decltype(top_height) i = 1; i <= top_height; ++i) {
-      auto block_result = block_query->getBlock(i);
-      auto result = block_result | [&mutable_storage](auto &&block)
-          -> iroha::expected::Result<void, std::string> {
-        if (not mutable_storage->apply(std::move(block))) {
-          return iroha::expected::makeError("Cannot apply "
-                                            + block->toString());
-        }
-        return iroha::expected::Value<void>();
-      };
+      iroha::ametsuchi::BlockQuery &block_query,
+      const shared_model::interface::BlockJsonConverter &converter,
+      HeightType start_height,
+      boost::optional<HashType> start_prev_hash,
+      const logger::LoggerPtr &log) {
+    using BlockResult =
+        iroha::expected::Result<std::shared_ptr<Block>, std::string>;
 
-      if (auto e = boost::get<iroha::expected::Error<std::string>>(&result)) {
-        return *e;
-      }
+    const auto top_height = block_query.getTopBlockHeight();
+    const auto blocks_number =
+        top_height >= start_height ? top_height - start_height + 1 : 0;
+    log->info("Restoring WSV from blocks {} to {}", start_height, top_height);
+
+    const auto started = std::chrono::steady_clock::now();
+    auto report_progress = [&](HeightType applied) {
+      std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - started;
+      log->info("Applied {} of {} blocks in {:.1f} s, {:.1f} blocks/s",
+                applied,
+                blocks_number,
+                elapsed.count(),
+                applied / std::max(elapsed.count(), 1e-3));
+    };
+
+    // errors are kept separately, since the blocks are read inside the
+    // observable
+    boost::optional<std::string> read_error, error;
+    HeightType applied = 0;
+    auto blocks = rxcpp::observable<>::create<std::shared_ptr<Block>>(
+        [&](auto subscriber) {
+          auto next_height = start_height;
+          auto prev_hash = start_prev_hash;
+          // the pool is started once for all the blocks of the restore
+          iroha::ThreadPool decoding_pool(kDecodingWorkers);
+          iroha::runOrderedPipeline<std::pair<HeightType, std::string>>(
+              // read the serialized blocks one by one
+              [&]() -> boost::optional<std::pair<HeightType, std::string>> {
+                if (next_height > top_height) {
+                  return boost::none;
+                }
+                auto height = next_height++;
+                return block_query.getSerializedBlock(height).match(
+                    [height](auto &&json) {
+                      return boost::make_optional(
+                          std::make_pair(height, std::move(json.value)));
+                    },
+                    [&read_error](const auto &e) {
+                      read_error = e.error;
+                      return boost::optional<
+                          std::pair<HeightType, std::string>>{};
+                    });
+              },
+              // decode them in parallel
+              [&converter](std::pair<HeightType, std::string> item)
+                  -> BlockResult {
+                return converter.deserialize(item.second)
+                    .match(
+                        [&item](auto &&block) -> BlockResult {
+                          auto height = block.value->height();
+                          if (height != item.first) {
+                            return iroha::expected::makeError(
+                                "Block stored at height "
+                                + std::to_string(item.first) + " has height "
+                                + std::to_string(height));
+                          }
+                          return iroha::expected::makeValue(
+                              std::shared_ptr<Block>(std::move(block.value)));
+                        },
+                        [](const auto &e) -> BlockResult { return e; });
+              },
+              // and apply them in order
+              [&](BlockResult result) {
+                return std::move(result).match(
+                    [&](auto &&block) {
+                      if (prev_hash and block.value->prevHash() != *prev_hash) {
+                        error = "Block " + block.value->hash().hex()
+                            + " does not follow the previous block";
+                        return false;
+                      }
+                      prev_hash = block.value->hash();
+                      subscriber.on_next(std::move(block.value));
+                      if (++applied % kProgressReportPeriod == 0) {
+                        report_progress(applied);
+                      }
+                      return subscriber.is_subscribed();
+                    },
+                    [&error](const auto &e) {
+                      error = e.error;
+                      return false;
+                    });
+              },
+              decoding_pool,
+              kMaxBlocksAhead);
+          subscriber.on_completed();
+        });
+
+    // a single savepoint covers all the blocks
+    auto is_applied = mutable_storage->apply(
+        blocks, [](const auto &, auto &, const auto &) { return true; });
+    if (error or read_error) {
+      return iroha::expected::makeError(error ? *error : *read_error);
+    }
+    if (not is_applied or applied != blocks_number) {
+      return iroha::expected::makeError(
+          "Cannot apply blocks " + std::to_string(start_height) + " to "
+          + std::to_string(top_height));
     }
+    report_progress(blocks_number);
 
     return iroha::expected::makeValue(
         storage.commit(std::move(mutable_storage)));
@@ -97,6 +256,12 @@ namespace {
 
 namespace iroha {
   namespace ametsuchi {
+    WsvRestorerImpl::WsvRestorerImpl(
+        std::shared_ptr<shared_model::interface::BlockJsonConverter>
+            converter,
+        logger::LoggerPtr log)
+        : converter_(std::move(converter)), log_(std::move(log)) {}
+
     iroha::expected::Result<
         boost::optional<std::unique_ptr<iroha::LedgerState>>,
         std::string>
@@ -105,7 +270,7 @@ namespace iroha {
 
       auto mutable_storage_result =
           storage.createMutableStorage(storage_factory);
-      return mutable_storage_result | [&storage](auto &&mutable_storage)
+      return mutable_storage_result | [this, &storage](auto &&mutable_storage)
                  -> iroha::expected::Result<
                      boost::optional<std::unique_ptr<iroha::LedgerState>>,
                      std::string> {
@@ -114,10 +279,27 @@ namespace iroha {
           return expected::makeError("Cannot create BlockQuery");
         }
 
-        return storage.resetWsv() |
-            [&storage, &mutable_storage, &block_query]() {
-              return reindexBlocks(storage, mutable_storage, block_query);
-            };
+        // a snapshot saves replaying the blocks it already includes
+        if (auto snapshot = loadLatestSnapshot(storage, *block_query, log_)) {
+          return reindexBlocks(storage,
+                               mutable_storage,
+                               *block_query,
+                               *converter_,
+                               snapshot->first + 1,
+                               snapshot->second,
+                               log_);
+        }
+
+        // apply all blocks starting from the genesis
+        return storage.resetWsv() | [&] {
+          return reindexBlocks(storage,
+                               mutable_storage,
+                               *block_query,
+                               *converter_,
+                               1,
+                               boost::none,
+                               log_);
+        };
       };
     }
   }  // namespace ametsuchi
@@ -9,6 +9,8 @@
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/wsv_restorer.hpp"
 #include "common/result.hpp"
+#include "interfaces/iroha_internal/block_json_converter.hpp"
+#include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -19,10 +21,20 @@ namespace iroha {
      */
     class WsvRestorerImpl : public WsvRestorer {
      public:
+      /**
+       * @param converter - converter of the blocks kept in block storage
+       * @param log - logger
+       */
+      WsvRestorerImpl(
+          std::shared_ptr<shared_model::interface::BlockJsonConverter>
+              converter,
+          logger::LoggerPtr log);
+
       virtual ~WsvRestorerImpl() = default;
       /**
        * Recover WSV (World State View).
-       * Drop storage and apply blocks one by one.
+       * Load the latest valid snapshot, or drop storage if there is none, and
+       * apply the remaining blocks, decoding them in parallel.
        * @param storage of blocks in ledger
        * @return ledger state after restoration on success, otherwise error
        * string
@@ -31,6 +43,10 @@ namespace iroha {
           boost::optional<std::unique_ptr<iroha::LedgerState>>,
           std::string>
       restoreWsv(Storage &storage) override;
+
+     private:
+      std::shared_ptr<shared_model::interface::BlockJsonConverter> converter_;
+      logger::LoggerPtr log_;
     };
 
   }  // namespace ametsuchi
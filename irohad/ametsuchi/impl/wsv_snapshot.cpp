@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/wsv_snapshot.hpp"
+
+#include "ametsuchi/block_query.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace {
+  /**
+   * Check that the blocks replayed on top of the snapshot continue its
+   * chain, i.e. the next stored block, if any, refers to the snapshot block
+   */
+  iroha::expected::Result<void, std::string> checkNextBlock(
+      const iroha::ametsuchi::WsvSnapshot &snapshot,
+      iroha::ametsuchi::BlockQuery &block_query) {
+    if (snapshot.height >= block_query.getTopBlockHeight()) {
+      return iroha::expected::Value<void>();
+    }
+    return block_query.getBlock(snapshot.height + 1) |
+        [&snapshot](const auto &block)
+               -> iroha::expected::Result<void, std::string> {
+      if (block->prevHash() != snapshot.block_hash) {
+        return iroha::expected::makeError(
+            "Block at height " + std::to_string(block->height())
+            + " follows block " + block->prevHash().hex()
+            + " instead of the snapshot block " + snapshot.block_hash.hex());
+      }
+      return iroha::expected::Value<void>();
+    };
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    expected::Result<void, std::string> checkWsvSnapshot(
+        const WsvSnapshot &snapshot,
+        const shared_model::interface::Block &block) {
+      if (block.height() != snapshot.height
+          or block.hash() != snapshot.block_hash) {
+        return expected::makeError(
+            "Snapshot was taken on top of block " + snapshot.block_hash.hex()
+            + " at height " + std::to_string(snapshot.height)
+            + ", while the trusted block at height "
+            + std::to_string(block.height()) + " is " + block.hash().hex());
+      }
+      if (makeWsvSnapshotHash(snapshot.data) != snapshot.data_hash) {
+        return expected::makeError("Snapshot data does not match its hash "
+                                   + snapshot.data_hash.hex());
+      }
+      return expected::Value<void>();
+    }
+
+    expected::Result<void, std::string> checkWsvSnapshot(
+        const WsvSnapshot &snapshot, BlockQuery &block_query) {
+      return block_query.getBlock(snapshot.height) |
+          [&](const auto &block) {
+            return checkWsvSnapshot(snapshot, *block) |
+                [&] { return checkNextBlock(snapshot, block_query); };
+          };
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,30 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_OPTIONS_HPP
+#define IROHA_WSV_SNAPSHOT_OPTIONS_HPP
+
+#include <cstddef>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Local WSV snapshots of the storage, which let the node restart from the
+     * latest snapshot instead of replaying all the blocks
+     */
+    struct WsvSnapshotOptions {
+      /// minimal number of blocks between two consecutive snapshots, 0
+      /// disables the snapshots
+      size_t period = 10000;
+      /// number of the latest snapshots kept on disk, the older ones are
+      /// removed after a new snapshot is stored
+      size_t kept = 2;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_OPTIONS_HPP
@@ -8,6 +8,9 @@
 
 #include <memory>
 
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+
 namespace shared_model {
   namespace interface {
     class Query;
@@ -35,6 +38,23 @@ namespace iroha {
           const shared_model::interface::Query &query,
           const bool validate_signatories) = 0;
 
+      /**
+       * Execute and validate query, reading the page of a transaction query
+       * from the given transaction instead of the one in the query. It lets
+       * the pages be walked by the next transaction hashes of the previous
+       * pages with a new executor for each page
+       * @param query to validate and execute
+       * @param validate_signatories - if signatories should be validated
+       * @param first_tx_hash - first transaction of the page, none to use the
+       * pagination meta of the query
+       * @return pointer to query response
+       */
+      virtual QueryExecutorResult validateAndExecutePage(
+          const shared_model::interface::Query &query,
+          const bool validate_signatories,
+          const boost::optional<shared_model::interface::types::HashType>
+              &first_tx_hash) = 0;
+
       /**
        * Perform BlocksQuery validation
        * @param query to validate
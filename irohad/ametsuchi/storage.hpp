@@ -29,6 +29,8 @@ namespace iroha {
     class BlockStorageFactory;
     class BlockQuery;
     class WsvQuery;
+    class WsvSnapshotStorage;
+    struct WsvSnapshot;
 
     /**
      * Storage interface, which allows queries on current committed state, and
@@ -44,6 +46,12 @@ namespace iroha {
 
       virtual std::shared_ptr<BlockQuery> getBlockQuery() const = 0;
 
+      /**
+       * @return storage of the world state view snapshots
+       */
+      virtual std::shared_ptr<WsvSnapshotStorage> getWsvSnapshotStorage()
+          const = 0;
+
       /**
        * Raw insertion of blocks without validation
        * @param block - block for insertion
@@ -88,6 +96,15 @@ namespace iroha {
        */
       virtual expected::Result<void, std::string> resetWsv() = 0;
 
+      /**
+       * Replace all records in the tables with the content of the snapshot.
+       * The snapshot must be checked against the block storage beforehand
+       * @param snapshot - snapshot to load
+       * @return error message if the snapshot has not been loaded
+       */
+      virtual expected::Result<void, std::string> loadWsvSnapshot(
+          const WsvSnapshot &snapshot) = 0;
+
       /**
        * Removes all peers from WSV
        */
@@ -6,6 +6,7 @@
 #ifndef IROHA_TEMPORARY_FACTORY_HPP
 #define IROHA_TEMPORARY_FACTORY_HPP
 
+#include <chrono>
 #include <memory>
 #include "common/result.hpp"
 
@@ -26,6 +27,16 @@ namespace iroha {
       virtual expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() = 0;
 
+      /**
+       * Creates a temporary world state view like createTemporaryWsv(), but
+       * does not wait for a free database session longer than given
+       * @param max_wait - maximum time to wait for a session
+       * @return Created Result with temporary wsv or string error, also if
+       * no session got free in time
+       */
+      virtual expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+      createTemporaryWsv(std::chrono::milliseconds max_wait) = 0;
+
       /**
        * Prepare state which was accumulated in temporary WSV.
        * After preparation, this state is not visible until commited.
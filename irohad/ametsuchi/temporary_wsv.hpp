@@ -47,6 +47,15 @@ namespace iroha {
       virtual expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) = 0;
 
+      /**
+       * Applies a transaction, which has already passed stateful validation
+       * against the same state, without checking signatures and permissions
+       * @param transaction Transaction to be applied
+       * @return error if the commands could not be executed
+       */
+      virtual expected::Result<void, validation::CommandError> applyValidated(
+          const shared_model::interface::Transaction &transaction) = 0;
+
       /**
        * Create a savepoint for wsv state
        * @param name of savepoint to be created
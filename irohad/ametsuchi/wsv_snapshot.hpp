@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_HPP
+#define IROHA_WSV_SNAPSHOT_HPP
+
+#include <string>
+
+#include "common/result.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+#include "cryptography/hash.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class BlockQuery;
+
+    /**
+     * Consistent copy of the world state view taken right after the block
+     * with the given height has been applied
+     */
+    struct WsvSnapshot {
+      /// height of the last block applied to the snapshotted state
+      shared_model::interface::types::HeightType height;
+      /// hash of the last block applied to the snapshotted state
+      shared_model::interface::types::HashType block_hash;
+      /// hash of the serialized state
+      shared_model::interface::types::HashType data_hash;
+      /// serialized state
+      std::string data;
+    };
+
+    /**
+     * Calculate the hash of a serialized state
+     * @param data - serialized state
+     * @return hash to be stored in WsvSnapshot::data_hash
+     */
+    inline shared_model::interface::types::HashType makeWsvSnapshotHash(
+        const std::string &data) {
+      return shared_model::interface::types::HashType(
+          iroha::sha3_256(data).to_string());
+    }
+
+    /**
+     * Check that the snapshot is intact and was taken on top of the given
+     * block: the data matches its hash and the recorded height and hash are
+     * the ones of the block
+     * @param snapshot - snapshot to check
+     * @param block - trusted block, i.e. one from the local block storage or
+     * one committed with the signatures of a supermajority of the peers
+     * @return error description if the snapshot cannot be used
+     */
+    expected::Result<void, std::string> checkWsvSnapshot(
+        const WsvSnapshot &snapshot,
+        const shared_model::interface::Block &block);
+
+    /**
+     * Check that the snapshot is intact and belongs to the local chain: the
+     * data matches its hash, the block at the snapshot height has the
+     * recorded hash and the next block, if it is stored, follows that hash
+     * @param snapshot - snapshot to check
+     * @param block_query - query to the local block storage
+     * @return error description if the snapshot cannot be used
+     */
+    expected::Result<void, std::string> checkWsvSnapshot(
+        const WsvSnapshot &snapshot, BlockQuery &block_query);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_HPP
@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_STORAGE_HPP
+#define IROHA_WSV_SNAPSHOT_STORAGE_HPP
+
+#include <boost/optional.hpp>
+#include "ametsuchi/wsv_snapshot.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Persistent storage of world state view snapshots, keyed by height
+     */
+    class WsvSnapshotStorage {
+     public:
+      /**
+       * Store the snapshot
+       * @param snapshot - snapshot to store
+       * @return false if a snapshot with the same height already exists or
+       * writing has failed
+       */
+      virtual bool insert(const WsvSnapshot &snapshot) = 0;
+
+      /**
+       * Load the snapshot taken at the given height
+       * @param height - height of the snapshot
+       * @return snapshot or boost::none if it does not exist or is damaged
+       */
+      virtual boost::optional<WsvSnapshot> get(
+          shared_model::interface::types::HeightType height) const = 0;
+
+      /**
+       * @param max_height - upper bound of the snapshot height, inclusive
+       * @return height of the latest snapshot not above max_height, if any
+       */
+      virtual boost::optional<shared_model::interface::types::HeightType>
+      lastHeight(shared_model::interface::types::HeightType max_height)
+          const = 0;
+
+      /**
+       * Remove the snapshots except the given number of the latest ones
+       * @param count - number of snapshots to keep
+       */
+      virtual void keepLatest(size_t count) = 0;
+
+      /**
+       * Remove all snapshots
+       */
+      virtual void dropAll() = 0;
+
+      virtual ~WsvSnapshotStorage() = default;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_STORAGE_HPP
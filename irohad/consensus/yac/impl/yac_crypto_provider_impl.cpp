@@ -6,7 +6,6 @@
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
 
 #include "consensus/yac/transport/yac_pb_converters.hpp"
-#include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 
 namespace iroha {
@@ -16,7 +15,7 @@ namespace iroha {
           const shared_model::crypto::Keypair &keypair,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
               factory)
-          : keypair_(keypair), factory_(std::move(factory)) {}
+          : signer_(keypair), factory_(std::move(factory)) {}
 
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
         return std::all_of(
@@ -38,14 +37,11 @@ namespace iroha {
         auto serialized =
             PbConverters::serializeVotePayload(vote).hash().SerializeAsString();
         auto blob = shared_model::crypto::Blob(serialized);
-        const auto &pubkey = keypair_.publicKey();
-        const auto &privkey = keypair_.privateKey();
-        auto signature = shared_model::crypto::CryptoSigner<>::sign(
-            blob, shared_model::crypto::Keypair(pubkey, privkey));
+        auto signature = signer_.sign(blob);
 
         // TODO 30.08.2018 andrei: IR-1670 Remove optional from YAC
         // CryptoProviderImpl::getVote
-        factory_->createSignature(pubkey, signature)
+        factory_->createSignature(signer_.publicKey(), signature)
             .match([&](auto &&sig) { vote.signature = std::move(sig.value); },
                    [](const auto &) {});
 
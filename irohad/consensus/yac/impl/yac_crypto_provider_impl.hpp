@@ -8,6 +8,7 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
+#include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/keypair.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 
@@ -26,7 +27,7 @@ namespace iroha {
         VoteMessage getVote(YacHash hash) override;
 
        private:
-        shared_model::crypto::Keypair keypair_;
+        shared_model::crypto::CryptoSigner<>::KeypairSignerType signer_;
         std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory_;
       };
     }  // namespace yac
@@ -5,6 +5,8 @@
 
 #include "main/application.hpp"
 
+#include <thread>
+
 #include <boost/filesystem.hpp>
 
 #include "ametsuchi/impl/flat_file_block_storage_factory.hpp"
@@ -72,6 +74,13 @@ using namespace std::chrono_literals;
 static constexpr iroha::consensus::yac::ConsistencyModel
     kConsensusConsistencyModel = iroha::consensus::yac::ConsistencyModel::kBft;
 
+/// Number of parallel stateful validations. Each of them holds a database
+/// connection, so it is kept well below the connection pool size
+static constexpr size_t kStatefulValidationWorkers = 4;
+
+/// Maximum number of query responses kept between commits
+static constexpr size_t kQueryResultCacheCapacity = 10000;
+
 /**
  * Configuring iroha daemon
  */
@@ -91,7 +100,9 @@ Irohad::Irohad(const std::string &block_store_dir,
                    opt_alternative_peers,
                logger::LoggerManagerTreePtr logger_manager,
                const boost::optional<GossipPropagationStrategyParams>
-                   &opt_mst_gossip_params)
+                   &opt_mst_gossip_params,
+               const iroha::ametsuchi::PoolOptions &pool_options,
+               const iroha::ametsuchi::WsvSnapshotOptions &wsv_snapshot_options)
     : block_store_dir_(block_store_dir),
       pg_conn_(pg_conn),
       listen_ip_(listen_ip),
@@ -106,6 +117,8 @@ Irohad::Irohad(const std::string &block_store_dir,
       stale_stream_max_rounds_(stale_stream_max_rounds),
       opt_alternative_peers_(std::move(opt_alternative_peers)),
       opt_mst_gossip_params_(opt_mst_gossip_params),
+      pool_options_(pool_options),
+      wsv_snapshot_options_(wsv_snapshot_options),
       keypair(keypair),
       ordering_init(logger_manager->getLogger()),
       yac_init(std::make_unique<iroha::consensus::yac::YacInit>()),
@@ -204,7 +217,9 @@ Irohad::RunResult Irohad::initStorage() {
              std::move(block_storage_factory),
              std::make_unique<
                  iroha::ametsuchi::KTimesReconnectionStrategyFactory>(10),
-             log_manager_->getChild("Storage"))
+             log_manager_->getChild("Storage"),
+             pool_options_,
+             wsv_snapshot_options_)
       .match(
           [&](auto &&v) -> RunResult {
             storage = std::move(v.value);
@@ -273,7 +288,9 @@ Irohad::RunResult Irohad::initValidators() {
   auto validators_log_manager = log_manager_->getChild("Validators");
   stateful_validator = std::make_shared<StatefulValidatorImpl>(
       std::move(factory),
-      batch_parser,
+      storage,
+      std::min<size_t>(kStatefulValidationWorkers,
+                       std::thread::hardware_concurrency()),
       validators_log_manager->getChild("Stateful")->getLogger());
   chain_validator = std::make_shared<ChainValidatorImpl>(
       getSupermajorityChecker(kConsensusConsistencyModel),
@@ -715,6 +732,10 @@ Irohad::RunResult Irohad::initQueryService() {
       storage,
       pending_txs_storage_,
       query_response_factory_,
+      // a replica can lag behind the commits, which invalidate the cache
+      pool_options_.query_connection
+          ? nullptr
+          : std::make_shared<QueryResultCache>(kQueryResultCacheCapacity),
       query_service_log_manager->getChild("Processor")->getLogger());
 
   query_service = std::make_shared<::torii::QueryService>(
@@ -728,7 +749,9 @@ Irohad::RunResult Irohad::initQueryService() {
 }
 
 Irohad::RunResult Irohad::initWsvRestorer() {
-  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>();
+  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>(
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      log_manager_->getChild("WsvRestorer")->getLogger());
   return {};
 }
 
@@ -6,6 +6,8 @@
 #ifndef IROHA_APPLICATION_HPP
 #define IROHA_APPLICATION_HPP
 
+#include "ametsuchi/impl/pool_options.hpp"
+#include "ametsuchi/impl/wsv_snapshot_options.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/gate_object.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
@@ -97,6 +99,10 @@ class Irohad {
    * @param logger_manager - the logger manager to use
    * @param opt_mst_gossip_params - parameters for Gossip MST propagation
    * (optional). If not provided, disables mst processing support
+   * @param pool_options - sizes of the database connection pools and the
+   * connection of the client query pool
+   * @param wsv_snapshot_options - period and number of the local WSV
+   * snapshots
    * TODO mboldyrev 03.11.2018 IR-1844 Refactor the constructor.
    */
   Irohad(const std::string &block_store_dir,
@@ -115,7 +121,11 @@ class Irohad {
              opt_alternative_peers,
          logger::LoggerManagerTreePtr logger_manager,
          const boost::optional<iroha::GossipPropagationStrategyParams>
-             &opt_mst_gossip_params = boost::none);
+             &opt_mst_gossip_params = boost::none,
+         const iroha::ametsuchi::PoolOptions &pool_options =
+             iroha::ametsuchi::PoolOptions(),
+         const iroha::ametsuchi::WsvSnapshotOptions &wsv_snapshot_options =
+             iroha::ametsuchi::WsvSnapshotOptions());
 
   /**
    * Initialization of whole objects in system
@@ -212,6 +222,8 @@ class Irohad {
       opt_alternative_peers_;
   boost::optional<iroha::GossipPropagationStrategyParams>
       opt_mst_gossip_params_;
+  iroha::ametsuchi::PoolOptions pool_options_;
+  iroha::ametsuchi::WsvSnapshotOptions wsv_snapshot_options_;
 
   // ------------------------| internal dependencies |-------------------------
  public:
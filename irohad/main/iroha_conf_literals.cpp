@@ -18,6 +18,12 @@ namespace config_members {
   const char *MstExpirationTime = "mst_expiration_time";
   const char *MaxRoundsDelay = "max_rounds_delay";
   const char *StaleStreamMaxRounds = "stale_stream_max_rounds";
+  const char *PgPoolSize = "pg_pool_size";
+  const char *PgQueryPoolSize = "pg_query_pool_size";
+  const char *PgQueryOpt = "pg_query_opt";
+  const char *PgQueryMaxWait = "pg_query_max_wait";
+  const char *WsvSnapshotPeriod = "wsv_snapshot_period";
+  const char *WsvSnapshotsKept = "wsv_snapshots_kept";
   const char *LogSection = "log";
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
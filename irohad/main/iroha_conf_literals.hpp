@@ -24,6 +24,12 @@ namespace config_members {
   extern const char *MstExpirationTime;
   extern const char *MaxRoundsDelay;
   extern const char *StaleStreamMaxRounds;
+  extern const char *PgPoolSize;
+  extern const char *PgQueryPoolSize;
+  extern const char *PgQueryOpt;
+  extern const char *PgQueryMaxWait;
+  extern const char *WsvSnapshotPeriod;
+  extern const char *WsvSnapshotsKept;
   extern const char *LogSection;
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
@@ -370,6 +370,25 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
               dest.stale_stream_max_rounds,
               obj,
               config_members::StaleStreamMaxRounds);
+  getValByKey(path, dest.pg_pool_size, obj, config_members::PgPoolSize);
+  assert_fatal(not dest.pg_pool_size or *dest.pg_pool_size >= 1,
+               sublevelPath(path, config_members::PgPoolSize)
+                   + " must be at least 1");
+  getValByKey(
+      path, dest.pg_query_pool_size, obj, config_members::PgQueryPoolSize);
+  assert_fatal(not dest.pg_query_pool_size or *dest.pg_query_pool_size >= 1,
+               sublevelPath(path, config_members::PgQueryPoolSize)
+                   + " must be at least 1");
+  getValByKey(path, dest.pg_query_opt, obj, config_members::PgQueryOpt);
+  getValByKey(
+      path, dest.pg_query_max_wait, obj, config_members::PgQueryMaxWait);
+  getValByKey(
+      path, dest.wsv_snapshot_period, obj, config_members::WsvSnapshotPeriod);
+  getValByKey(
+      path, dest.wsv_snapshots_kept, obj, config_members::WsvSnapshotsKept);
+  assert_fatal(not dest.wsv_snapshots_kept or *dest.wsv_snapshots_kept >= 1,
+               sublevelPath(path, config_members::WsvSnapshotsKept)
+                   + " must be at least 1");
   getValByKey(path, dest.logger_manager, obj, config_members::LogSection);
   getValByKey(path, dest.initial_peers, obj, config_members::InitialPeers);
 }
@@ -25,6 +25,12 @@ struct IrohadConfig {
   boost::optional<uint32_t> mst_expiration_time;
   boost::optional<uint32_t> max_round_delay_ms;
   boost::optional<uint32_t> stale_stream_max_rounds;
+  boost::optional<uint32_t> pg_pool_size;
+  boost::optional<uint32_t> pg_query_pool_size;
+  boost::optional<std::string> pg_query_opt;
+  boost::optional<uint32_t> pg_query_max_wait;
+  boost::optional<uint32_t> wsv_snapshot_period;
+  boost::optional<uint32_t> wsv_snapshots_kept;
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
 };
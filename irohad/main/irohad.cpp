@@ -173,6 +173,27 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  iroha::ametsuchi::PoolOptions pool_options;
+  if (config.pg_pool_size) {
+    pool_options.pool_size = *config.pg_pool_size;
+  }
+  if (config.pg_query_pool_size) {
+    pool_options.query_pool_size = *config.pg_query_pool_size;
+  }
+  if (config.pg_query_max_wait) {
+    pool_options.query_max_wait =
+        std::chrono::milliseconds(*config.pg_query_max_wait);
+  }
+  pool_options.query_connection = config.pg_query_opt;
+
+  iroha::ametsuchi::WsvSnapshotOptions wsv_snapshot_options;
+  if (config.wsv_snapshot_period) {
+    wsv_snapshot_options.period = *config.wsv_snapshot_period;
+  }
+  if (config.wsv_snapshots_kept) {
+    wsv_snapshot_options.kept = *config.wsv_snapshots_kept;
+  }
+
   // Configuring iroha daemon
   Irohad irohad(
       config.block_store_path,
@@ -193,7 +214,9 @@ int main(int argc, char *argv[]) {
       std::move(config.initial_peers),
       log_manager->getChild("Irohad"),
       boost::make_optional(config.mst_support,
-                           iroha::GossipPropagationStrategyParams{}));
+                           iroha::GossipPropagationStrategyParams{}),
+      pool_options,
+      wsv_snapshot_options);
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad.storage) {
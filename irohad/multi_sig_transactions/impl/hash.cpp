@@ -6,24 +6,15 @@
 #include "multi_sig_transactions/hash.hpp"
 
 #include <functional>
-#include <string>
 
-#include <boost/functional/hash.hpp>
-#include "cryptography/blob.hpp"
-#include "cryptography/public_key.hpp"
-#include "interfaces/common_objects/peer.hpp"
+#include "cryptography/hash.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 
 namespace iroha {
   namespace model {
 
     size_t PointerBatchHasher::operator()(const DataType &batch) const {
-      return std::hash<std::string>{}(batch->reducedHash().hex());
-    }
-
-    std::size_t BlobHasher::operator()(
-        const shared_model::crypto::Blob &blob) const {
-      return boost::hash_value(blob.blob());
+      return std::hash<shared_model::crypto::Hash>{}(batch->reducedHash());
     }
 
   }  // namespace model
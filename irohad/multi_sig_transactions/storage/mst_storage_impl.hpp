@@ -7,6 +7,7 @@
 #define IROHA_MST_STORAGE_IMPL_HPP
 
 #include <unordered_map>
+#include "cryptography/public_key.hpp"
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
@@ -54,9 +55,7 @@ namespace iroha {
     // ---------------------------| private fields |----------------------------
 
     const CompleterType completer_;
-    std::unordered_map<shared_model::crypto::PublicKey,
-                       MstState,
-                       iroha::model::BlobHasher>
+    std::unordered_map<shared_model::crypto::PublicKey, MstState>
         peer_states_;
     MstState own_state_;
 
@@ -30,6 +30,19 @@ namespace iroha {
       retrieveBlocks(const shared_model::interface::types::HeightType height,
                      const shared_model::crypto::PublicKey &peer_pubkey) = 0;
 
+      /**
+       * Retrieve a bounded range of blocks from given peer
+       * @param height - height of the block preceding the requested range
+       * @param to_height - height of the last requested block, inclusive
+       * @param peer_pubkey - peer for requesting blocks
+       * @return observable with blocks (height, to_height] in ascending order;
+       * completes earlier if the peer does not have all of them
+       */
+      virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlocks(const shared_model::interface::types::HeightType height,
+                     const shared_model::interface::types::HeightType to_height,
+                     const shared_model::crypto::PublicKey &peer_pubkey) = 0;
+
       /**
        * Retrieve block by its block_height from given peer
        * @param peer_pubkey - peer for requesting blocks
@@ -7,10 +7,12 @@
 
 #include <grpc++/create_channel.h>
 #include <chrono>
+#include <thread>
 
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/transport_builder.hpp"
 #include "common/bind.hpp"
+#include "common/ordered_pipeline.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
@@ -25,6 +27,26 @@ namespace {
   const char *kPeerRetrieveFail = "Failed to retrieve peers";
   const char *kPeerFindFail = "Failed to find requested peer";
   const std::chrono::seconds kBlocksRequestTimeout{5};
+  // number of threads verifying the received blocks of all downloads
+  const size_t kBlockVerificationWorkers =
+      std::max(1u, std::thread::hardware_concurrency());
+  // maximum number of received blocks of a download waiting for the
+  // subscriber
+  const size_t kMaxBlocksAhead = 4 * kBlockVerificationWorkers;
+
+  /// received block, which is parsed into its own arena
+  struct ArenaBlock {
+    std::shared_ptr<google::protobuf::Arena> arena;
+    iroha::protocol::Block *block;
+  };
+
+  ArenaBlock makeArenaBlock() {
+    auto arena = std::make_shared<google::protobuf::Arena>();
+    auto block =
+        google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+            arena.get());
+    return ArenaBlock{std::move(arena), block};
+  }
 }  // namespace
 
 BlockLoaderImpl::BlockLoaderImpl(
@@ -33,13 +55,29 @@ BlockLoaderImpl::BlockLoaderImpl(
     logger::LoggerPtr log)
     : peer_query_factory_(std::move(peer_query_factory)),
       block_factory_(std::move(factory)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      verification_pool_(kBlockVerificationWorkers) {}
 
 rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
     const shared_model::interface::types::HeightType height,
     const PublicKey &peer_pubkey) {
+  return requestBlocks(height, boost::none, peer_pubkey);
+}
+
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
+    const shared_model::interface::types::HeightType height,
+    const shared_model::interface::types::HeightType to_height,
+    const PublicKey &peer_pubkey) {
+  return requestBlocks(height, to_height, peer_pubkey);
+}
+
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::requestBlocks(
+    const shared_model::interface::types::HeightType height,
+    boost::optional<shared_model::interface::types::HeightType> to_height,
+    const PublicKey &peer_pubkey) {
+  // the key is copied, since the observable may outlive the caller's one
   return rxcpp::observable<>::create<std::shared_ptr<Block>>(
-      [this, height, &peer_pubkey](auto subscriber) {
+      [this, height, to_height, peer_pubkey](auto subscriber) {
         auto peer = this->findPeer(peer_pubkey);
         if (not peer) {
           log_->error("{}", kPeerNotFound);
@@ -49,7 +87,6 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
         proto::BlockRequest request;
         grpc::ClientContext context;
-        protocol::Block block;
 
         // set a timeout to avoid being hung
         context.set_deadline(std::chrono::system_clock::now()
@@ -57,20 +94,44 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
         // request next block to our top
         request.set_height(height + 1);
+        if (to_height) {
+          request.set_to_height(*to_height);
+        }
 
         auto reader =
             this->getPeerStub(**peer).retrieveBlocks(&context, request);
-        while (subscriber.is_subscribed() and reader->Read(&block)) {
-          block_factory_.createBlock(std::move(block))
-              .match(
-                  [&subscriber](auto &&result) {
-                    subscriber.on_next(std::move(result.value));
+        // blocks are parsed and their signatures are verified by the shared
+        // pool ahead of the subscriber, which applies them one by one
+        iroha::runOrderedPipeline<ArenaBlock>(
+            [&reader]() -> boost::optional<ArenaBlock> {
+              auto received = makeArenaBlock();
+              if (not reader->Read(received.block)) {
+                return boost::none;
+              }
+              return received;
+            },
+            [this](ArenaBlock received) {
+              return block_factory_.createBlock(std::move(received.arena),
+                                                *received.block);
+            },
+            [this, &subscriber, &context](auto result) {
+              return std::move(result).match(
+                  [&subscriber, &context](auto &&value) {
+                    subscriber.on_next(std::move(value.value));
+                    if (subscriber.is_subscribed()) {
+                      return true;
+                    }
+                    context.TryCancel();
+                    return false;
                   },
                   [this, &context](const auto &error) {
                     log_->error("{}", error.error);
                     context.TryCancel();
+                    return false;
                   });
-        }
+            },
+            verification_pool_,
+            kMaxBlocksAhead);
         reader->Finish();
         subscriber.on_completed();
       });
@@ -86,18 +147,19 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
 
   proto::BlockRequest request;
   grpc::ClientContext context;
-  protocol::Block block;
+  auto received = makeArenaBlock();
 
   // request block with specified height
   request.set_height(block_height);
 
-  auto status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  auto status =
+      getPeerStub(**peer).retrieveBlock(&context, request, received.block);
   if (not status.ok()) {
     log_->warn("{}", status.error_message());
     return boost::none;
   }
 
-  return block_factory_.createBlock(std::move(block))
+  return block_factory_.createBlock(std::move(received.arena), *received.block)
       .match(
           [](auto &&v) {
             return boost::make_optional(
@@ -132,6 +194,7 @@ BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
 
 proto::Loader::Stub &BlockLoaderImpl::getPeerStub(
     const shared_model::interface::Peer &peer) {
+  std::lock_guard<std::mutex> lock(peer_connections_mutex_);
   auto it = peer_connections_.find(peer.address());
   if (it == peer_connections_.end()) {
     it = peer_connections_
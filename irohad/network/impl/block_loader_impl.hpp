@@ -8,10 +8,12 @@
 
 #include "network/block_loader.hpp"
 
+#include <mutex>
 #include <unordered_map>
 
 #include "ametsuchi/peer_query_factory.hpp"
 #include "backend/protobuf/proto_block_factory.hpp"
+#include "common/thread_pool.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger_fwd.hpp"
 
@@ -30,12 +32,31 @@ namespace iroha {
           const shared_model::interface::types::HeightType height,
           const shared_model::crypto::PublicKey &peer_pubkey) override;
 
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlocks(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType to_height,
+          const shared_model::crypto::PublicKey &peer_pubkey) override;
+
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlock(
           const shared_model::crypto::PublicKey &peer_pubkey,
           shared_model::interface::types::HeightType block_height) override;
 
      private:
+      /**
+       * Stream blocks starting from height + 1 from the given peer
+       * @param height - height of the block preceding the requested ones
+       * @param to_height - last requested height, none for the peer's top
+       * @param peer_pubkey - peer for requesting blocks
+       */
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      requestBlocks(
+          const shared_model::interface::types::HeightType height,
+          boost::optional<shared_model::interface::types::HeightType>
+              to_height,
+          const shared_model::crypto::PublicKey &peer_pubkey);
+
       /**
        * Retrieve peers from database, and find the requested peer by pubkey
        * @param pubkey - public key of requested peer
@@ -55,10 +76,16 @@ namespace iroha {
       std::unordered_map<shared_model::interface::types::AddressType,
                          std::unique_ptr<proto::Loader::Stub>>
           peer_connections_;
+      /// guards peer_connections_, blocks may be loaded from several threads
+      std::mutex peer_connections_mutex_;
       std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
       shared_model::proto::ProtoBlockFactory block_factory_;
 
       logger::LoggerPtr log_;
+
+      /// verifies the received blocks of all the concurrent downloads, it is
+      /// declared last to be stopped before the rest of the loader
+      ThreadPool verification_pool_;
     };
   }  // namespace network
 }  // namespace iroha
@@ -5,6 +5,8 @@
 
 #include "network/impl/block_loader_service.hpp"
 
+#include <google/protobuf/util/json_util.h>
+
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
 #include "logger/logger.hpp"
@@ -17,11 +19,42 @@ BlockLoaderService::BlockLoaderService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<iroha::consensus::ConsensusResultCache>
         consensus_result_cache,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    size_t max_blocks_per_write)
     : block_query_factory_(std::move(block_query_factory)),
       consensus_result_cache_(std::move(consensus_result_cache)),
+      max_blocks_per_write_(std::max<size_t>(max_blocks_per_write, 1)),
       log_(std::move(log)) {}
 
+namespace {
+  /**
+   * Read the block from storage directly into its transport representation,
+   * bypassing the creation of a shared model block
+   * @return true if the block was loaded, false otherwise
+   */
+  bool loadTransportBlock(BlockQuery &block_query,
+                          shared_model::interface::types::HeightType height,
+                          protocol::Block &proto_block,
+                          const logger::LoggerPtr &log) {
+    return block_query.getSerializedBlock(height).match(
+        [&proto_block, &log](const auto &json) {
+          proto_block.Clear();
+          auto status = google::protobuf::util::JsonStringToMessage(
+              json.value, &proto_block);
+          if (not status.ok()) {
+            log->error("Could not parse a block from block storage: {}",
+                       status.error_message());
+          }
+          return status.ok();
+        },
+        [&log](const auto &error) {
+          log->error("Could not retrieve a block from block storage: {}",
+                     error.error);
+          return false;
+        });
+  }
+}  // namespace
+
 grpc::Status BlockLoaderService::retrieveBlocks(
     ::grpc::ServerContext *context,
     const proto::BlockRequest *request,
@@ -33,27 +66,34 @@ grpc::Status BlockLoaderService::retrieveBlocks(
   }
 
   auto top_height = (*block_query)->getTopBlockHeight();
+  if (request->to_height() != 0) {
+    top_height = std::min<decltype(top_height)>(top_height,
+                                                request->to_height());
+  }
+  protocol::Block proto_block;
+  size_t buffered_blocks = 0;
   for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
-    auto block_result = (*block_query)->getBlock(i);
-
-    if (auto e = boost::get<expected::Error<std::string>>(&block_result)) {
-      log_->error("Could not retrieve a block from block storage: {}",
-                  e->error);
+    if (not loadTransportBlock(**block_query, i, proto_block, log_)) {
       return grpc::Status(grpc::StatusCode::INTERNAL,
                           "internal error happened");
     }
 
-    auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
-            .value;
-
-    protocol::Block proto_block;
-    *proto_block.mutable_block_v1() =
-        static_cast<shared_model::proto::Block *>(block.get())->getTransport();
+    // let gRPC coalesce several blocks into one network write; the last block
+    // of each batch flushes the buffer
+    grpc::WriteOptions options;
+    if (++buffered_blocks < max_blocks_per_write_ and i < top_height) {
+      options.set_buffer_hint();
+    } else {
+      buffered_blocks = 0;
+    }
 
-    writer->Write(proto_block);
+    // Write returns once the message is accepted by gRPC flow control, so the
+    // storage is not read far ahead of the requester; false means that the
+    // stream is gone
+    if (not writer->Write(proto_block, options)) {
+      log_->info("Blocks stream was closed by the requester at height {}", i);
+      return grpc::Status(grpc::StatusCode::CANCELLED, "stream closed");
+    }
   }
 
   return grpc::Status::OK;
@@ -95,21 +135,8 @@ grpc::Status BlockLoaderService::retrieveBlock(
     return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
   }
 
-  auto block_result = (*block_query)->getBlock(height);
-
-  if (auto e = boost::get<expected::Error<std::string>>(&block_result)) {
-    log_->error("Could not retrieve a block from block storage: {}", e->error);
+  if (not loadTransportBlock(**block_query, height, *response, log_)) {
     return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
   }
-
-  auto &block =
-      boost::get<
-          expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-          block_result)
-          .value;
-
-  const auto &block_v1 =
-      static_cast<shared_model::proto::Block *>(block.get())->getTransport();
-  *response->mutable_block_v1() = block_v1;
   return grpc::Status::OK;
 }
@@ -15,11 +15,21 @@ namespace iroha {
   namespace network {
     class BlockLoaderService : public proto::Loader::Service {
      public:
+      /**
+       * @param block_query_factory - factory of queries to block storage
+       * @param consensus_result_cache - cache with the last agreed block
+       * @param log - logger
+       * @param max_blocks_per_write - maximum number of blocks retrieveBlocks
+       * lets gRPC buffer before flushing them to the network at once
+       */
       BlockLoaderService(
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<iroha::consensus::ConsensusResultCache>
               consensus_result_cache,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t max_blocks_per_write = kDefaultMaxBlocksPerWrite);
+
+      static constexpr size_t kDefaultMaxBlocksPerWrite = 16;
 
       grpc::Status retrieveBlocks(
           ::grpc::ServerContext *context,
@@ -34,6 +44,7 @@ namespace iroha {
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<iroha::consensus::ConsensusResultCache>
           consensus_result_cache_;
+      size_t max_blocks_per_write_;
       logger::LoggerPtr log_;
     };
   }  // namespace network
@@ -14,7 +14,6 @@
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
-#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "logger/logger.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 
@@ -147,10 +146,8 @@ OnDemandOrderingGate::removeReplays(
         });
   };
 
-  shared_model::interface::TransactionBatchParserImpl batch_parser;
-
   bool has_replays = false;
-  auto batches = batch_parser.parseBatches(proposal->transactions());
+  auto batches = proposal->batches();
   for (auto &batch : batches) {
     bool all_txs_are_new =
         std::all_of(batch.begin(), batch.end(), tx_is_not_processed);
@@ -55,7 +55,11 @@ OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
   proto::ProposalRequest request;
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
-  proto::ProposalResponse response;
+  // the response is parsed into the arena, which is kept by the proposal
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  auto &response =
+      *google::protobuf::Arena::CreateMessage<proto::ProposalResponse>(
+          arena.get());
   auto status = stub_->RequestProposal(&context, request, &response);
   if (not status.ok()) {
     log_->warn("RPC failed: {}", status.error_message());
@@ -64,7 +68,7 @@ OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
   if (not response.has_proposal()) {
     return boost::none;
   }
-  return proposal_factory_->build(response.proposal())
+  return proposal_factory_->build(*response.mutable_proposal(), arena)
       .match(
           [&](auto &&v) {
             return boost::make_optional(
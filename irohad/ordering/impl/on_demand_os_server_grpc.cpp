@@ -7,9 +7,10 @@
 
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/transformed.hpp>
+#include <numeric>
+
 #include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/util.hpp"
 #include "common/bind.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
@@ -34,27 +35,24 @@ OnDemandOsServerGrpc::OnDemandOsServerGrpc(
 shared_model::interface::types::SharedTxsCollectionType
 OnDemandOsServerGrpc::deserializeTransactions(
     const proto::BatchesRequest *request) {
-  return boost::copy_range<
-      shared_model::interface::types::SharedTxsCollectionType>(
-      request->transactions()
-      | boost::adaptors::transformed(
-            [&](const auto &tx) { return transaction_factory_->build(tx); })
-      | boost::adaptors::filtered([&](const auto &result) {
-          return result.match(
-              [](const auto &) { return true; },
-              [&](const auto &error) {
-                log_->info("Transaction deserialization failed: hash {}, {}",
-                           error.error.hash,
-                           error.error.error);
-                return false;
-              });
-        })
-      | boost::adaptors::transformed([](auto result) {
-          return std::move(
-                     boost::get<iroha::expected::ValueOf<decltype(result)>>(
-                         result))
-              .value;
-        }));
+  shared_model::interface::types::SharedTxsCollectionType tx_collection;
+  // transactions of the request are copied to a single arena, which is
+  // released with the last of them
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  for (const auto &tx : request->transactions()) {
+    auto &arena_tx = shared_model::proto::copyToArena(*arena, tx);
+    transaction_factory_->build(arena_tx, arena)
+        .match(
+            [&tx_collection](auto &&v) {
+              tx_collection.emplace_back(std::move(v).value);
+            },
+            [this](const auto &error) {
+              log_->info("Transaction deserialization failed: hash {}, {}",
+                         error.error.hash,
+                         error.error.error);
+            });
+  }
+  return tx_collection;
 }
 
 grpc::Status OnDemandOsServerGrpc::SendBatches(
@@ -0,0 +1,213 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/parallel_block_downloader.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+using HeightType = shared_model::interface::types::HeightType;
+using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+
+namespace {
+  /// Part of the downloaded range: blocks (from, to]
+  struct Chunk {
+    size_t index;
+    HeightType from;
+    HeightType to;
+    /// number of peers which have already failed to provide the chunk
+    size_t attempt;
+  };
+
+  /// State shared between download workers and the emitting thread
+  struct DownloadState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Chunk> pending;
+    /// reorder buffer: chunk index -> blocks, none if the chunk has failed
+    std::map<size_t, boost::optional<std::vector<BlockPtr>>> ready;
+    /// index of the next chunk to be emitted
+    size_t next_index = 0;
+    bool stopped = false;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace synchronizer {
+
+    ParallelBlockDownloader::ParallelBlockDownloader(
+        std::shared_ptr<network::BlockLoader> block_loader,
+        HeightType chunk_size,
+        size_t max_parallel_requests,
+        logger::LoggerPtr log)
+        : block_loader_(std::move(block_loader)),
+          chunk_size_(std::max<HeightType>(chunk_size, 1)),
+          max_parallel_requests_(std::max<size_t>(max_parallel_requests, 1)),
+          log_(std::move(log)) {}
+
+    rxcpp::observable<BlockPtr> ParallelBlockDownloader::download(
+        HeightType start_height,
+        HeightType target_height,
+        shared_model::interface::types::PublicKeyCollectionType public_keys)
+        const {
+      return rxcpp::observable<>::create<BlockPtr>([this,
+                                                    start_height,
+                                                    target_height,
+                                                    public_keys](
+                                                       auto subscriber) {
+        if (public_keys.empty() or target_height <= start_height) {
+          subscriber.on_completed();
+          return;
+        }
+
+        DownloadState state;
+        size_t chunks_number = 0;
+        for (auto from = start_height; from < target_height;
+             from += chunk_size_) {
+          state.pending.push_back(
+              Chunk{chunks_number++,
+                    from,
+                    std::min<HeightType>(from + chunk_size_, target_height),
+                    0});
+        }
+
+        const size_t workers_number = std::min(
+            {max_parallel_requests_, public_keys.size(), chunks_number});
+        // limits the number of chunks held in the reorder buffer
+        const size_t window = 2 * workers_number;
+
+        // returns the chunk blocks, or none if the peer did not provide all
+        // of them in the right order
+        auto fetch = [this, &public_keys](const Chunk &chunk)
+            -> boost::optional<std::vector<BlockPtr>> {
+          const auto &peer =
+              public_keys[(chunk.index + chunk.attempt) % public_keys.size()];
+          std::vector<BlockPtr> blocks;
+          blocks.reserve(chunk.to - chunk.from);
+          block_loader_->retrieveBlocks(chunk.from, chunk.to, peer)
+              .as_blocking()
+              .subscribe([&blocks](BlockPtr block) {
+                blocks.push_back(std::move(block));
+              });
+
+          HeightType expected_height = chunk.from;
+          auto consistent = blocks.size() == chunk.to - chunk.from
+              and std::all_of(blocks.begin(),
+                              blocks.end(),
+                              [&expected_height](const auto &block) {
+                                return block->height() == ++expected_height;
+                              });
+          if (not consistent) {
+            log_->warn("Peer {} did not provide blocks ({}, {}]",
+                       peer.hex(),
+                       chunk.from,
+                       chunk.to);
+            return boost::none;
+          }
+          return blocks;
+        };
+
+        auto worker = [&state, &fetch, &public_keys, window] {
+          while (true) {
+            Chunk chunk;
+            {
+              std::unique_lock<std::mutex> lock(state.mutex);
+              state.cv.wait(lock, [&state, window] {
+                return state.stopped
+                    or (not state.pending.empty()
+                        and state.pending.front().index
+                            < state.next_index + window);
+              });
+              if (state.stopped) {
+                return;
+              }
+              chunk = state.pending.front();
+              state.pending.pop_front();
+            }
+
+            auto blocks = fetch(chunk);
+
+            {
+              std::lock_guard<std::mutex> lock(state.mutex);
+              if (blocks) {
+                state.ready.emplace(chunk.index, std::move(blocks));
+              } else if (++chunk.attempt < public_keys.size()) {
+                // retry as soon as possible, since it blocks the emission
+                state.pending.push_front(chunk);
+              } else {
+                state.ready.emplace(chunk.index, boost::none);
+              }
+            }
+            state.cv.notify_all();
+          }
+        };
+
+        log_->info("Downloading blocks ({}, {}] in {} chunks from {} peers",
+                   start_height,
+                   target_height,
+                   chunks_number,
+                   workers_number);
+
+        std::vector<std::thread> workers;
+        workers.reserve(workers_number);
+        for (size_t i = 0; i < workers_number; ++i) {
+          workers.emplace_back(worker);
+        }
+
+        for (size_t index = 0;
+             index < chunks_number and subscriber.is_subscribed();
+             ++index) {
+          boost::optional<std::vector<BlockPtr>> blocks;
+          {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.cv.wait(lock, [&state, index] {
+              return state.ready.find(index) != state.ready.end();
+            });
+            auto it = state.ready.find(index);
+            blocks = std::move(it->second);
+            state.ready.erase(it);
+            state.next_index = index + 1;
+          }
+          state.cv.notify_all();
+
+          if (not blocks) {
+            log_->error(
+                "Could not download blocks after height {} from any peer",
+                start_height + index * chunk_size_);
+            break;
+          }
+          for (auto &block : *blocks) {
+            if (not subscriber.is_subscribed()) {
+              break;
+            }
+            subscriber.on_next(std::move(block));
+          }
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(state.mutex);
+          state.stopped = true;
+        }
+        state.cv.notify_all();
+        for (auto &worker_thread : workers) {
+          worker_thread.join();
+        }
+        subscriber.on_completed();
+      });
+    }
+
+    HeightType ParallelBlockDownloader::chunkSize() const {
+      return chunk_size_;
+    }
+
+  }  // namespace synchronizer
+}  // namespace iroha
@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
+#define IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
+
+#include <memory>
+
+#include <rxcpp/rx.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+#include "network/block_loader.hpp"
+
+namespace iroha {
+  namespace synchronizer {
+
+    /**
+     * Downloads a range of blocks from several peers at once.
+     *
+     * The range is split into chunks of fixed size, which are requested from
+     * the given peers concurrently, each chunk from a different peer when
+     * possible. A chunk which cannot be loaded in full from one peer is
+     * retried with the next one. Downloaded chunks are kept in a bounded
+     * reorder buffer and emitted strictly in height order, so the resulting
+     * observable can be passed directly to the chain validator.
+     */
+    class ParallelBlockDownloader {
+     public:
+      /**
+       * @param block_loader - loader used to fetch the chunks
+       * @param chunk_size - number of blocks requested in one call
+       * @param max_parallel_requests - maximum number of concurrent requests
+       * @param log - logger
+       */
+      ParallelBlockDownloader(
+          std::shared_ptr<network::BlockLoader> block_loader,
+          shared_model::interface::types::HeightType chunk_size,
+          size_t max_parallel_requests,
+          logger::LoggerPtr log);
+
+      /**
+       * Download blocks (start_height, target_height] from given peers
+       * @param start_height - top block height of the local ledger
+       * @param target_height - last block height to download
+       * @param public_keys - keys of the peers to request blocks from
+       * @return observable emitting the downloaded blocks in ascending height
+       * order. It completes early, before target_height is reached, if some
+       * chunk could not be downloaded from any of the peers
+       */
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      download(
+          shared_model::interface::types::HeightType start_height,
+          shared_model::interface::types::HeightType target_height,
+          shared_model::interface::types::PublicKeyCollectionType public_keys)
+          const;
+
+      /// @return number of blocks requested from one peer in one call
+      shared_model::interface::types::HeightType chunkSize() const;
+
+     private:
+      std::shared_ptr<network::BlockLoader> block_loader_;
+      shared_model::interface::types::HeightType chunk_size_;
+      size_t max_parallel_requests_;
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace synchronizer
+}  // namespace iroha
+
+#endif  // IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
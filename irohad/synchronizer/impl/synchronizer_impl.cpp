@@ -7,12 +7,22 @@
 
 #include <utility>
 
+#include <boost/range/iterator_range_core.hpp>
+#include <boost/range/size.hpp>
+
 #include "ametsuchi/block_query_factory.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
 
+namespace {
+  /// Number of blocks requested from one peer by the parallel downloader
+  const shared_model::interface::types::HeightType kBlocksChunkSize{100};
+  /// Maximum number of peers the blocks are downloaded from simultaneously
+  const size_t kMaxParallelBlockRequests{4};
+}  // namespace
+
 namespace iroha {
   namespace synchronizer {
 
@@ -27,6 +37,10 @@ namespace iroha {
           mutable_factory_(std::move(mutable_factory)),
           block_query_factory_(std::move(block_query_factory)),
           block_loader_(std::move(block_loader)),
+          block_downloader_(block_loader_,
+                            kBlocksChunkSize,
+                            kMaxParallelBlockRequests,
+                            log),
           notifier_(notifier_lifetime_),
           log_(std::move(log)) {
       consensus_gate->onOutcome().subscribe(
@@ -60,6 +74,18 @@ namespace iroha {
         const shared_model::interface::types::HeightType start_height,
         const shared_model::interface::types::HeightType target_height,
         const PublicKeysRange &public_keys) {
+      // a gap of a single chunk is not worth splitting between peers
+      if (target_height - start_height > block_downloader_.chunkSize()
+          and boost::size(public_keys) > 1) {
+        if (auto ledger_state = downloadMissingBlocksParallel(
+                start_height, target_height, public_keys)) {
+          return ledger_state;
+        }
+        log_->warn(
+            "Parallel download of missing blocks failed, "
+            "falling back to loading them from a single peer");
+      }
+
       // TODO mboldyrev 21.03.2019 IR-423 Allow consensus outcome update
       while (true) {
         // TODO andrei 17.10.18 IR-1763 Add delay strategy for loading blocks
@@ -85,6 +111,35 @@ namespace iroha {
       return boost::none;
     }
 
+    boost::optional<std::unique_ptr<LedgerState>>
+    SynchronizerImpl::downloadMissingBlocksParallel(
+        const shared_model::interface::types::HeightType start_height,
+        const shared_model::interface::types::HeightType target_height,
+        const PublicKeysRange &public_keys) {
+      auto storage = getStorage().value_or(nullptr);
+      if (not storage) {
+        return boost::none;
+      }
+
+      shared_model::interface::types::HeightType my_height = start_height;
+      auto network_chain =
+          block_downloader_
+              .download(start_height,
+                        target_height,
+                        boost::copy_range<shared_model::interface::types::
+                                              PublicKeyCollectionType>(
+                            public_keys))
+              .tap([&my_height](
+                       const std::shared_ptr<shared_model::interface::Block>
+                           &block) { my_height = block->height(); });
+
+      if (validator_->validateAndApply(network_chain, *storage)
+          and my_height >= target_height) {
+        return mutable_factory_->commit(std::move(storage));
+      }
+      return boost::none;
+    }
+
     boost::optional<std::unique_ptr<ametsuchi::MutableStorage>>
     SynchronizerImpl::getStorage() {
       auto mutable_storage_var = mutable_factory_->createMutableStorage();
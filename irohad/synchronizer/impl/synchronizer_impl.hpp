@@ -13,6 +13,7 @@
 #include "logger/logger_fwd.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
+#include "synchronizer/impl/parallel_block_downloader.hpp"
 #include "validation/chain_validator.hpp"
 
 namespace iroha {
@@ -43,6 +44,20 @@ namespace iroha {
           boost::any_range<shared_model::interface::types::PubkeyType,
                            boost::forward_traversal_tag,
                            const shared_model::interface::types::PubkeyType &>;
+      /**
+       * Load the missing blocks in chunks from several peers which signed the
+       * commit message at once and apply them
+       * @param start_height - the block from which to start synchronization
+       * @param target_height - the block height that must be reached
+       * @param public_keys - public keys of peers from which to ask the blocks
+       * @return ledger state if all the blocks were downloaded and committed
+       */
+      boost::optional<std::unique_ptr<LedgerState>>
+      downloadMissingBlocksParallel(
+          const shared_model::interface::types::HeightType start_height,
+          const shared_model::interface::types::HeightType target_height,
+          const PublicKeysRange &public_keys);
+
       /**
        * Iterate through the peers which signed the commit message, load and
        * apply the missing blocks
@@ -75,6 +90,7 @@ namespace iroha {
       std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<network::BlockLoader> block_loader_;
+      ParallelBlockDownloader block_downloader_;
 
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
@@ -10,12 +10,15 @@
 #include <atomic>
 #include <condition_variable>
 #include <iterator>
+#include <thread>
 
 #include <boost/format.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
+#include "backend/protobuf/util.hpp"
 #include "common/combine_latest_until_first_completed.hpp"
+#include "common/ordered_pipeline.hpp"
 #include "common/run_loop_handler.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
@@ -25,6 +28,14 @@
 #include "logger/logger.hpp"
 #include "torii/status_bus.hpp"
 
+namespace {
+  /// number of transactions or batches validated by a worker at once
+  const size_t kValidationChunkSize = 64;
+  /// number of threads validating the chunks of all the requests
+  const size_t kValidationWorkers =
+      std::max(1u, std::thread::hardware_concurrency());
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -49,7 +60,8 @@ namespace iroha {
           batch_factory_(std::move(transaction_batch_factory)),
           log_(std::move(log)),
           consensus_gate_objects_(std::move(consensus_gate_objects)),
-          maximum_rounds_without_update_(maximum_rounds_without_update) {}
+          maximum_rounds_without_update_(maximum_rounds_without_update),
+          validation_pool_(kValidationWorkers) {}
 
     grpc::Status CommandServiceTransportGrpc::Torii(
         grpc::ServerContext *context,
@@ -92,24 +104,97 @@ namespace iroha {
                 % error % folded_hashes)
             .str();
       }
+
+      /**
+       * Transform consecutive chunks of items on the pool and pass the
+       * results to the sink in the order of the items. Items, which fit into
+       * a single chunk, are transformed on the calling thread
+       * @param pool - threads transforming the chunks
+       * @param items_number - number of items
+       * @param transform - callable converting the range of item indices
+       * [first, second) to the sink argument, called concurrently
+       * @param sink - callable accepting the transformed chunks
+       */
+      template <typename Transform, typename Sink>
+      void forEachChunk(ThreadPool &pool,
+                        size_t items_number,
+                        Transform &&transform,
+                        Sink &&sink) {
+        using Range = std::pair<size_t, size_t>;
+        if (items_number <= kValidationChunkSize) {
+          sink(transform(Range{0, items_number}));
+          return;
+        }
+
+        size_t next = 0;
+        iroha::runOrderedPipeline<Range>(
+            [&]() -> boost::optional<Range> {
+              if (next == items_number) {
+                return boost::none;
+              }
+              Range range{
+                  next, std::min(next + kValidationChunkSize, items_number)};
+              next = range.second;
+              return range;
+            },
+            transform,
+            [&sink](auto chunk) {
+              sink(std::move(chunk));
+              return true;
+            },
+            pool,
+            2 * pool.size());
+      }
+
+      /// microseconds passed since the given time point, and resets it
+      auto lap(std::chrono::steady_clock::time_point &start) {
+        auto now = std::chrono::steady_clock::now();
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(now - start);
+        start = now;
+        return elapsed.count();
+      }
     }  // namespace
 
     shared_model::interface::types::SharedTxsCollectionType
     CommandServiceTransportGrpc::deserializeTransactions(
         const iroha::protocol::TxList *request) {
+      using BuildResult = iroha::expected::Result<
+          std::unique_ptr<shared_model::interface::Transaction>,
+          TransportFactoryType::Error>;
+
       shared_model::interface::types::SharedTxsCollectionType tx_collection;
-      for (const auto &tx : request->transactions()) {
-        transaction_factory_->build(tx).match(
-            [&tx_collection](auto &&v) {
-              tx_collection.emplace_back(std::move(v).value);
-            },
-            [this](const auto &error) {
-              status_bus_->publish(status_factory_->makeStatelessFail(
-                  error.error.hash,
-                  shared_model::interface::TxStatusFactory::TransactionError{
-                      error.error.error, 0, 0}));
-            });
-      }
+      tx_collection.reserve(request->transactions_size());
+      forEachChunk(
+          validation_pool_,
+          request->transactions_size(),
+          [this, request](std::pair<size_t, size_t> range) {
+            // transactions of a chunk are copied to a single arena, which is
+            // released with the last of them
+            auto arena = std::make_shared<google::protobuf::Arena>();
+            std::vector<BuildResult> results;
+            results.reserve(range.second - range.first);
+            for (auto i = range.first; i < range.second; ++i) {
+              auto &arena_tx = shared_model::proto::copyToArena(
+                  *arena, request->transactions(i));
+              results.push_back(transaction_factory_->build(arena_tx, arena));
+            }
+            return results;
+          },
+          [this, &tx_collection](std::vector<BuildResult> results) {
+            for (auto &result : results) {
+              std::move(result).match(
+                  [&tx_collection](auto &&v) {
+                    tx_collection.emplace_back(std::move(v).value);
+                  },
+                  [this](const auto &error) {
+                    status_bus_->publish(status_factory_->makeStatelessFail(
+                        error.error.hash,
+                        shared_model::interface::TxStatusFactory::
+                            TransactionError{error.error.error, 0, 0}));
+                  });
+            }
+          });
       return tx_collection;
     }
 
@@ -117,35 +202,79 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxList *request,
         google::protobuf::Empty *response) {
+      using BatchResult =
+          shared_model::interface::TransactionBatchFactory::FactoryResult<
+              std::unique_ptr<shared_model::interface::TransactionBatch>>;
+
+      // stages are timed separately, validation of the batches runs on the
+      // workers at the same time as the handling of the validated ones
+      auto stage_start = std::chrono::steady_clock::now();
       auto transactions = deserializeTransactions(request);
+      auto transactions_time = lap(stage_start);
 
       auto batches = batch_parser_->parseBatches(transactions);
+      auto parsing_time = lap(stage_start);
 
-      for (auto &batch : batches) {
-        batch_factory_->createTransactionBatch(batch).match(
-            [&](auto &&value) {
-              this->command_service_->handleTransactionBatch(
-                  std::move(value).value);
-            },
-            [&](const auto &error) {
-              std::vector<shared_model::crypto::Hash> hashes;
-
-              std::transform(batch.begin(),
-                             batch.end(),
-                             std::back_inserter(hashes),
-                             [](const auto &tx) { return tx->hash(); });
-
-              auto error_msg = formErrorMessage(hashes, error.error);
-              // set error response for each transaction in a batch candidate
-              std::for_each(
-                  hashes.begin(), hashes.end(), [this, &error_msg](auto &hash) {
-                    status_bus_->publish(status_factory_->makeStatelessFail(
-                        hash,
-                        shared_model::interface::TxStatusFactory::
-                            TransactionError{error_msg, 0, 0}));
+      size_t next_batch = 0;
+      std::chrono::steady_clock::duration handling_time{};
+      forEachChunk(
+          validation_pool_,
+          batches.size(),
+          [this, &batches](std::pair<size_t, size_t> range) {
+            std::vector<BatchResult> results;
+            results.reserve(range.second - range.first);
+            for (auto i = range.first; i < range.second; ++i) {
+              results.push_back(
+                  batch_factory_->createTransactionBatch(batches[i]));
+            }
+            return results;
+          },
+          [&](std::vector<BatchResult> results) {
+            auto handling_start = std::chrono::steady_clock::now();
+            for (auto &result : results) {
+              const auto &batch = batches[next_batch++];
+              std::move(result).match(
+                  [&](auto &&value) {
+                    this->command_service_->handleTransactionBatch(
+                        std::move(value).value);
+                  },
+                  [&](const auto &error) {
+                    std::vector<shared_model::crypto::Hash> hashes;
+
+                    std::transform(batch.begin(),
+                                   batch.end(),
+                                   std::back_inserter(hashes),
+                                   [](const auto &tx) { return tx->hash(); });
+
+                    auto error_msg = formErrorMessage(hashes, error.error);
+                    // set error response for each transaction in a batch
+                    // candidate
+                    std::for_each(
+                        hashes.begin(),
+                        hashes.end(),
+                        [this, &error_msg](auto &hash) {
+                          status_bus_->publish(
+                              status_factory_->makeStatelessFail(
+                                  hash,
+                                  shared_model::interface::TxStatusFactory::
+                                      TransactionError{error_msg, 0, 0}));
+                        });
                   });
-            });
-      }
+            }
+            handling_time += std::chrono::steady_clock::now() - handling_start;
+          });
+      auto batches_time = lap(stage_start);
+
+      log_->debug(
+          "ListTorii of {} transactions in {} batches: transactions {} us, "
+          "batch parsing {} us, batches {} us, of them handling {} us",
+          request->transactions_size(),
+          batches.size(),
+          transactions_time,
+          parsing_time,
+          batches_time,
+          std::chrono::duration_cast<std::chrono::microseconds>(handling_time)
+              .count());
 
       return grpc::Status::OK;
     }
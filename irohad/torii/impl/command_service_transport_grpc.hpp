@@ -9,6 +9,7 @@
 #include "torii/command_service.hpp"
 
 #include "endpoint.grpc.pb.h"
+#include "common/thread_pool.hpp"
 #include "endpoint.pb.h"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
@@ -119,7 +120,9 @@ namespace iroha {
 
      private:
       /**
-       * Flat map transport transactions to shared model
+       * Flat map transport transactions to shared model. Chunks of large
+       * lists are built and validated on the validation pool, the order of
+       * the transactions and of the published errors is kept
        */
       shared_model::interface::types::SharedTxsCollectionType
       deserializeTransactions(const iroha::protocol::TxList *request);
@@ -136,6 +139,10 @@ namespace iroha {
 
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
       const int maximum_rounds_without_update_;
+
+      /// validates the chunks of large lists of all the concurrent requests,
+      /// it is declared last to be stopped before the rest of the service
+      ThreadPool validation_pool_;
     };
   }  // namespace torii
 }  // namespace iroha
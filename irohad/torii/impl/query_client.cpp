@@ -47,6 +47,19 @@ namespace torii_utils {
     return stub_->Find(&context, query, &response);
   }
 
+  std::vector<iroha::protocol::QueryResponse> QuerySyncClient::FindStream(
+      const iroha::protocol::Query &query) const {
+    grpc::ClientContext context;
+    auto reader = stub_->FindStream(&context, query);
+    std::vector<iroha::protocol::QueryResponse> responses;
+    iroha::protocol::QueryResponse resp;
+    while (reader->Read(&resp)) {
+      responses.push_back(resp);
+    }
+    reader->Finish();
+    return responses;
+  }
+
   std::vector<iroha::protocol::BlockQueryResponse>
   QuerySyncClient::FetchCommits(
       const iroha::protocol::BlocksQuery &blocks_query) const {
@@ -13,6 +13,15 @@
 #include "logger/logger.hpp"
 #include "validators/default_validator.hpp"
 
+namespace {
+  /// @return hash of the query payload, which identifies the query
+  shared_model::crypto::Hash makeQueryHash(
+      const iroha::protocol::Query &request) {
+    auto blobPayload = shared_model::proto::makeBlob(request.payload());
+    return shared_model::crypto::DefaultHashProvider::makeHash(blobPayload);
+  }
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -28,9 +37,7 @@ namespace iroha {
 
     void QueryService::Find(iroha::protocol::Query const &request,
                             iroha::protocol::QueryResponse &response) {
-      shared_model::crypto::Hash hash;
-      auto blobPayload = shared_model::proto::makeBlob(request.payload());
-      hash = shared_model::crypto::DefaultHashProvider::makeHash(blobPayload);
+      auto hash = makeQueryHash(request);
 
       if (cache_.findItem(hash)) {
         // Query was already processed
@@ -65,6 +72,58 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
+    grpc::Status QueryService::FindStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::Query *request,
+        grpc::ServerWriter<iroha::protocol::QueryResponse> *writer) {
+      auto hash = makeQueryHash(*request);
+
+      if (cache_.findItem(hash)) {
+        // Query was already processed
+        iroha::protocol::QueryResponse response;
+        response.mutable_error_response()->set_reason(
+            iroha::protocol::ErrorResponse::STATELESS_INVALID);
+        writer->WriteLast(response, grpc::WriteOptions());
+        return grpc::Status::OK;
+      }
+
+      query_factory_->build(*request).match(
+          [this, context, writer, &hash](const auto &query) {
+            // every part is written before the next one is read from the
+            // ledger, and Write blocks while the client is not ready to
+            // take the part; no query session is held while it blocks
+            query_processor_->queryHandleStream(
+                *query.value, [this, context, writer](auto response) {
+                  if (context->IsCancelled()) {
+                    log_->debug("Query stream is cancelled");
+                    return false;
+                  }
+                  if (not writer->Write(
+                          static_cast<shared_model::proto::QueryResponse &>(
+                              *response)
+                              .getTransport())) {
+                    log_->debug("Query stream appears to be closed");
+                    return false;
+                  }
+                  return true;
+                });
+            // TODO 18.02.2019 lebdron: IR-336 Replace cache
+            // 0 is used as a dummy value
+            cache_.addItem(hash, 0);
+          },
+          [writer, &hash](auto &&error) {
+            iroha::protocol::QueryResponse response;
+            response.set_query_hash(hash.hex());
+            response.mutable_error_response()->set_reason(
+                iroha::protocol::ErrorResponse::STATELESS_INVALID);
+            response.mutable_error_response()->set_message(
+                std::move(error.error.error));
+            writer->WriteLast(response, grpc::WriteOptions());
+          });
+
+      return grpc::Status::OK;
+    }
+
     grpc::Status QueryService::FetchCommits(
         grpc::ServerContext *context,
         const iroha::protocol::BlocksQuery *request,
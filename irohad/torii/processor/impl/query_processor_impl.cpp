@@ -7,14 +7,32 @@
 
 #include <boost/range/size.hpp>
 #include "common/bind.hpp"
+#include "common/visitor.hpp"
 #include "interfaces/queries/blocks_query.hpp"
 #include "interfaces/queries/query.hpp"
 #include "interfaces/query_responses/block_query_response.hpp"
 #include "interfaces/query_responses/block_response.hpp"
 #include "interfaces/query_responses/query_response.hpp"
+#include "interfaces/query_responses/transactions_page_response.hpp"
 #include "logger/logger.hpp"
 #include "validation/utils.hpp"
 
+namespace {
+  /// @return hash of the first transaction of the next page of the response
+  boost::optional<shared_model::interface::types::HashType> getNextTxHash(
+      const shared_model::interface::QueryResponse &response) {
+    return iroha::visit_in_place(
+        response.get(),
+        [](const shared_model::interface::TransactionsPageResponse &page) {
+          return page.nextTxHash();
+        },
+        [](const auto &)
+            -> boost::optional<shared_model::interface::types::HashType> {
+          return boost::none;
+        });
+  }
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -24,14 +42,27 @@ namespace iroha {
         std::shared_ptr<iroha::PendingTransactionStorage> pending_transactions,
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
             response_factory,
+        std::shared_ptr<QueryResultCache> result_cache,
         logger::LoggerPtr log)
         : storage_{std::move(storage)},
           qry_exec_{std::move(qry_exec)},
           pending_transactions_{std::move(pending_transactions)},
           response_factory_{std::move(response_factory)},
+          result_cache_{std::move(result_cache)},
           log_{std::move(log)} {
       storage_->on_commit().subscribe(
           [this](std::shared_ptr<const shared_model::interface::Block> block) {
+            if (result_cache_) {
+              result_cache_->invalidate(*block);
+              auto statistics = result_cache_->statistics();
+              log_->debug(
+                  "Query result cache: {} hits, {} misses, {} ms saved",
+                  statistics.hits,
+                  statistics.misses,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                      statistics.saved_time)
+                      .count());
+            }
             auto block_response =
                 response_factory_->createBlockQueryResponse(block);
             blocks_query_subject_.get_subscriber().on_next(
@@ -41,16 +72,72 @@ namespace iroha {
 
     std::unique_ptr<shared_model::interface::QueryResponse>
     QueryProcessorImpl::queryHandle(const shared_model::interface::Query &qry) {
+      if (not result_cache_ or not QueryResultCache::isCacheable(qry)) {
+        return executeQuery(qry);
+      }
+      if (auto response = result_cache_->find(qry)) {
+        return response_factory_->copyQueryResponse(*response, qry.hash());
+      }
+
+      auto generation = result_cache_->generation();
+      auto start = std::chrono::steady_clock::now();
+      auto response = executeQuery(qry);
+      if (response) {
+        result_cache_->insert(qry,
+                              *response,
+                              std::chrono::steady_clock::now() - start,
+                              generation);
+      }
+      return response;
+    }
+
+    std::unique_ptr<shared_model::interface::QueryResponse>
+    QueryProcessorImpl::executeQuery(
+        const shared_model::interface::Query &qry) {
       auto executor = qry_exec_->createQueryExecutor(pending_transactions_,
                                                      response_factory_);
       if (not executor) {
-        log_->error("Cannot create query executor");
-        return nullptr;
+        return noExecutorResponse(qry);
       }
 
       return executor.value()->validateAndExecute(qry, true);
     }
 
+    void QueryProcessorImpl::queryHandleStream(
+        const shared_model::interface::Query &qry,
+        const QueryResponseSink &sink) {
+      boost::optional<shared_model::interface::types::HashType> first_tx_hash;
+      std::unique_ptr<shared_model::interface::QueryResponse> response;
+      do {
+        // every page is read by its own executor, so the query session and
+        // the admission permit are not held while the sink waits for a slow
+        // client
+        auto executor = qry_exec_->createQueryExecutor(pending_transactions_,
+                                                       response_factory_);
+        if (not executor) {
+          sink(noExecutorResponse(qry));
+          return;
+        }
+        response =
+            executor.value()->validateAndExecutePage(qry, true, first_tx_hash);
+        executor = boost::none;
+        first_tx_hash = getNextTxHash(*response);
+      } while (sink(std::move(response)) and first_tx_hash);
+    }
+
+    std::unique_ptr<shared_model::interface::QueryResponse>
+    QueryProcessorImpl::noExecutorResponse(
+        const shared_model::interface::Query &qry) {
+      log_->error("Cannot create query executor");
+      // code 1 stands for an internal error in all query responses
+      return response_factory_->createErrorQueryResponse(
+          shared_model::interface::QueryResponseFactory::ErrorQueryType::
+              kStatefulFailed,
+          "no database connection is available for the query",
+          1,
+          qry.hash());
+    }
+
     rxcpp::observable<
         std::shared_ptr<shared_model::interface::BlockQueryResponse>>
     QueryProcessorImpl::blocksQueryHandle(
@@ -0,0 +1,283 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/processor/query_result_cache.hpp"
+
+#include <algorithm>
+#include <set>
+
+#include <boost/optional.hpp>
+#include "common/cloneable.hpp"
+#include "common/visitor.hpp"
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/queries/get_account.hpp"
+#include "interfaces/queries/get_account_assets.hpp"
+#include "interfaces/queries/get_role_permissions.hpp"
+#include "interfaces/queries/get_signatories.hpp"
+#include "interfaces/queries/query.hpp"
+#include "interfaces/queries/query_variant.hpp"
+#include "interfaces/query_responses/error_query_response.hpp"
+#include "interfaces/query_responses/query_response.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  using shared_model::interface::types::AccountIdType;
+
+  /// Payload of a cacheable query and the accounts it depends on
+  struct CacheableQuery {
+    std::string payload;
+    /// accounts, which are read to respond to the query besides the creator
+    std::vector<AccountIdType> accounts;
+  };
+
+  /// @return payload and accounts of the query, none if it is not cacheable
+  boost::optional<CacheableQuery> getCacheableQuery(
+      const shared_model::interface::Query &query) {
+    using ReturnType = boost::optional<CacheableQuery>;
+    return iroha::visit_in_place(
+        query.get(),
+        [](const shared_model::interface::GetAccount &q) -> ReturnType {
+          return CacheableQuery{q.toString(), {q.accountId()}};
+        },
+        [](const shared_model::interface::GetAccountAssets &q) -> ReturnType {
+          return CacheableQuery{q.toString(), {q.accountId()}};
+        },
+        [](const shared_model::interface::GetSignatories &q) -> ReturnType {
+          return CacheableQuery{q.toString(), {q.accountId()}};
+        },
+        [](const shared_model::interface::GetRolePermissions &q)
+            -> ReturnType { return CacheableQuery{q.toString(), {}}; },
+        [](const auto &) -> ReturnType { return boost::none; });
+  }
+
+  /**
+   * @return key of the query, which consists of its creator, signatories and
+   * payload
+   */
+  std::string makeKey(const shared_model::interface::Query &query,
+                      const std::string &payload) {
+    std::vector<std::string> public_keys;
+    for (const auto &signature : query.signatures()) {
+      public_keys.push_back(
+          shared_model::crypto::toBinaryString(signature.publicKey()));
+    }
+    std::sort(public_keys.begin(), public_keys.end());
+
+    std::string key = query.creatorAccountId() + "\n";
+    for (const auto &public_key : public_keys) {
+      key += public_key + ",";
+    }
+    return key + "\n" + payload;
+  }
+
+  /// Accounts changed by the commands of a block
+  struct ChangedAccounts {
+    std::set<AccountIdType> accounts;
+    /// roles or permissions are changed, which can affect any response
+    bool everything = false;
+  };
+
+  ChangedAccounts getChangedAccounts(
+      const shared_model::interface::Block &block) {
+    ChangedAccounts changed;
+    for (const auto &tx : block.transactions()) {
+      const auto &creator_id = tx.creatorAccountId();
+      for (const auto &command : tx.commands()) {
+        iroha::visit_in_place(
+            command.get(),
+            [&](const shared_model::interface::AddAssetQuantity &) {
+              changed.accounts.insert(creator_id);
+            },
+            [&](const shared_model::interface::SubtractAssetQuantity &) {
+              changed.accounts.insert(creator_id);
+            },
+            [&](const shared_model::interface::TransferAsset &c) {
+              changed.accounts.insert(c.srcAccountId());
+              changed.accounts.insert(c.destAccountId());
+            },
+            [&](const shared_model::interface::AddSignatory &c) {
+              changed.accounts.insert(c.accountId());
+            },
+            [&](const shared_model::interface::RemoveSignatory &c) {
+              changed.accounts.insert(c.accountId());
+            },
+            [&](const shared_model::interface::SetQuorum &c) {
+              changed.accounts.insert(c.accountId());
+            },
+            [&](const shared_model::interface::SetAccountDetail &c) {
+              changed.accounts.insert(c.accountId());
+            },
+            [&](const shared_model::interface::CreateAccount &c) {
+              changed.accounts.insert(c.accountName() + "@" + c.domainId());
+            },
+            [](const shared_model::interface::AddPeer &) {},
+            [](const shared_model::interface::CreateAsset &) {},
+            [](const shared_model::interface::CreateDomain &) {},
+            [&](const shared_model::interface::AppendRole &) {
+              changed.everything = true;
+            },
+            [&](const shared_model::interface::DetachRole &) {
+              changed.everything = true;
+            },
+            [&](const shared_model::interface::CreateRole &) {
+              changed.everything = true;
+            },
+            [&](const shared_model::interface::GrantPermission &) {
+              changed.everything = true;
+            },
+            [&](const shared_model::interface::RevokePermission &) {
+              changed.everything = true;
+            });
+      }
+    }
+    return changed;
+  }
+
+  bool isErrorResponse(const shared_model::interface::QueryResponse &response) {
+    return iroha::visit_in_place(
+        response.get(),
+        [](const shared_model::interface::ErrorQueryResponse &) {
+          return true;
+        },
+        [](const auto &) { return false; });
+  }
+}  // namespace
+
+namespace iroha {
+  namespace torii {
+
+    QueryResultCache::QueryResultCache(size_t capacity)
+        : capacity_(capacity) {}
+
+    bool QueryResultCache::isCacheable(
+        const shared_model::interface::Query &query) {
+      return static_cast<bool>(getCacheableQuery(query));
+    }
+
+    QueryResultCache::Generation QueryResultCache::generation() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return generation_;
+    }
+
+    std::shared_ptr<const shared_model::interface::QueryResponse>
+    QueryResultCache::find(const shared_model::interface::Query &query) {
+      auto cacheable = getCacheableQuery(query);
+      if (not cacheable) {
+        return nullptr;
+      }
+      auto key = makeKey(query, cacheable->payload);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entry_by_key_.find(key);
+      if (it == entry_by_key_.end()) {
+        ++statistics_.misses;
+        return nullptr;
+      }
+      ++statistics_.hits;
+      statistics_.saved_time += it->second->execution_time;
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->response;
+    }
+
+    void QueryResultCache::insert(
+        const shared_model::interface::Query &query,
+        const shared_model::interface::QueryResponse &response,
+        std::chrono::nanoseconds execution_time,
+        Generation generation) {
+      auto cacheable = getCacheableQuery(query);
+      if (not cacheable or isErrorResponse(response) or capacity_ == 0) {
+        return;
+      }
+      auto &accounts = cacheable->accounts;
+      accounts.push_back(query.creatorAccountId());
+      std::sort(accounts.begin(), accounts.end());
+      accounts.erase(std::unique(accounts.begin(), accounts.end()),
+                     accounts.end());
+      auto key = makeKey(query, cacheable->payload);
+      std::shared_ptr<const shared_model::interface::QueryResponse> copy =
+          clone(response);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (generation != generation_ or entry_by_key_.count(key) > 0) {
+        return;
+      }
+      if (entries_.size() == capacity_) {
+        erase(std::prev(entries_.end()));
+      }
+      entries_.push_front(Entry{
+          key, std::move(copy), std::move(accounts), execution_time});
+      auto entry = entries_.begin();
+      entry_by_key_.emplace(std::move(key), entry);
+      for (const auto &account_id : entry->accounts) {
+        entries_by_account_.emplace(account_id, entry);
+      }
+    }
+
+    void QueryResultCache::invalidate(
+        const shared_model::interface::Block &block) {
+      auto changed = getChangedAccounts(block);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++generation_;
+      if (changed.everything) {
+        entries_.clear();
+        entry_by_key_.clear();
+        entries_by_account_.clear();
+        return;
+      }
+      for (const auto &account_id : changed.accounts) {
+        auto range = entries_by_account_.equal_range(account_id);
+        std::vector<Entries::iterator> stale;
+        std::transform(range.first,
+                       range.second,
+                       std::back_inserter(stale),
+                       [](const auto &item) { return item.second; });
+        for (auto entry : stale) {
+          erase(entry);
+        }
+      }
+    }
+
+    QueryResultCache::Statistics QueryResultCache::statistics() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return statistics_;
+    }
+
+    void QueryResultCache::erase(Entries::iterator entry) {
+      for (const auto &account_id : entry->accounts) {
+        auto range = entries_by_account_.equal_range(account_id);
+        auto it = std::find_if(range.first,
+                               range.second,
+                               [&entry](const auto &item) {
+                                 return item.second == entry;
+                               });
+        if (it != range.second) {
+          entries_by_account_.erase(it);
+        }
+      }
+      entry_by_key_.erase(entry->key);
+      entries_.erase(entry);
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -8,6 +8,7 @@
 
 #include <rxcpp/rx.hpp>
 
+#include <functional>
 #include <memory>
 
 namespace shared_model {
@@ -34,6 +35,23 @@ namespace iroha {
        */
       virtual std::unique_ptr<shared_model::interface::QueryResponse>
       queryHandle(const shared_model::interface::Query &qry) = 0;
+
+      /**
+       * Consumer of the parts of a streamed response
+       * @return false, if no more parts are needed
+       */
+      using QueryResponseSink = std::function<bool(
+          std::unique_ptr<shared_model::interface::QueryResponse>)>;
+
+      /**
+       * Perform client query, passing its response to the sink in parts as
+       * they are read from the ledger
+       * @param qry - client intent
+       * @param sink - consumer of the response parts
+       */
+      virtual void queryHandleStream(const shared_model::interface::Query &qry,
+                                     const QueryResponseSink &sink) = 0;
+
       /**
        * Register client blocks query
        * @param query - client intent
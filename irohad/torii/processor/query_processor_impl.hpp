@@ -10,6 +10,7 @@
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "torii/processor/query_processor.hpp"
+#include "torii/processor/query_result_cache.hpp"
 
 namespace iroha {
   namespace torii {
@@ -19,6 +20,10 @@ namespace iroha {
      */
     class QueryProcessorImpl : public QueryProcessor {
      public:
+      /**
+       * @param result_cache - cache of query responses, which is invalidated
+       * on commits; queries are always executed if it is nullptr
+       */
       QueryProcessorImpl(
           std::shared_ptr<ametsuchi::Storage> storage,
           std::shared_ptr<ametsuchi::QueryExecutorFactory> qry_exec,
@@ -26,17 +31,28 @@ namespace iroha {
               pending_transactions,
           std::shared_ptr<shared_model::interface::QueryResponseFactory>
               response_factory,
+          std::shared_ptr<QueryResultCache> result_cache,
           logger::LoggerPtr log);
 
       std::unique_ptr<shared_model::interface::QueryResponse> queryHandle(
           const shared_model::interface::Query &qry) override;
 
+      void queryHandleStream(const shared_model::interface::Query &qry,
+                             const QueryResponseSink &sink) override;
+
       rxcpp::observable<
           std::shared_ptr<shared_model::interface::BlockQueryResponse>>
       blocksQueryHandle(
           const shared_model::interface::BlocksQuery &qry) override;
 
      private:
+      std::unique_ptr<shared_model::interface::QueryResponse> executeQuery(
+          const shared_model::interface::Query &qry);
+
+      /// @return error response to the query, when there is no executor
+      std::unique_ptr<shared_model::interface::QueryResponse>
+      noExecutorResponse(const shared_model::interface::Query &qry);
+
       rxcpp::subjects::subject<
           std::shared_ptr<shared_model::interface::BlockQueryResponse>>
           blocks_query_subject_;
@@ -45,6 +61,7 @@ namespace iroha {
       std::shared_ptr<iroha::PendingTransactionStorage> pending_transactions_;
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
           response_factory_;
+      std::shared_ptr<QueryResultCache> result_cache_;
 
       logger::LoggerPtr log_;
     };
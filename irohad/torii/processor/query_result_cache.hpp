@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_QUERY_RESULT_CACHE_HPP
+#define IROHA_QUERY_RESULT_CACHE_HPP
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Query;
+    class QueryResponse;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Cache of responses to the queries, which are polled by clients at high
+     * rates and read a small part of WSV: GetAccount, GetAccountAssets,
+     * GetSignatories and GetRolePermissions. Responses are kept for the
+     * creator, the signatories and the payload of the query, so that a hit
+     * is only possible for the signatories, which have already passed the
+     * stateful validation.
+     *
+     * Each response depends on the accounts, which are read to build it,
+     * including the query creator. When a block is committed, the responses
+     * depending on the accounts changed by the block are dropped. Blocks,
+     * which change roles or permissions, drop all the responses.
+     *
+     * Each invalidation starts a new generation, and a response is only
+     * stored if no invalidation happened since its generation was read.
+     */
+    class QueryResultCache {
+     public:
+      using Generation = uint64_t;
+
+      /// Effectiveness of the cache
+      struct Statistics {
+        /// number of queries answered from the cache
+        uint64_t hits;
+        /// number of cacheable queries, which were executed
+        uint64_t misses;
+        /// execution time of the queries answered from the cache
+        std::chrono::nanoseconds saved_time;
+      };
+
+      /**
+       * @param capacity - maximum number of cached responses, the least
+       * recently used response is dropped when it is exceeded
+       */
+      explicit QueryResultCache(size_t capacity);
+
+      /// @return true if responses to the query can be cached
+      static bool isCacheable(const shared_model::interface::Query &query);
+
+      /// @return current generation, which must be read before the execution
+      Generation generation() const;
+
+      /**
+       * Find response to the query, counting a hit or a miss
+       * @return cached response, nullptr if there is none
+       */
+      std::shared_ptr<const shared_model::interface::QueryResponse> find(
+          const shared_model::interface::Query &query);
+
+      /**
+       * Store response to the query if it is cacheable and is not an error
+       * @param execution_time - time spent to execute the query
+       * @param generation - generation read before the query was executed
+       */
+      void insert(const shared_model::interface::Query &query,
+                  const shared_model::interface::QueryResponse &response,
+                  std::chrono::nanoseconds execution_time,
+                  Generation generation);
+
+      /// Drop the responses, which could be changed by the committed block
+      void invalidate(const shared_model::interface::Block &block);
+
+      /// @return effectiveness of the cache since its creation
+      Statistics statistics() const;
+
+     private:
+      struct Entry {
+        std::string key;
+        std::shared_ptr<const shared_model::interface::QueryResponse>
+            response;
+        std::vector<shared_model::interface::types::AccountIdType> accounts;
+        std::chrono::nanoseconds execution_time;
+      };
+      using Entries = std::list<Entry>;
+
+      void erase(Entries::iterator entry);
+
+      const size_t capacity_;
+
+      mutable std::mutex mutex_;
+      Generation generation_ = 0;
+      /// entries in the order of use, the most recently used is the first
+      Entries entries_;
+      std::unordered_map<std::string, Entries::iterator> entry_by_key_;
+      std::unordered_multimap<shared_model::interface::types::AccountIdType,
+                              Entries::iterator>
+          entries_by_account_;
+      Statistics statistics_{0, 0, std::chrono::nanoseconds::zero()};
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // IROHA_QUERY_RESULT_CACHE_HPP
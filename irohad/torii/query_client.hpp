@@ -37,6 +37,14 @@ namespace torii_utils {
     grpc::Status Find(const iroha::protocol::Query &query,
                       iroha::protocol::QueryResponse &response) const;
 
+    /**
+     * Requests query and reads the parts of its response
+     * @param query - contains Query what clients request.
+     * @return parts of the response in the order they are received
+     */
+    std::vector<iroha::protocol::QueryResponse> FindStream(
+        const iroha::protocol::Query &query) const;
+
     std::vector<iroha::protocol::BlockQueryResponse> FetchCommits(
         const iroha::protocol::BlocksQuery &blocks_query) const;
 
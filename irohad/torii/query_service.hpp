@@ -64,6 +64,15 @@ namespace iroha {
                         const iroha::protocol::Query *request,
                         iroha::protocol::QueryResponse *response) override;
 
+      /**
+       * Execute query, writing its response to the stream in parts, e.g. one
+       * page of transactions at a time
+       */
+      grpc::Status FindStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::Query *request,
+          grpc::ServerWriter<iroha::protocol::QueryResponse> *writer) override;
+
       grpc::Status FetchCommits(
           grpc::ServerContext *context,
           const iroha::protocol::BlocksQuery *request,
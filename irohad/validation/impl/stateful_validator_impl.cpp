@@ -5,7 +5,10 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <chrono>
+#include <numeric>
 #include <string>
+#include <thread>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/format.hpp>
@@ -15,23 +18,29 @@
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "logger/logger.hpp"
+#include "validation/impl/transaction_conflicts.hpp"
 #include "validation/utils.hpp"
 
 namespace iroha {
   namespace validation {
 
+    /// Maximum time a worker waits for a database session, before its
+    /// batches are left to the serial validation
+    static constexpr std::chrono::milliseconds kWorkerSessionMaxWait{100};
+
     /**
      * Complements initial transaction check with command-by-command check
-     * @param temporary_wsv to apply commands on
+     * @param apply - function applying the transaction to temporary wsv
      * @param transactions_errors_log to write errors to
      * @param tx to be checked
      * @return empty result, if check is successful, command error otherwise
      */
+    template <typename ApplyTransaction>
     static bool checkTransactions(
-        ametsuchi::TemporaryWsv &temporary_wsv,
+        ApplyTransaction &&apply,
         validation::TransactionsErrors &transactions_errors_log,
         const shared_model::interface::Transaction &tx) {
-      return temporary_wsv.apply(tx).match(
+      return apply(tx).match(
           [](const auto &) { return true; },
           [&tx, &transactions_errors_log](auto &&error) {
             transactions_errors_log.emplace_back(validation::TransactionError{
@@ -40,86 +49,244 @@ namespace iroha {
           });
     };
 
+    /// @return true if the transactions form an atomic batch
+    static bool isAtomicBatch(
+        const shared_model::interface::types::TransactionsCollectionType
+            &batch) {
+      return batch.front().batchMeta()
+          and batch.front().batchMeta()->get()->type()
+          == shared_model::interface::types::BatchType::ATOMIC;
+    }
+
     /**
-     * Validate all transactions supplied; includes special rules, such as batch
-     * validation etc
-     * @param txs to be validated
+     * Validate transactions of one batch; includes special rules, such as
+     * batch atomicity
+     * @param batch to be validated
      * @param temporary_wsv to apply transactions on
-     * @param transactions_errors_log to write errors to
-     * @param batch_parser to parse batches from transaction range
-     * @return range of transactions, which passed stateful validation
+     * @param apply - function applying a transaction to temporary_wsv
+     * @return validation result of each transaction and errors of rejected
+     * ones in the order they were found
      */
-    static auto validateTransactions(
-        const shared_model::interface::types::TransactionsCollectionType &txs,
+    template <typename ApplyTransaction>
+    static StatefulValidatorImpl::BatchResult validateBatch(
+        const shared_model::interface::types::TransactionsCollectionType
+            &batch,
         ametsuchi::TemporaryWsv &temporary_wsv,
-        validation::TransactionsErrors &transactions_errors_log,
-        const shared_model::interface::TransactionBatchParser &batch_parser) {
-      std::vector<bool> validation_results;
-      validation_results.reserve(boost::size(txs));
-
-      for (auto batch : batch_parser.parseBatches(txs)) {
-        auto validation = [&](auto &tx) {
-          return checkTransactions(temporary_wsv, transactions_errors_log, tx);
-        };
-        if (batch.front().batchMeta()
-            and batch.front().batchMeta()->get()->type()
-                == shared_model::interface::types::BatchType::ATOMIC) {
-          // check all batch's transactions for validness
-          auto savepoint = temporary_wsv.createSavepoint(
-              "batch_" + batch.front().hash().hex());
-          bool validation_result = false;
-
-          if (boost::algorithm::all_of(batch, validation)) {
-            // batch is successful; release savepoint
-            validation_result = true;
-            savepoint->release();
-          } else {
-            auto failed_tx_hash = transactions_errors_log.back().tx_hash;
-            for (const auto &tx : batch) {
-              if (tx.hash() != failed_tx_hash) {
-                transactions_errors_log.emplace_back(
-                    validation::TransactionError{
-                        tx.hash(),
-                        // TODO igor-egorov 22.01.2019 IR-245 add a separate
-                        // error code for failed batch case
-                        validation::CommandError{
-                            "",
-                            1,  // internal error code
-                            "Another transaction failed the batch",
-                            true,
-                            std::numeric_limits<size_t>::max()}});
-              }
-            }
-          }
+        ApplyTransaction &&apply) {
+      StatefulValidatorImpl::BatchResult result;
+      auto &transactions_errors_log = result.errors;
+      auto validation = [&](auto &tx) {
+        return checkTransactions(apply, transactions_errors_log, tx);
+      };
+      if (isAtomicBatch(batch)) {
+        // check all batch's transactions for validness
+        auto savepoint = temporary_wsv.createSavepoint(
+            "batch_" + batch.front().hash().hex());
+        bool validation_result = false;
 
-          validation_results.insert(
-              validation_results.end(), boost::size(batch), validation_result);
+        if (boost::algorithm::all_of(batch, validation)) {
+          // batch is successful; release savepoint
+          validation_result = true;
+          savepoint->release();
         } else {
+          auto failed_tx_hash = transactions_errors_log.back().tx_hash;
           for (const auto &tx : batch) {
-            validation_results.push_back(validation(tx));
+            if (tx.hash() != failed_tx_hash) {
+              transactions_errors_log.emplace_back(validation::TransactionError{
+                  tx.hash(),
+                  // TODO igor-egorov 22.01.2019 IR-245 add a separate
+                  // error code for failed batch case
+                  validation::CommandError{
+                      "",
+                      1,  // internal error code
+                      "Another transaction failed the batch",
+                      true,
+                      std::numeric_limits<size_t>::max()}});
+            }
           }
         }
+
+        result.validation_results.assign(boost::size(batch), validation_result);
+      } else {
+        for (const auto &tx : batch) {
+          result.validation_results.push_back(validation(tx));
+        }
       }
+      return result;
+    }
 
-      return txs | boost::adaptors::indexed()
-          | boost::adaptors::filtered(
-                 [validation_results =
-                      std::move(validation_results)](const auto &el) {
-                   return validation_results.at(el.index());
-                 })
-          | boost::adaptors::transformed(
-                 [](const auto &el) -> decltype(auto) { return el.value(); });
+    /**
+     * Validate batches one after another on the temporary wsv
+     * @param batches - all batches of the proposal
+     * @param indices - indices of the batches to be validated, ascending
+     * @param temporary_wsv to apply transactions on
+     * @param results - validation results of all batches
+     */
+    static void validateBatches(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches,
+        const std::vector<size_t> &indices,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        std::vector<StatefulValidatorImpl::BatchResult> &results) {
+      auto apply = [&temporary_wsv](const auto &tx) {
+        return temporary_wsv.apply(tx);
+      };
+      for (auto index : indices) {
+        results[index] = validateBatch(batches[index], temporary_wsv, apply);
+      }
+    }
+
+    /**
+     * Apply transactions of a batch, which was validated on another
+     * temporary wsv. Transactions, which unexpectedly fail to be applied, are
+     * marked as rejected
+     * @param batch to be applied
+     * @param temporary_wsv to apply transactions on
+     * @param result - validation result of the batch
+     */
+    static void replayBatch(
+        const shared_model::interface::types::TransactionsCollectionType
+            &batch,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        StatefulValidatorImpl::BatchResult &result) {
+      auto apply = [&temporary_wsv](const auto &tx) {
+        return temporary_wsv.applyValidated(tx);
+      };
+      if (isAtomicBatch(batch)) {
+        if (result.validation_results.front()) {
+          result = validateBatch(batch, temporary_wsv, apply);
+        }
+        return;
+      }
+      size_t index = 0;
+      for (const auto &tx : batch) {
+        if (result.validation_results[index]) {
+          result.validation_results[index] =
+              checkTransactions(apply, result.errors, tx);
+        }
+        ++index;
+      }
     }
 
     StatefulValidatorImpl::StatefulValidatorImpl(
         std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory,
-        std::shared_ptr<shared_model::interface::TransactionBatchParser>
-            batch_parser,
+        std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory,
+        size_t workers_number,
         logger::LoggerPtr log)
         : factory_(std::move(factory)),
-          batch_parser_(std::move(batch_parser)),
+          temporary_factory_(std::move(temporary_factory)),
+          workers_number_(workers_number),
           log_(std::move(log)) {}
 
+    void StatefulValidatorImpl::validateInParallel(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        std::vector<BatchResult> &results) const {
+      std::vector<size_t> all_batches(batches.size());
+      std::iota(all_batches.begin(), all_batches.end(), 0);
+      if (workers_number_ < 2 or not temporary_factory_
+          or batches.size() < 2) {
+        validateBatches(batches, all_batches, temporary_wsv, results);
+        return;
+      }
+
+      std::vector<KeySet> key_sets;
+      key_sets.reserve(batches.size());
+      for (const auto &batch : batches) {
+        KeySet keys;
+        for (const auto &tx : batch) {
+          auto tx_keys = transactionKeys(tx);
+          keys.reads.insert(
+              keys.reads.end(), tx_keys.reads.begin(), tx_keys.reads.end());
+          keys.writes.insert(keys.writes.end(),
+                             tx_keys.writes.begin(),
+                             tx_keys.writes.end());
+        }
+        key_sets.push_back(std::move(keys));
+      }
+      auto groups = groupByConflicts(key_sets);
+      if (groups.size() < 2) {
+        validateBatches(batches, all_batches, temporary_wsv, results);
+        return;
+      }
+
+      // assign the largest groups first, each to the least loaded worker
+      auto group_size = [&batches](const std::vector<size_t> &group) {
+        size_t size = 0;
+        for (auto index : group) {
+          size += boost::size(batches[index]);
+        }
+        return size;
+      };
+      std::stable_sort(groups.begin(),
+                       groups.end(),
+                       [&group_size](const auto &lhs, const auto &rhs) {
+                         return group_size(lhs) > group_size(rhs);
+                       });
+      std::vector<std::vector<size_t>> assignments(
+          std::min(workers_number_, groups.size()));
+      std::vector<size_t> loads(assignments.size(), 0);
+      for (const auto &group : groups) {
+        auto worker = std::distance(
+            loads.begin(), std::min_element(loads.begin(), loads.end()));
+        assignments[worker].insert(
+            assignments[worker].end(), group.begin(), group.end());
+        loads[worker] += group_size(group);
+      }
+      for (auto &assignment : assignments) {
+        std::sort(assignment.begin(), assignment.end());
+      }
+      log_->debug("{} independent groups of {} batches on {} workers",
+                  groups.size(),
+                  batches.size(),
+                  assignments.size());
+
+      // the first worker validates on the proposal wsv, the others on their
+      // own temporary wsvs, whose changes are applied to the proposal wsv
+      // afterwards
+      std::vector<char> finished(assignments.size(), false);
+      std::vector<std::thread> workers;
+      for (size_t worker = 1; worker < assignments.size(); ++worker) {
+        workers.emplace_back([&, worker] {
+          try {
+            temporary_factory_->createTemporaryWsv(kWorkerSessionMaxWait)
+                .match(
+                    [&](auto &&wsv) {
+                      validateBatches(
+                          batches, assignments[worker], *wsv.value, results);
+                      finished[worker] = true;
+                    },
+                    [this](const auto &error) {
+                      log_->warn("Could not create temporary wsv: {}",
+                                 error.error);
+                    });
+          } catch (const std::exception &e) {
+            log_->warn("Parallel validation failed: {}", e.what());
+          }
+        });
+      }
+      validateBatches(batches, assignments.front(), temporary_wsv, results);
+      for (auto &worker : workers) {
+        worker.join();
+      }
+
+      // no group writes a key another one reads or writes, so applying
+      // them one after another gives the same state as the serial validation
+      for (size_t worker = 1; worker < assignments.size(); ++worker) {
+        if (not finished[worker]) {
+          validateBatches(
+              batches, assignments[worker], temporary_wsv, results);
+          continue;
+        }
+        for (auto index : assignments[worker]) {
+          replayBatch(batches[index], temporary_wsv, results[index]);
+        }
+      }
+    }
+
     std::unique_ptr<validation::VerifiedProposalAndErrors>
     StatefulValidatorImpl::validate(
         const shared_model::interface::Proposal &proposal,
@@ -128,11 +295,31 @@ namespace iroha {
                  proposal.transactions().size());
 
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
-      auto valid_txs =
-          validateTransactions(proposal.transactions(),
-                               temporaryWsv,
-                               validation_result->rejected_transactions,
-                               *batch_parser_);
+      // the batches are parsed once, when the proposal is made
+      auto batches = proposal.batches();
+      std::vector<BatchResult> results(batches.size());
+      validateInParallel(batches, temporaryWsv, results);
+
+      // merge the results in the order of the proposal
+      std::vector<bool> validation_results;
+      validation_results.reserve(boost::size(proposal.transactions()));
+      auto &transactions_errors_log = validation_result->rejected_transactions;
+      for (auto &result : results) {
+        validation_results.insert(validation_results.end(),
+                                  result.validation_results.begin(),
+                                  result.validation_results.end());
+        std::move(result.errors.begin(),
+                  result.errors.end(),
+                  std::back_inserter(transactions_errors_log));
+      }
+      auto valid_txs = proposal.transactions() | boost::adaptors::indexed()
+          | boost::adaptors::filtered(
+                [validation_results =
+                     std::move(validation_results)](const auto &el) {
+                  return validation_results.at(el.index());
+                })
+          | boost::adaptors::transformed(
+                [](const auto &el) -> decltype(auto) { return el.value(); });
 
       // Since proposal came from ordering gate it was already validated.
       // All transactions are validated as well
@@ -8,7 +8,7 @@
 
 #include "validation/stateful_validator.hpp"
 
-#include "interfaces/iroha_internal/transaction_batch_parser.hpp"
+#include "ametsuchi/temporary_factory.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -17,14 +17,37 @@ namespace iroha {
 
     /**
      * Interface for performing stateful validation
+     *
+     * Batches of the proposal are split into groups, which do not touch the
+     * same accounts, assets, domains, roles, signatories or peers. The groups
+     * are validated in parallel on separate temporary wsvs, and the changes
+     * of the valid transactions are then applied to the proposal wsv. The
+     * resulting state and the rejected transactions are the same as if the
+     * transactions were validated one after another.
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
+      /// Validation result of a batch
+      struct BatchResult {
+        /// result of each batch transaction
+        std::vector<bool> validation_results;
+        /// errors of the rejected transactions in the serial order
+        TransactionsErrors errors;
+      };
+
+      /**
+       * @param factory - factory of verified proposals
+       * @param temporary_factory - factory of worker temporary wsvs, nullptr
+       * disables parallel validation
+       * @param workers_number - maximum number of parallel validations,
+       * including the one on the proposal wsv
+       * @param log - logger
+       */
       StatefulValidatorImpl(
           std::unique_ptr<shared_model::interface::UnsafeProposalFactory>
               factory,
-          std::shared_ptr<shared_model::interface::TransactionBatchParser>
-              batch_parser,
+          std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory,
+          size_t workers_number,
           logger::LoggerPtr log);
 
       std::unique_ptr<validation::VerifiedProposalAndErrors> validate(
@@ -32,9 +55,21 @@ namespace iroha {
           ametsuchi::TemporaryWsv &temporaryWsv) override;
 
      private:
+      /**
+       * Validate the batches, leaving the changes of valid transactions in
+       * temporary_wsv
+       * @param results - validation result of each batch
+       */
+      void validateInParallel(
+          const std::vector<
+              shared_model::interface::types::TransactionsCollectionType>
+              &batches,
+          ametsuchi::TemporaryWsv &temporary_wsv,
+          std::vector<BatchResult> &results) const;
+
       std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory_;
-      std::shared_ptr<shared_model::interface::TransactionBatchParser>
-          batch_parser_;
+      std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory_;
+      size_t workers_number_;
       logger::LoggerPtr log_;
     };
 
@@ -0,0 +1,246 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/transaction_conflicts.hpp"
+
+#include <numeric>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  using namespace shared_model::interface;
+
+  std::string account(const std::string &id) {
+    return "account:" + id;
+  }
+
+  std::string asset(const std::string &id) {
+    return "asset:" + id;
+  }
+
+  std::string balance(const std::string &account_id,
+                      const std::string &asset_id) {
+    return "balance:" + account_id + "/" + asset_id;
+  }
+
+  std::string domain(const std::string &id) {
+    return "domain:" + id;
+  }
+
+  std::string role(const std::string &id) {
+    return "role:" + id;
+  }
+
+  std::string signatory(const std::string &public_key) {
+    return "signatory:" + public_key;
+  }
+
+  std::string peer(const std::string &public_key) {
+    return "peer:" + public_key;
+  }
+
+  /// Appends keys of the visited command to the key set
+  class KeysCollector : public boost::static_visitor<void> {
+   public:
+    KeysCollector(iroha::validation::KeySet &keys, std::string creator)
+        : keys_(keys), creator_(std::move(creator)) {}
+
+    void operator()(const AddAssetQuantity &command) const {
+      read(asset(command.assetId()));
+      write(balance(creator_, command.assetId()));
+    }
+
+    void operator()(const AddPeer &command) const {
+      write(peer(command.peer().pubkey().hex()));
+    }
+
+    void operator()(const AddSignatory &command) const {
+      write(account(command.accountId()));
+      write(signatory(command.pubkey().hex()));
+    }
+
+    void operator()(const AppendRole &command) const {
+      write(account(command.accountId()));
+      read(role(command.roleName()));
+    }
+
+    void operator()(const CreateAccount &command) const {
+      write(account(command.accountName() + "@" + command.domainId()));
+      read(domain(command.domainId()));
+      write(signatory(command.pubkey().hex()));
+    }
+
+    void operator()(const CreateAsset &command) const {
+      write(asset(command.assetName() + "#" + command.domainId()));
+      read(domain(command.domainId()));
+    }
+
+    void operator()(const CreateDomain &command) const {
+      write(domain(command.domainId()));
+      read(role(command.userDefaultRole()));
+    }
+
+    void operator()(const CreateRole &command) const {
+      write(role(command.roleName()));
+    }
+
+    void operator()(const DetachRole &command) const {
+      write(account(command.accountId()));
+      read(role(command.roleName()));
+    }
+
+    // grantable permissions are stored for the pair of accounts
+    void operator()(const GrantPermission &command) const {
+      write(account(creator_));
+      write(account(command.accountId()));
+    }
+
+    void operator()(const RemoveSignatory &command) const {
+      write(account(command.accountId()));
+      write(signatory(command.pubkey().hex()));
+    }
+
+    void operator()(const RevokePermission &command) const {
+      write(account(creator_));
+      write(account(command.accountId()));
+    }
+
+    void operator()(const SetAccountDetail &command) const {
+      write(account(command.accountId()));
+    }
+
+    void operator()(const SetQuorum &command) const {
+      write(account(command.accountId()));
+    }
+
+    void operator()(const SubtractAssetQuantity &command) const {
+      read(asset(command.assetId()));
+      write(balance(creator_, command.assetId()));
+    }
+
+    void operator()(const TransferAsset &command) const {
+      read(account(command.srcAccountId()));
+      read(account(command.destAccountId()));
+      read(asset(command.assetId()));
+      write(balance(command.srcAccountId(), command.assetId()));
+      write(balance(command.destAccountId(), command.assetId()));
+    }
+
+    void read(std::string key) const {
+      keys_.reads.push_back(std::move(key));
+    }
+
+   private:
+    void write(std::string key) const {
+      keys_.writes.push_back(std::move(key));
+    }
+
+    iroha::validation::KeySet &keys_;
+    const std::string creator_;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace validation {
+
+    KeySet transactionKeys(const Transaction &transaction) {
+      KeySet keys;
+      KeysCollector collector(keys, transaction.creatorAccountId());
+      // signatures and permissions of the creator are checked
+      collector.read(account(transaction.creatorAccountId()));
+      for (const auto &command : transaction.commands()) {
+        boost::apply_visitor(collector, command.get());
+      }
+      return keys;
+    }
+
+    std::vector<std::vector<size_t>> groupByConflicts(
+        const std::vector<KeySet> &key_sets) {
+      // disjoint set forest over the items
+      std::vector<size_t> parents(key_sets.size());
+      std::iota(parents.begin(), parents.end(), 0);
+      auto find = [&parents](size_t item) {
+        while (parents[item] != item) {
+          parents[item] = parents[parents[item]];
+          item = parents[item];
+        }
+        return item;
+      };
+
+      auto join = [&parents, &find](size_t lhs, size_t rhs) {
+        auto lhs_root = find(lhs), rhs_root = find(rhs);
+        // the smaller index stays the root, so that it is the first item
+        parents[std::max(lhs_root, rhs_root)] = std::min(lhs_root, rhs_root);
+      };
+
+      // items, which accessed the key so far: the first writer, which all
+      // the later accesses conflict with, or the readers before it, which do
+      // not conflict with each other
+      struct Accesses {
+        boost::optional<size_t> writer;
+        std::vector<size_t> readers;
+      };
+      std::unordered_map<std::string, Accesses> accesses;
+      for (size_t item = 0; item < key_sets.size(); ++item) {
+        for (const auto &key : key_sets[item].writes) {
+          auto &key_accesses = accesses[key];
+          if (key_accesses.writer) {
+            join(*key_accesses.writer, item);
+            continue;
+          }
+          for (auto reader : key_accesses.readers) {
+            join(reader, item);
+          }
+          key_accesses.readers.clear();
+          key_accesses.writer = item;
+        }
+        for (const auto &key : key_sets[item].reads) {
+          auto &key_accesses = accesses[key];
+          if (key_accesses.writer) {
+            join(*key_accesses.writer, item);
+          } else {
+            key_accesses.readers.push_back(item);
+          }
+        }
+      }
+
+      std::vector<std::vector<size_t>> groups;
+      std::unordered_map<size_t, size_t> group_of_root;
+      for (size_t item = 0; item < key_sets.size(); ++item) {
+        auto root = find(item);
+        auto group = group_of_root.emplace(root, groups.size());
+        if (group.second) {
+          groups.emplace_back();
+        }
+        groups[group.first->second].push_back(item);
+      }
+      return groups;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
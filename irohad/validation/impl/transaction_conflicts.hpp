@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRANSACTION_CONFLICTS_HPP
+#define IROHA_TRANSACTION_CONFLICTS_HPP
+
+#include <string>
+#include <vector>
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace validation {
+
+    /// Identifiers of the WSV entries read and written by a transaction
+    struct KeySet {
+      std::vector<std::string> reads;
+      std::vector<std::string> writes;
+    };
+
+    /**
+     * Collect the WSV entries, which validation and execution of the
+     * transaction depend on. The creator account and the accounts, assets,
+     * domains and roles, which the commands only check, are read. Entries
+     * created or changed by the commands are written, and asset balances are
+     * keyed by the account and the asset, so that only the creation of an
+     * asset writes the asset itself. Permissions of an account and
+     * permissions granted by it are covered by the account key. Two
+     * transactions, which do not write an entry the other one reads or
+     * writes, can be applied in any order with the same result
+     * @param transaction - transaction to inspect
+     * @return key set, possibly with duplicates
+     */
+    KeySet transactionKeys(
+        const shared_model::interface::Transaction &transaction);
+
+    /**
+     * Split items into groups, so that no item writes a key, which an item
+     * of another group reads or writes
+     * @param key_sets - key set of each item
+     * @return groups of item indices in ascending order, groups are ordered
+     * by their first item
+     */
+    std::vector<std::vector<size_t>> groupByConflicts(
+        const std::vector<KeySet> &key_sets);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_CONFLICTS_HPP
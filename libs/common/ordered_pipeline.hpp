@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_ORDERED_PIPELINE_HPP
+#define IROHA_COMMON_ORDERED_PIPELINE_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <boost/optional.hpp>
+#include "common/thread_pool.hpp"
+
+namespace iroha {
+
+  /**
+   * Three-stage pipeline with a parallel middle stage.
+   *
+   * Items are pulled from the source on the calling thread, transformed by
+   * the tasks of a shared thread pool and handed to the sink on the calling
+   * thread in the order they were pulled from the source. The source is read
+   * ahead while the transforms run, but at most max_in_flight items are
+   * pulled and not yet passed to the sink, so memory usage stays bounded
+   * however slow the sink is. No threads are started by the pipeline itself.
+   *
+   * The function returns when the source is exhausted and every item has
+   * been passed to the sink, or when the sink asks to stop. In both cases it
+   * waits for the transforms, which are still running.
+   *
+   * @tparam Input - type of the source items
+   * @param source - callable returning boost::optional<Input>, none marks the
+   * end of the sequence
+   * @param transform - callable converting Input to the sink argument. It is
+   * called concurrently from the threads of the pool and must not throw
+   * @param sink - callable accepting the transformed items and returning
+   * false if no more items are needed
+   * @param pool - threads running the transform
+   * @param max_in_flight - maximum number of items pulled from the source, but
+   * not yet passed to the sink
+   */
+  template <typename Input,
+            typename Source,
+            typename Transform,
+            typename Sink>
+  void runOrderedPipeline(Source &&source,
+                          Transform &&transform,
+                          Sink &&sink,
+                          ThreadPool &pool,
+                          size_t max_in_flight) {
+    using Output = decltype(transform(std::declval<Input>()));
+
+    max_in_flight = std::max<size_t>(max_in_flight, 1);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::map<size_t, Output> outputs;
+    size_t running = 0;
+
+    // the tasks reference the local state, so it must outlive them even if
+    // the source or the sink throws
+    struct WaitForTasks {
+      std::mutex &mutex;
+      std::condition_variable &cv;
+      size_t &running;
+      ~WaitForTasks() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return running == 0; });
+      }
+    } wait_for_tasks{mutex, cv, running};
+
+    size_t produced = 0, consumed = 0;
+    bool source_finished = false;
+    auto next_is_ready = [&] {
+      std::lock_guard<std::mutex> lock(mutex);
+      return outputs.count(consumed) > 0;
+    };
+
+    while (true) {
+      // read ahead until the window is full or the next item is transformed
+      while (not source_finished and produced - consumed < max_in_flight
+             and (produced == consumed or not next_is_ready())) {
+        boost::optional<Input> item = source();
+        if (not item) {
+          source_finished = true;
+          break;
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          ++running;
+        }
+        // the item is shared, since the tasks of the pool are copyable
+        auto input = std::make_shared<Input>(std::move(*item));
+        pool.submit([&, index = produced++, input] {
+          auto result = transform(std::move(*input));
+          std::lock_guard<std::mutex> lock(mutex);
+          outputs.emplace(index, std::move(result));
+          --running;
+          // notified under the lock, so the state is not destroyed before
+          // the task releases it
+          cv.notify_all();
+        });
+      }
+      if (consumed == produced) {
+        break;
+      }
+
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [&] { return outputs.count(consumed) > 0; });
+      auto it = outputs.find(consumed);
+      auto result = std::move(it->second);
+      outputs.erase(it);
+      ++consumed;
+      lock.unlock();
+
+      if (not sink(std::move(result))) {
+        break;
+      }
+    }
+  }
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_ORDERED_PIPELINE_HPP
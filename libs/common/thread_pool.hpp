@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_THREAD_POOL_HPP
+#define IROHA_COMMON_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Fixed number of threads running the submitted tasks in the order of
+   * submission. The threads are started once and shared by all the users of
+   * the pool, so the number of threads does not grow with the number of
+   * concurrent requests.
+   *
+   * Tasks must not block on other tasks of the same pool, otherwise the pool
+   * may run out of threads.
+   */
+  class ThreadPool {
+   public:
+    /**
+     * @param threads_number - number of threads, at least one is started
+     */
+    explicit ThreadPool(size_t threads_number) {
+      threads_number = std::max<size_t>(threads_number, 1);
+      threads_.reserve(threads_number);
+      for (size_t i = 0; i < threads_number; ++i) {
+        threads_.emplace_back([this] { run(); });
+      }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// runs the tasks, which are already submitted, and joins the threads
+    ~ThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      cv_.notify_all();
+      for (auto &thread : threads_) {
+        thread.join();
+      }
+    }
+
+    /**
+     * Queue the task to be run on one of the threads
+     * @param task - callable, which must not throw
+     */
+    void submit(std::function<void()> task) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+      }
+      cv_.notify_one();
+    }
+
+    /// @return number of threads of the pool
+    size_t size() const {
+      return threads_.size();
+    }
+
+   private:
+    void run() {
+      while (true) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return stopped_ or not tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+        lock.unlock();
+
+        task();
+      }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopped_ = false;
+    std::vector<std::thread> threads_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_THREAD_POOL_HPP
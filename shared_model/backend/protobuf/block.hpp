@@ -22,6 +22,14 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Create block of a transport object allocated in an arena
+       * @param arena - arena, which owns the transport object, it is kept
+       * alive by the block
+       * @param ref - transport object, which is referenced without copying
+       */
+      Block(std::shared_ptr<google::protobuf::Arena> arena, TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -10,26 +10,46 @@
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
 #include "common/byteutils.hpp"
+#include "cryptography/default_hash_provider.hpp"
+#include "utils/lazy_initializer.hpp"
 
 namespace shared_model {
   namespace proto {
 
     struct Block::Impl {
-      explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
-      explicit Impl(const TransportType &ref) : proto_(ref) {}
+      explicit Impl(TransportType &&ref)
+          : arena_(std::make_shared<google::protobuf::Arena>()),
+            proto_(moveToArena(*arena_, std::move(ref))) {}
+      explicit Impl(const TransportType &ref)
+          : arena_(std::make_shared<google::protobuf::Arena>()),
+            proto_(copyToArena(*arena_, ref)) {}
+      Impl(std::shared_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_(std::move(arena)), proto_(ref) {}
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
-      TransportType proto_;
+      /// owns the transport object, must outlive everything referencing it
+      std::shared_ptr<google::protobuf::Arena> arena_;
+
+      TransportType &proto_;
       iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
 
-      std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
-      }()};
+      /// serialized payload, the hashes of the block and its transactions
+      /// are made of its bytes
+      std::string payload_bytes_{payload_.SerializeAsString()};
+
+      /// wrappers reference the transactions of the transport object, they
+      /// are only made when the transactions are accessed
+      detail::LazyInitializer<std::vector<proto::Transaction>> transactions_{
+          [this] {
+            return makeEmbeddedTransactions(
+                *payload_.mutable_transactions(),
+                payload_bytes_,
+                iroha::protocol::Block_v1::Payload::kTransactionsFieldNumber);
+          }};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      detail::LazyInitializer<interface::types::BlobType> blob_{
+          [this] { return makeBlob(proto_); }};
 
       interface::types::HashType prev_hash_{[this] {
         return interface::types::HashType(
@@ -55,10 +75,12 @@ namespace shared_model {
             return hashes;
           }()};
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      detail::LazyInitializer<interface::types::BlobType> payload_blob_{
+          [this] { return interface::types::BlobType(payload_bytes_); }};
 
-      interface::types::HashType hash_ = makeHash(payload_blob_);
+      interface::types::HashType hash_{crypto::DefaultHashProvider::makeHash(
+          reinterpret_cast<const uint8_t *>(payload_bytes_.data()),
+          payload_bytes_.size())};
     };
 
     Block::Block(Block &&o) noexcept = default;
@@ -71,8 +93,13 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(std::shared_ptr<google::protobuf::Arena> arena,
+                 TransportType &ref) {
+      impl_ = std::make_unique<Block::Impl>(std::move(arena), ref);
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
-      return impl_->transactions_;
+      return *impl_->transactions_;
     }
 
     interface::types::HeightType Block::height() const {
@@ -84,7 +111,7 @@ namespace shared_model {
     }
 
     const interface::types::BlobType &Block::blob() const {
-      return impl_->blob_;
+      return *impl_->blob_;
     }
 
     interface::types::SignatureRangeType Block::signatures() const {
@@ -114,6 +141,7 @@ namespace shared_model {
         return SignatureSetType<proto::Signature>(signatures.begin(),
                                                   signatures.end());
       }();
+      impl_->blob_.invalidate();
       return true;
     }
 
@@ -135,7 +163,7 @@ namespace shared_model {
     }
 
     const interface::types::BlobType &Block::payload() const {
-      return impl_->payload_blob_;
+      return *impl_->payload_blob_;
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
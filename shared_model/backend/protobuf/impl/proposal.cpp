@@ -7,28 +7,60 @@
 
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
+#include "cryptography/default_hash_provider.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "utils/lazy_initializer.hpp"
 
 namespace shared_model {
   namespace proto {
     using namespace interface::types;
 
     struct Proposal::Impl {
-      explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
-
-      explicit Impl(const TransportType &ref) : proto_(ref) {}
-
-      TransportType proto_;
-
-      const std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            proto_.mutable_transactions()->begin(),
-            proto_.mutable_transactions()->end());
-      }()};
-
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      explicit Impl(TransportType &&ref)
+          : arena_(std::make_shared<google::protobuf::Arena>()),
+            proto_(moveToArena(*arena_, std::move(ref))) {}
+
+      explicit Impl(const TransportType &ref)
+          : arena_(std::make_shared<google::protobuf::Arena>()),
+            proto_(copyToArena(*arena_, ref)) {}
+
+      Impl(std::shared_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_(std::move(arena)), proto_(ref) {}
+
+      /// owns the transport object, must outlive everything referencing it
+      std::shared_ptr<google::protobuf::Arena> arena_;
+
+      TransportType &proto_;
+
+      /// serialized proposal, the hashes of the proposal and its transactions
+      /// are made of its bytes
+      std::string bytes_{proto_.SerializeAsString()};
+
+      /// wrappers reference the transactions of the transport object, they
+      /// are only made when the transactions are accessed
+      detail::LazyInitializer<std::vector<proto::Transaction>> transactions_{
+          [this] {
+            return makeEmbeddedTransactions(
+                *proto_.mutable_transactions(),
+                bytes_,
+                iroha::protocol::Proposal::kTransactionsFieldNumber);
+          }};
+
+      /// batch candidates are parsed once and reused by every stage, which
+      /// validates or applies the proposal
+      detail::LazyInitializer<std::vector<TransactionsCollectionType>>
+          batches_{[this] {
+            return interface::TransactionBatchParserImpl().parseBatches(
+                TransactionsCollectionType(*transactions_));
+          }};
+
+      detail::LazyInitializer<interface::types::BlobType> blob_{
+          [this] { return interface::types::BlobType(bytes_); }};
 
       const interface::types::HashType hash_{
-          [this] { return crypto::DefaultHashProvider::makeHash(blob_); }()};
+          crypto::DefaultHashProvider::makeHash(
+              reinterpret_cast<const uint8_t *>(bytes_.data()),
+              bytes_.size())};
     };
 
     Proposal::Proposal(Proposal &&o) noexcept = default;
@@ -41,8 +73,17 @@ namespace shared_model {
       impl_ = std::make_unique<Proposal::Impl>(std::move(ref));
     }
 
+    Proposal::Proposal(std::shared_ptr<google::protobuf::Arena> arena,
+                       TransportType &ref) {
+      impl_ = std::make_unique<Proposal::Impl>(std::move(arena), ref);
+    }
+
     TransactionsCollectionType Proposal::transactions() const {
-      return impl_->transactions_;
+      return *impl_->transactions_;
+    }
+
+    std::vector<TransactionsCollectionType> Proposal::batches() const {
+      return *impl_->batches_;
     }
 
     TimestampType Proposal::createdTime() const {
@@ -54,7 +95,7 @@ namespace shared_model {
     }
 
     const interface::types::BlobType &Proposal::blob() const {
-      return impl_->blob_;
+      return *impl_->blob_;
     }
 
     const Proposal::TransportType &Proposal::getTransport() const {
@@ -76,18 +76,36 @@ ProtoBlockFactory::unsafeCreateBlock(
   return model_proto_block;
 }
 
+template <typename MakeBlock>
 iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
                         std::string>
-ProtoBlockFactory::createBlock(iroha::protocol::Block block) {
+ProtoBlockFactory::validateAndMake(const iroha::protocol::Block &block,
+                                   MakeBlock &&make_block) {
   if (auto errors = proto_validator_->validate(block)) {
     return iroha::expected::makeError(errors.reason());
   }
 
-  std::unique_ptr<shared_model::interface::Block> proto_block =
-      std::make_unique<Block>(std::move(block.block_v1()));
+  std::unique_ptr<shared_model::interface::Block> proto_block = make_block();
   if (auto errors = interface_validator_->validate(*proto_block)) {
     return iroha::expected::makeError(errors.reason());
   }
 
   return iroha::expected::makeValue(std::move(proto_block));
 }
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+ProtoBlockFactory::createBlock(iroha::protocol::Block block) {
+  return validateAndMake(block, [&block] {
+    return std::make_unique<Block>(std::move(*block.mutable_block_v1()));
+  });
+}
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+ProtoBlockFactory::createBlock(std::shared_ptr<google::protobuf::Arena> arena,
+                               iroha::protocol::Block &block) {
+  return validateAndMake(block, [&block, &arena] {
+    return std::make_unique<Block>(std::move(arena), *block.mutable_block_v1());
+  });
+}
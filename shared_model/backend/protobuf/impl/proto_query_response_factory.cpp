@@ -59,9 +59,13 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountAssetResponse(
     std::vector<std::tuple<interface::types::AccountIdType,
                            interface::types::AssetIdType,
                            shared_model::interface::Amount>> assets,
+    interface::types::AccountAssetsNumberType total_assets_number,
+    boost::optional<interface::types::AssetIdType> next_asset_id,
     const crypto::Hash &query_hash) const {
   return createQueryResponse(
-      [assets = std::move(assets)](
+      [assets = std::move(assets),
+       total_assets_number,
+       next_asset_id = std::move(next_asset_id)](
           iroha::protocol::QueryResponse &protocol_query_response) {
         iroha::protocol::AccountAssetResponse *protocol_specific_response =
             protocol_query_response.mutable_account_assets_response();
@@ -71,6 +75,10 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountAssetResponse(
           asset->set_asset_id(std::move(std::get<1>(assets.at(i))));
           asset->set_balance(std::get<2>(assets.at(i)).toStringRepr());
         }
+        protocol_specific_response->set_total_number(total_assets_number);
+        if (next_asset_id) {
+          protocol_specific_response->set_next_asset_id(*next_asset_id);
+        }
       },
       query_hash);
 }
@@ -78,13 +86,24 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountAssetResponse(
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createAccountDetailResponse(
     shared_model::interface::types::DetailType account_detail,
+    interface::types::AccountDetailsNumberType total_number,
+    boost::optional<const interface::AccountDetailRecordId &> next_record_id,
     const crypto::Hash &query_hash) const {
   return createQueryResponse(
-      [account_detail = std::move(account_detail)](
+      [account_detail = std::move(account_detail),
+       total_number,
+       next_record_id](
           iroha::protocol::QueryResponse &protocol_query_response) {
         iroha::protocol::AccountDetailResponse *protocol_specific_response =
             protocol_query_response.mutable_account_detail_response();
         protocol_specific_response->set_detail(account_detail);
+        protocol_specific_response->set_total_number(total_number);
+        if (next_record_id) {
+          auto *protocol_next_record_id =
+              protocol_specific_response->mutable_next_record_id();
+          protocol_next_record_id->set_writer(next_record_id->writer());
+          protocol_next_record_id->set_key(next_record_id->key());
+        }
       },
       query_hash);
 }
@@ -321,6 +340,18 @@ shared_model::proto::ProtoQueryResponseFactory::createRolePermissionsResponse(
       query_hash);
 }
 
+std::unique_ptr<shared_model::interface::QueryResponse>
+shared_model::proto::ProtoQueryResponseFactory::copyQueryResponse(
+    const interface::QueryResponse &response,
+    const crypto::Hash &query_hash) const {
+  auto protocol_query_response =
+      static_cast<const shared_model::proto::QueryResponse &>(response)
+          .getTransport();
+  protocol_query_response.set_query_hash(query_hash.hex());
+  return std::make_unique<shared_model::proto::QueryResponse>(
+      std::move(protocol_query_response));
+}
+
 std::unique_ptr<shared_model::interface::BlockQueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createBlockQueryResponse(
     std::shared_ptr<const shared_model::interface::Block> block) const {
@@ -10,6 +10,8 @@
 #include "backend/protobuf/commands/proto_command.hpp"
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/util.hpp"
+#include "cryptography/default_hash_provider.hpp"
+#include "utils/lazy_initializer.hpp"
 #include "utils/reference_holder.hpp"
 
 namespace shared_model {
@@ -22,6 +24,19 @@ namespace shared_model {
 
       explicit Impl(TransportType &ref) : proto_{ref} {}
 
+      Impl(TransportType &ref,
+           std::string serialized_payload,
+           interface::types::HashType hash)
+          : proto_{ref},
+            payload_bytes_{std::move(serialized_payload)},
+            hash_{std::move(hash)} {}
+
+      Impl(std::shared_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_{std::move(arena)}, proto_{ref} {}
+
+      /// owns the transport object, when it is allocated in an arena
+      std::shared_ptr<google::protobuf::Arena> arena_;
+
       detail::ReferenceHolder<TransportType> proto_;
 
       iroha::protocol::Transaction::Payload &payload_{
@@ -30,15 +45,38 @@ namespace shared_model {
       iroha::protocol::Transaction::Payload::ReducedPayload &reduced_payload_{
           *proto_->mutable_payload()->mutable_reduced_payload()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
+      /// serialized payload, hashes and blobs are made of its bytes
+      std::string payload_bytes_{payload_.SerializeAsString()};
+
+      ByteRange reduced_payload_range_{[this] {
+        auto ranges = findEmbeddedMessages(
+            reinterpret_cast<const uint8_t *>(payload_bytes_.data()),
+            payload_bytes_.size(),
+            iroha::protocol::Transaction::Payload::kReducedPayloadFieldNumber);
+        // reduced payload is not serialized when it is empty
+        return ranges.empty() ? ByteRange{0, 0} : ranges.back();
+      }()};
+
+      detail::LazyInitializer<interface::types::BlobType> blob_{
+          [this] { return makeBlob(*proto_); }};
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      detail::LazyInitializer<interface::types::BlobType> payload_blob_{
+          [this] { return interface::types::BlobType(payload_bytes_); }};
 
-      interface::types::BlobType reduced_payload_blob_{
-          [this] { return makeBlob(reduced_payload_); }()};
+      detail::LazyInitializer<interface::types::BlobType> reduced_payload_blob_{
+          [this] {
+            return interface::types::BlobType(
+                payload_bytes_.substr(reduced_payload_range_.offset,
+                                      reduced_payload_range_.size));
+          }};
 
-      interface::types::HashType reduced_hash_{makeHash(reduced_payload_blob_)};
+      detail::LazyInitializer<interface::types::HashType> reduced_hash_{
+          [this] {
+            return crypto::DefaultHashProvider::makeHash(
+                reinterpret_cast<const uint8_t *>(payload_bytes_.data())
+                    + reduced_payload_range_.offset,
+                reduced_payload_range_.size);
+          }};
 
       std::vector<proto::Command> commands_{
           reduced_payload_.mutable_commands()->begin(),
@@ -62,7 +100,9 @@ namespace shared_model {
                                                   signatures.end());
       }()};
 
-      interface::types::HashType hash_{makeHash(payload_blob_)};
+      interface::types::HashType hash_{crypto::DefaultHashProvider::makeHash(
+          reinterpret_cast<const uint8_t *>(payload_bytes_.data()),
+          payload_bytes_.size())};
     };  // namespace proto
 
     Transaction::Transaction(const TransportType &transaction) {
@@ -77,6 +117,19 @@ namespace shared_model {
       impl_ = std::make_unique<Transaction::Impl>(transaction);
     }
 
+    Transaction::Transaction(TransportType &transaction,
+                             std::string serialized_payload,
+                             interface::types::HashType hash) {
+      impl_ = std::make_unique<Transaction::Impl>(
+          transaction, std::move(serialized_payload), std::move(hash));
+    }
+
+    Transaction::Transaction(std::shared_ptr<google::protobuf::Arena> arena,
+                             TransportType &transaction) {
+      impl_ = std::make_unique<Transaction::Impl>(std::move(arena),
+                                                  transaction);
+    }
+
     // TODO [IR-1866] Akvinikym 13.11.18: remove the copy ctor and fix fallen
     // tests
     Transaction::Transaction(const Transaction &transaction)
@@ -97,15 +150,15 @@ namespace shared_model {
     }
 
     const interface::types::BlobType &Transaction::blob() const {
-      return impl_->blob_;
+      return *impl_->blob_;
     }
 
     const interface::types::BlobType &Transaction::payload() const {
-      return impl_->payload_blob_;
+      return *impl_->payload_blob_;
     }
 
     const interface::types::BlobType &Transaction::reducedPayload() const {
-      return impl_->reduced_payload_blob_;
+      return *impl_->reduced_payload_blob_;
     }
 
     interface::types::SignatureRangeType Transaction::signatures() const {
@@ -113,7 +166,7 @@ namespace shared_model {
     }
 
     const interface::types::HashType &Transaction::reducedHash() const {
-      return impl_->reduced_hash_;
+      return *impl_->reduced_hash_;
     }
 
     bool Transaction::addSignature(const crypto::Signed &signed_blob,
@@ -139,6 +192,7 @@ namespace shared_model {
         return SignatureSetType<proto::Signature>(signatures.begin(),
                                                   signatures.end());
       }();
+      impl_->blob_.invalidate();
 
       return true;
     }
@@ -168,5 +222,46 @@ namespace shared_model {
       return new Transaction(TransportType(*impl_->proto_));
     }
 
+    std::vector<Transaction> makeEmbeddedTransactions(
+        google::protobuf::RepeatedPtrField<Transaction::TransportType>
+            &transactions,
+        const std::string &serialized_message,
+        int field_number) {
+      const auto *data =
+          reinterpret_cast<const uint8_t *>(serialized_message.data());
+      auto ranges =
+          findEmbeddedMessages(data, serialized_message.size(), field_number);
+      if (ranges.size() != static_cast<size_t>(transactions.size())) {
+        return std::vector<Transaction>(transactions.begin(),
+                                        transactions.end());
+      }
+
+      std::vector<std::pair<const uint8_t *, size_t>> payloads;
+      payloads.reserve(ranges.size());
+      for (const auto &range : ranges) {
+        auto payload_ranges = findEmbeddedMessages(
+            data + range.offset,
+            range.size,
+            Transaction::TransportType::kPayloadFieldNumber);
+        // payload is not serialized when it is empty
+        auto payload_range =
+            payload_ranges.empty() ? ByteRange{0, 0} : payload_ranges.back();
+        payloads.emplace_back(data + range.offset + payload_range.offset,
+                              payload_range.size);
+      }
+      auto hashes = crypto::DefaultHashProvider::makeHashes(payloads);
+
+      std::vector<Transaction> result;
+      result.reserve(ranges.size());
+      for (int i = 0; i < transactions.size(); ++i) {
+        result.emplace_back(
+            *transactions.Mutable(i),
+            std::string(reinterpret_cast<const char *>(payloads[i].first),
+                        payloads[i].second),
+            std::move(hashes[i]));
+      }
+      return result;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
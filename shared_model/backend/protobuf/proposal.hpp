@@ -22,9 +22,21 @@ namespace shared_model {
       explicit Proposal(const TransportType &ref);
       explicit Proposal(TransportType &&ref);
 
+      /**
+       * Create proposal of a transport object allocated in an arena
+       * @param arena - arena, which owns the transport object, it is kept
+       * alive by the proposal
+       * @param ref - transport object, which is referenced without copying
+       */
+      Proposal(std::shared_ptr<google::protobuf::Arena> arena,
+               TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
+      std::vector<interface::types::TransactionsCollectionType> batches()
+          const override;
+
       interface::types::TimestampType createdTime() const override;
 
       interface::types::HeightType height() const override;
@@ -42,7 +42,31 @@ namespace shared_model {
       iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
       createBlock(iroha::protocol::Block block);
 
+      /**
+       * Create block variant of a proto block allocated in an arena
+       *
+       * @param arena - arena, which owns the proto block, it is kept alive
+       * by the created block
+       * @param block - proto block, which is referenced without copying
+       * @return Pointer to block.
+       *         Error if block is invalid
+       */
+      iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
+      createBlock(std::shared_ptr<google::protobuf::Arena> arena,
+                  iroha::protocol::Block &block);
+
      private:
+      /**
+       * Validate the proto block, make the block variant of it and validate
+       * the block variant
+       * @param block - proto block
+       * @param make_block - function making the block variant
+       */
+      template <typename MakeBlock>
+      iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
+      validateAndMake(const iroha::protocol::Block &block,
+                      MakeBlock &&make_block);
+
       std::unique_ptr<shared_model::validation::AbstractValidator<
           shared_model::interface::Block>>
           interface_validator_;
@@ -17,10 +17,15 @@ namespace shared_model {
           std::vector<std::tuple<interface::types::AccountIdType,
                                  interface::types::AssetIdType,
                                  shared_model::interface::Amount>> assets,
+          interface::types::AccountAssetsNumberType total_assets_number,
+          boost::optional<interface::types::AssetIdType> next_asset_id,
           const crypto::Hash &query_hash) const override;
 
       std::unique_ptr<interface::QueryResponse> createAccountDetailResponse(
           interface::types::DetailType account_detail,
+          interface::types::AccountDetailsNumberType total_number,
+          boost::optional<const interface::AccountDetailRecordId &>
+              next_record_id,
           const crypto::Hash &query_hash) const override;
 
       std::unique_ptr<interface::QueryResponse> createAccountResponse(
@@ -77,6 +82,10 @@ namespace shared_model {
           interface::RolePermissionSet role_permissions,
           const crypto::Hash &query_hash) const override;
 
+      std::unique_ptr<interface::QueryResponse> copyQueryResponse(
+          const interface::QueryResponse &response,
+          const crypto::Hash &query_hash) const override;
+
       std::unique_ptr<interface::BlockQueryResponse> createBlockQueryResponse(
           std::shared_ptr<const interface::Block> block) const override;
 
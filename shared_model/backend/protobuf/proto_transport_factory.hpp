@@ -41,6 +41,53 @@ namespace shared_model {
 
       iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
           typename Proto::TransportType m) const override {
+        return validateAndMake(
+            m, [&m] { return std::make_unique<Proto>(std::move(m)); });
+      }
+
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          typename Proto::TransportType &m,
+          std::shared_ptr<google::protobuf::Arena> arena) const override {
+        return validateAndMake(m, [&m, &arena] {
+          return makeProto(
+              std::move(arena),
+              m,
+              std::is_constructible<Proto,
+                                    std::shared_ptr<google::protobuf::Arena>,
+                                    typename Proto::TransportType &>{});
+        });
+      }
+
+     private:
+      using HashProvider = shared_model::crypto::Sha3_256;
+
+      /// wrapper referencing the transport object in the arena
+      static std::unique_ptr<Proto> makeProto(
+          std::shared_ptr<google::protobuf::Arena> arena,
+          typename Proto::TransportType &m,
+          std::true_type) {
+        return std::make_unique<Proto>(std::move(arena), m);
+      }
+
+      /// wrapper of a copy of the transport object, when the wrapper cannot
+      /// reference it
+      static std::unique_ptr<Proto> makeProto(
+          std::shared_ptr<google::protobuf::Arena>,
+          const typename Proto::TransportType &m,
+          std::false_type) {
+        return std::make_unique<Proto>(m);
+      }
+
+      /**
+       * Validate the transport object, make the wrapper of it and validate
+       * the wrapper
+       * @param m - transport object
+       * @param make_proto - function making the wrapper of the object
+       */
+      template <typename MakeProto>
+      iroha::expected::Result<std::unique_ptr<Interface>, Error>
+      validateAndMake(const typename Proto::TransportType &m,
+                      MakeProto &&make_proto) const {
         if (auto answer = proto_validator_->validate(m)) {
           auto payload_field_descriptor =
               m.GetDescriptor()->FindFieldByLowercaseName("payload");
@@ -55,8 +102,7 @@ namespace shared_model {
           return iroha::expected::makeError(Error{hash, answer.reason()});
         }
 
-        std::unique_ptr<Interface> result =
-            std::make_unique<Proto>(std::move(m));
+        std::unique_ptr<Interface> result = make_proto();
         if (auto answer = interface_validator_->validate(*result)) {
           return iroha::expected::makeError(
               Error{result->hash(), answer.reason()});
@@ -65,9 +111,6 @@ namespace shared_model {
         return iroha::expected::makeValue(std::move(result));
       }
 
-     private:
-      using HashProvider = shared_model::crypto::Sha3_256;
-
       ValidatorType interface_validator_;
       ProtoValidatorType proto_validator_;
     };
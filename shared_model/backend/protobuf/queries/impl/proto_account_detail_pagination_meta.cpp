@@ -0,0 +1,49 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/queries/proto_account_detail_pagination_meta.hpp"
+
+namespace types = shared_model::interface::types;
+
+using namespace shared_model::proto;
+
+namespace {
+  boost::optional<const AccountDetailRecordId> firstRecordIdOf(
+      const iroha::protocol::AccountDetailPaginationMeta &meta) {
+    if (not meta.has_first_record_id()) {
+      return boost::none;
+    }
+    return AccountDetailRecordId{meta.first_record_id()};
+  }
+}  // namespace
+
+AccountDetailPaginationMeta::AccountDetailPaginationMeta(
+    const TransportType &query)
+    : CopyableProto(query), first_record_id_{firstRecordIdOf(*proto_)} {}
+
+AccountDetailPaginationMeta::AccountDetailPaginationMeta(
+    TransportType &&query)
+    : CopyableProto(std::move(query)),
+      first_record_id_{firstRecordIdOf(*proto_)} {}
+
+AccountDetailPaginationMeta::AccountDetailPaginationMeta(
+    const AccountDetailPaginationMeta &o)
+    : AccountDetailPaginationMeta(*o.proto_) {}
+
+AccountDetailPaginationMeta::AccountDetailPaginationMeta(
+    AccountDetailPaginationMeta &&o) noexcept
+    : AccountDetailPaginationMeta(std::move(*o.proto_)) {}
+
+types::PaginationPageSizeType AccountDetailPaginationMeta::pageSize() const {
+  return proto_->page_size();
+}
+
+boost::optional<const shared_model::interface::AccountDetailRecordId &>
+AccountDetailPaginationMeta::firstRecordId() const {
+  if (first_record_id_) {
+    return *first_record_id_;
+  }
+  return boost::none;
+}
@@ -0,0 +1,31 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/queries/proto_account_detail_record_id.hpp"
+
+namespace types = shared_model::interface::types;
+
+using namespace shared_model::proto;
+
+AccountDetailRecordId::AccountDetailRecordId(const TransportType &record_id)
+    : CopyableProto(record_id) {}
+
+AccountDetailRecordId::AccountDetailRecordId(TransportType &&record_id)
+    : CopyableProto(std::move(record_id)) {}
+
+AccountDetailRecordId::AccountDetailRecordId(const AccountDetailRecordId &o)
+    : AccountDetailRecordId(*o.proto_) {}
+
+AccountDetailRecordId::AccountDetailRecordId(
+    AccountDetailRecordId &&o) noexcept
+    : CopyableProto(std::move(*o.proto_)) {}
+
+const types::AccountIdType &AccountDetailRecordId::writer() const {
+  return proto_->writer();
+}
+
+const types::AccountDetailKeyType &AccountDetailRecordId::key() const {
+  return proto_->key();
+}
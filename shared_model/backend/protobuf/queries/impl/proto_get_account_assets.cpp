@@ -11,7 +11,14 @@ namespace shared_model {
     template <typename QueryType>
     GetAccountAssets::GetAccountAssets(QueryType &&query)
         : CopyableProto(std::forward<QueryType>(query)),
-          account_assets_{proto_->payload().get_account_assets()} {}
+          account_assets_{proto_->payload().get_account_assets()},
+          pagination_meta_{[this]()
+              -> boost::optional<const AssetPaginationMeta> {
+            if (account_assets_.has_pagination_meta()) {
+              return AssetPaginationMeta{account_assets_.pagination_meta()};
+            }
+            return boost::none;
+          }()} {}
 
     template GetAccountAssets::GetAccountAssets(
         GetAccountAssets::TransportType &);
@@ -30,5 +37,13 @@ namespace shared_model {
       return account_assets_.account_id();
     }
 
+    boost::optional<const interface::AssetPaginationMeta &>
+    GetAccountAssets::paginationMeta() const {
+      if (pagination_meta_) {
+        return *pagination_meta_;
+      }
+      return boost::none;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
@@ -11,7 +11,15 @@ namespace shared_model {
     template <typename QueryType>
     GetAccountDetail::GetAccountDetail(QueryType &&query)
         : CopyableProto(std::forward<QueryType>(query)),
-          account_detail_{proto_->payload().get_account_detail()} {}
+          account_detail_{proto_->payload().get_account_detail()},
+          pagination_meta_{[this]()
+              -> boost::optional<const AccountDetailPaginationMeta> {
+            if (account_detail_.has_pagination_meta()) {
+              return AccountDetailPaginationMeta{
+                  account_detail_.pagination_meta()};
+            }
+            return boost::none;
+          }()} {}
 
     template GetAccountDetail::GetAccountDetail(
         GetAccountDetail::TransportType &);
@@ -46,5 +54,13 @@ namespace shared_model {
           : boost::none;
     }
 
+    boost::optional<const interface::AccountDetailPaginationMeta &>
+    GetAccountDetail::paginationMeta() const {
+      if (pagination_meta_) {
+        return *pagination_meta_;
+      }
+      return boost::none;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
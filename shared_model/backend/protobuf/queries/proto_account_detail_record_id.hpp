@@ -0,0 +1,35 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_PROTO_MODEL_QUERY_ACCOUNT_DETAIL_RECORD_ID_HPP
+#define IROHA_SHARED_PROTO_MODEL_QUERY_ACCOUNT_DETAIL_RECORD_ID_HPP
+
+#include "backend/protobuf/common_objects/trivial_proto.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/queries/account_detail_record_id.hpp"
+#include "primitive.pb.h"
+
+namespace shared_model {
+  namespace proto {
+
+    /// Identifies a single account detail record by its writer and key.
+    class AccountDetailRecordId final
+        : public CopyableProto<interface::AccountDetailRecordId,
+                               iroha::protocol::AccountDetailRecordId,
+                               AccountDetailRecordId> {
+     public:
+      explicit AccountDetailRecordId(const TransportType &record_id);
+      explicit AccountDetailRecordId(TransportType &&record_id);
+      AccountDetailRecordId(const AccountDetailRecordId &o);
+      AccountDetailRecordId(AccountDetailRecordId &&o) noexcept;
+
+      const interface::types::AccountIdType &writer() const override;
+
+      const interface::types::AccountDetailKeyType &key() const override;
+    };
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_PROTO_MODEL_QUERY_ACCOUNT_DETAIL_RECORD_ID_HPP
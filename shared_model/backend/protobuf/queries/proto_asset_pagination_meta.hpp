@@ -0,0 +1,36 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_PROTO_MODEL_QUERY_ASSET_PAGINATION_META_HPP
+#define IROHA_SHARED_PROTO_MODEL_QUERY_ASSET_PAGINATION_META_HPP
+
+#include "backend/protobuf/common_objects/trivial_proto.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/queries/asset_pagination_meta.hpp"
+#include "queries.pb.h"
+
+namespace shared_model {
+  namespace proto {
+
+    /// Provides query metadata for account assets list pagination.
+    class AssetPaginationMeta final
+        : public CopyableProto<interface::AssetPaginationMeta,
+                               iroha::protocol::AssetPaginationMeta,
+                               AssetPaginationMeta> {
+     public:
+      explicit AssetPaginationMeta(const TransportType &query);
+      explicit AssetPaginationMeta(TransportType &&query);
+      AssetPaginationMeta(const AssetPaginationMeta &o);
+      AssetPaginationMeta(AssetPaginationMeta &&o) noexcept;
+
+      interface::types::PaginationPageSizeType pageSize() const override;
+
+      boost::optional<interface::types::AssetIdType> firstAssetId()
+          const override;
+    };
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_PROTO_MODEL_QUERY_ASSET_PAGINATION_META_HPP
@@ -7,6 +7,7 @@
 #define IROHA_PROTO_GET_ACCOUNT_ASSETS_H
 
 #include "backend/protobuf/common_objects/trivial_proto.hpp"
+#include "backend/protobuf/queries/proto_asset_pagination_meta.hpp"
 #include "interfaces/queries/get_account_assets.hpp"
 #include "queries.pb.h"
 
@@ -26,10 +27,14 @@ namespace shared_model {
 
       const interface::types::AccountIdType &accountId() const override;
 
+      boost::optional<const interface::AssetPaginationMeta &> paginationMeta()
+          const override;
+
      private:
       // ------------------------------| fields |-------------------------------
 
       const iroha::protocol::GetAccountAssets &account_assets_;
+      const boost::optional<const AssetPaginationMeta> pagination_meta_;
     };
   }  // namespace proto
 }  // namespace shared_model
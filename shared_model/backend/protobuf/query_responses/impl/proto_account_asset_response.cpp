@@ -5,6 +5,8 @@
 
 #include "backend/protobuf/query_responses/proto_account_asset_response.hpp"
 
+#include <boost/optional.hpp>
+
 namespace shared_model {
   namespace proto {
 
@@ -34,5 +36,19 @@ namespace shared_model {
       return account_assets_;
     }
 
+    boost::optional<interface::types::AssetIdType>
+    AccountAssetResponse::nextAssetId() const {
+      if (account_asset_response_.opt_next_asset_id_case()
+          == iroha::protocol::AccountAssetResponse::kNextAssetId) {
+        return account_asset_response_.next_asset_id();
+      }
+      return boost::none;
+    }
+
+    interface::types::AccountAssetsNumberType
+    AccountAssetResponse::totalAccountAssetsNumber() const {
+      return account_asset_response_.total_number();
+    }
+
   }  // namespace proto
 }  // namespace shared_model
@@ -12,7 +12,15 @@ namespace shared_model {
     AccountDetailResponse::AccountDetailResponse(
         QueryResponseType &&queryResponse)
         : CopyableProto(std::forward<QueryResponseType>(queryResponse)),
-          account_detail_response_{proto_->account_detail_response()} {}
+          account_detail_response_{proto_->account_detail_response()},
+          next_record_id_{[this]()
+              -> boost::optional<const AccountDetailRecordId> {
+            if (account_detail_response_.has_next_record_id()) {
+              return AccountDetailRecordId{
+                  account_detail_response_.next_record_id()};
+            }
+            return boost::none;
+          }()} {}
 
     template AccountDetailResponse::AccountDetailResponse(
         AccountDetailResponse::TransportType &);
@@ -31,5 +39,18 @@ namespace shared_model {
       return account_detail_response_.detail();
     }
 
+    interface::types::AccountDetailsNumberType
+    AccountDetailResponse::totalNumber() const {
+      return account_detail_response_.total_number();
+    }
+
+    boost::optional<const interface::AccountDetailRecordId &>
+    AccountDetailResponse::nextRecordId() const {
+      if (next_record_id_) {
+        return *next_record_id_;
+      }
+      return boost::none;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
@@ -29,6 +29,12 @@ namespace shared_model {
       const interface::types::AccountAssetCollectionType accountAssets()
           const override;
 
+      boost::optional<interface::types::AssetIdType> nextAssetId()
+          const override;
+
+      interface::types::AccountAssetsNumberType totalAccountAssetsNumber()
+          const override;
+
      private:
       const iroha::protocol::AccountAssetResponse &account_asset_response_;
 
@@ -8,6 +8,7 @@
 
 #include "backend/protobuf/common_objects/account_asset.hpp"
 #include "backend/protobuf/common_objects/trivial_proto.hpp"
+#include "backend/protobuf/queries/proto_account_detail_record_id.hpp"
 #include "interfaces/query_responses/account_detail_response.hpp"
 #include "qry_responses.pb.h"
 
@@ -27,8 +28,14 @@ namespace shared_model {
 
       const interface::types::DetailType &detail() const override;
 
+      interface::types::AccountDetailsNumberType totalNumber() const override;
+
+      boost::optional<const interface::AccountDetailRecordId &> nextRecordId()
+          const override;
+
      private:
       const iroha::protocol::AccountDetailResponse &account_detail_response_;
+      const boost::optional<const AccountDetailRecordId> next_record_id_;
     };
   }  // namespace proto
 }  // namespace shared_model
@@ -21,6 +21,28 @@ namespace shared_model {
 
       explicit Transaction(TransportType &transaction);
 
+      /**
+       * Create transaction, which is a part of an already serialized message
+       * @param transaction - transport object inside the enclosing message
+       * @param serialized_payload - payload of the transaction, taken from
+       * the serialized enclosing message, so it is not serialized again
+       * @param hash - hash of the serialized payload, computed together with
+       * the hashes of the other transactions of the message
+       */
+      Transaction(TransportType &transaction,
+                  std::string serialized_payload,
+                  interface::types::HashType hash);
+
+      /**
+       * Create transaction of a transport object allocated in an arena
+       * @param arena - arena, which owns the transport object, it is kept
+       * alive by the transaction
+       * @param transaction - transport object, which is referenced without
+       * copying
+       */
+      Transaction(std::shared_ptr<google::protobuf::Arena> arena,
+                  TransportType &transaction);
+
       Transaction(const Transaction &transaction);
 
       Transaction(Transaction &&o) noexcept;
@@ -62,6 +84,20 @@ namespace shared_model {
       struct Impl;
       std::unique_ptr<Impl> impl_;
     };
+
+    /**
+     * Create transactions of a repeated field of a serialized message, taking
+     * their payloads from the serialized message and hashing them at once
+     * @param transactions - transport objects of the field
+     * @param serialized_message - serialized message with the field
+     * @param field_number - number of the field in the message
+     * @return transactions, which reference the transport objects
+     */
+    std::vector<Transaction> makeEmbeddedTransactions(
+        google::protobuf::RepeatedPtrField<Transaction::TransportType>
+            &transactions,
+        const std::string &serialized_message,
+        int field_number);
   }  // namespace proto
 }  // namespace shared_model
 
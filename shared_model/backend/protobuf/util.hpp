@@ -6,7 +6,11 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 #define IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/message.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <type_traits>
 #include <vector>
 #include "cryptography/blob.hpp"
 
@@ -21,6 +25,81 @@ namespace shared_model {
       return crypto::Blob(std::move(data));
     }
 
+    /// Position of a part of a serialized message
+    struct ByteRange {
+      size_t offset;
+      size_t size;
+    };
+
+    /**
+     * Find the embedded messages of a field in a serialized message. Embedded
+     * messages are serialized in place, so their bytes can be used without
+     * serializing them again.
+     * @param data - serialized message
+     * @param size - size of the serialized message
+     * @param field_number - number of the message field
+     * @return positions of the messages in the data, in the order of the
+     * field values; empty if the data is malformed
+     */
+    inline std::vector<ByteRange> findEmbeddedMessages(const uint8_t *data,
+                                                       size_t size,
+                                                       int field_number) {
+      using google::protobuf::internal::WireFormatLite;
+      std::vector<ByteRange> ranges;
+      google::protobuf::io::CodedInputStream input(data, size);
+      while (auto tag = input.ReadTag()) {
+        if (WireFormatLite::GetTagFieldNumber(tag) != field_number
+            or WireFormatLite::GetTagWireType(tag)
+                != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          if (not WireFormatLite::SkipField(&input, tag)) {
+            return {};
+          }
+          continue;
+        }
+        uint32_t length;
+        if (not input.ReadVarint32(&length)) {
+          return {};
+        }
+        size_t offset = input.CurrentPosition();
+        if (not input.Skip(length)) {
+          return {};
+        }
+        ranges.push_back(ByteRange{offset, length});
+      }
+      return ranges;
+    }
+
+    /**
+     * Copy the message into the arena, so the copy with all its fields is
+     * allocated in the arena blocks and released with the arena
+     * @param arena - arena to allocate the copy in
+     * @param message - message to copy
+     * @return copy of the message, owned by the arena
+     */
+    template <typename T>
+    T &copyToArena(google::protobuf::Arena &arena, const T &message) {
+      auto copy = google::protobuf::Arena::CreateMessage<T>(&arena);
+      copy->CopyFrom(message);
+      return *copy;
+    }
+
+    /**
+     * Pass the message to the arena. Moving a heap message into an arena
+     * allocated one copies it, so the message stays on the heap and is only
+     * released with the arena.
+     * @param arena - arena to own the message
+     * @param message - message to move
+     * @return moved message, owned by the arena
+     */
+    template <typename T>
+    T &moveToArena(google::protobuf::Arena &arena, T &&message) {
+      static_assert(not std::is_lvalue_reference<T>::value,
+                    "message must be an rvalue");
+      auto moved = new T(std::move(message));
+      arena.Own(moved);
+      return *moved;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
 
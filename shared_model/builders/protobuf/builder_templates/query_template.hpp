@@ -12,6 +12,7 @@
 #include "backend/protobuf/queries/proto_query.hpp"
 #include "builders/protobuf/unsigned_proto.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "interfaces/queries/account_detail_record_id.hpp"
 #include "interfaces/transaction.hpp"
 #include "module/irohad/common/validators_config.hpp"
 #include "queries.pb.h"
@@ -173,6 +174,22 @@ namespace shared_model {
         });
       }
 
+      auto getAccountAssets(
+          const interface::types::AccountIdType &account_id,
+          interface::types::PaginationPageSizeType page_size,
+          const boost::optional<interface::types::AssetIdType>
+              &first_asset_id = boost::none) const {
+        return queryField([&](auto proto_query) {
+          auto query = proto_query->mutable_get_account_assets();
+          query->set_account_id(account_id);
+          auto page_meta_payload = query->mutable_pagination_meta();
+          page_meta_payload->set_page_size(page_size);
+          if (first_asset_id) {
+            page_meta_payload->set_first_asset_id(*first_asset_id);
+          }
+        });
+      }
+
       auto getAccountDetail(
           const interface::types::AccountIdType &account_id = "",
           const interface::types::AccountDetailKeyType &key = "",
@@ -191,6 +208,34 @@ namespace shared_model {
         });
       }
 
+      auto getAccountDetail(
+          interface::types::PaginationPageSizeType page_size,
+          const interface::types::AccountIdType &account_id = "",
+          const interface::types::AccountDetailKeyType &key = "",
+          const interface::types::AccountIdType &writer = "",
+          boost::optional<const interface::AccountDetailRecordId &>
+              first_record_id = boost::none) {
+        return queryField([&](auto proto_query) {
+          auto query = proto_query->mutable_get_account_detail();
+          if (not account_id.empty()) {
+            query->set_account_id(account_id);
+          }
+          if (not key.empty()) {
+            query->set_key(key);
+          }
+          if (not writer.empty()) {
+            query->set_writer(writer);
+          }
+          auto page_meta_payload = query->mutable_pagination_meta();
+          page_meta_payload->set_page_size(page_size);
+          if (first_record_id) {
+            auto record_id = page_meta_payload->mutable_first_record_id();
+            record_id->set_writer(first_record_id->writer());
+            record_id->set_key(first_record_id->key());
+          }
+        });
+      }
+
       auto getBlock(interface::types::HeightType height) const {
         return queryField([&](auto proto_query) {
           auto query = proto_query->mutable_get_block();
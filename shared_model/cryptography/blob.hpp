@@ -6,9 +6,11 @@
 #ifndef IROHA_SHARED_MODEL_BLOB_HPP
 #define IROHA_SHARED_MODEL_BLOB_HPP
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
 #include "interfaces/base/model_primitive.hpp"
 
 namespace shared_model {
@@ -17,15 +19,38 @@ namespace shared_model {
     class Blob;
     std::string toBinaryString(const Blob &b);
 
+    /**
+     * Hash of a blob with uniformly distributed bytes, like a hash or a
+     * public key, for the standard containers. Its leading bytes are taken
+     * as is, shorter blobs are hashed byte by byte.
+     */
+    std::size_t leadingBytesHash(const Blob &b);
+
     /**
      * Blob class present user-friendly blob for working with low-level
      * binary stuff. Its length is not fixed in compile time.
+     *
+     * Blobs up to the size of a hash or a public key keep their bytes inline,
+     * so they are not allocated on the heap. The hex representation is only
+     * made when it is requested.
      */
     class Blob : public interface::ModelPrimitive<Blob> {
      public:
-      using Bytes = std::vector<uint8_t>;
+      /// number of bytes kept inline
+      static constexpr size_t kInlineSize = 32;
+
+      using Bytes = boost::container::small_vector<uint8_t, kInlineSize>;
 
       Blob() = default;
+
+      Blob(const Blob &blob);
+
+      Blob(Blob &&blob) noexcept;
+
+      Blob &operator=(const Blob &blob);
+
+      Blob &operator=(Blob &&blob) noexcept;
+
       /**
        * Create blob from a string
        * @param blob - string to create blob from
@@ -40,6 +65,15 @@ namespace shared_model {
 
       explicit Blob(Bytes &&blob) noexcept;
 
+      explicit Blob(const std::vector<uint8_t> &blob);
+
+      /**
+       * Create blob from a range of bytes
+       * @param data - beginning of the range
+       * @param size - size of the range
+       */
+      Blob(const uint8_t *data, size_t size);
+
       /**
        * Creates new Blob object from provided hex string
        * @param hex - string in hex format to create Blob from
@@ -73,7 +107,8 @@ namespace shared_model {
 
      private:
       Bytes blob_;
-      std::string hex_;
+      /// made on the first request, accessed atomically
+      mutable std::shared_ptr<const std::string> hex_;
     };
 
   }  // namespace crypto
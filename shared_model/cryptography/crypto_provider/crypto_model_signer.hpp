@@ -24,8 +24,8 @@ namespace shared_model {
 
       template <typename T>
       inline void sign(T &signable) const noexcept {
-        auto signedBlob = Algorithm::sign(signable.payload(), keypair_);
-        signable.addSignature(signedBlob, keypair_.publicKey());
+        auto signedBlob = signer_.sign(signable.payload());
+        signable.addSignature(signedBlob, signer_.publicKey());
       }
 
       void sign(interface::Block &m) const override {
@@ -33,13 +33,13 @@ namespace shared_model {
       }
 
      private:
-      shared_model::crypto::Keypair keypair_;
+      typename Algorithm::KeypairSignerType signer_;
     };
 
     template <typename Algorithm>
     CryptoModelSigner<Algorithm>::CryptoModelSigner(
         const shared_model::crypto::Keypair &keypair)
-        : keypair_(keypair) {}
+        : signer_(keypair) {}
 
   }  // namespace crypto
 }  // namespace shared_model
@@ -21,6 +21,9 @@ namespace shared_model {
     template <typename Algorithm = DefaultCryptoAlgorithmType>
     class CryptoSigner {
      public:
+      /// long-lived signer of a single keypair of the algorithm
+      using KeypairSignerType = typename Algorithm::KeypairSignerType;
+
       /**
        * Generate signature for target data
        * @param blob - data for signing
@@ -6,6 +6,7 @@
 #ifndef IROHA_CRYPTOPROVIDER_HPP
 #define IROHA_CRYPTOPROVIDER_HPP
 
+#include "cryptography/ed25519_sha3_impl/keypair_signer.hpp"
 #include "cryptography/keypair.hpp"
 #include "cryptography/seed.hpp"
 #include "cryptography/signed.hpp"
@@ -17,6 +18,9 @@ namespace shared_model {
      */
     class CryptoProviderEd25519Sha3 {
      public:
+      /// long-lived signer of a single keypair
+      using KeypairSignerType = KeypairSigner;
+
       /**
        * Signs the message.
        * @param blob - blob to sign
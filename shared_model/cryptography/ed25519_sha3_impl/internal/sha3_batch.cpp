@@ -0,0 +1,248 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/ed25519_sha3_impl/internal/sha3_batch.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+// SIMD lanes are made of GCC vector extensions, and the instruction set is
+// chosen at runtime, so the functions are compiled for several targets
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IROHA_SHA3_SIMD
+#define IROHA_SHA3_INLINE inline __attribute__((always_inline))
+#else
+#define IROHA_SHA3_INLINE inline
+#endif
+
+// the steps of the permutation are about twice as fast with unrolled loops
+#if defined(__clang__)
+#define IROHA_SHA3_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+#define IROHA_SHA3_UNROLL _Pragma("GCC unroll 25")
+#else
+#define IROHA_SHA3_UNROLL
+#endif
+
+namespace {
+
+  /// number of bytes absorbed by one permutation of SHA3-256
+  constexpr size_t kRate = 136;
+  constexpr size_t kRateWords = kRate / 8;
+  constexpr size_t kHashWords = 256 / 64;
+
+  constexpr uint64_t kRoundConstants[24] = {
+      0x0000000000000001, 0x0000000000008082, 0x800000000000808A,
+      0x8000000080008000, 0x000000000000808B, 0x0000000080000001,
+      0x8000000080008081, 0x8000000000008009, 0x000000000000008A,
+      0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+      0x000000008000808B, 0x800000000000008B, 0x8000000000008089,
+      0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+      0x000000000000800A, 0x800000008000000A, 0x8000000080008081,
+      0x8000000000008080, 0x0000000080000001, 0x8000000080008008};
+
+  /// rotation offsets of the state words, indexed by x + 5 * y
+  constexpr int kRotations[25] = {0,  1,  62, 28, 27, 36, 44, 6,  55,
+                                  20, 3,  10, 43, 25, 39, 41, 45, 15,
+                                  21, 8,  18, 2,  61, 56, 14};
+
+  /// positions of the state words after the pi step, indexed by x + 5 * y
+  constexpr int kPi[25] = {0,  10, 20, 5,  15, 16, 1,  11, 21,
+                           6,  7,  17, 2,  12, 22, 23, 8,  18,
+                           3,  13, 14, 24, 9,  19, 4};
+
+  // lanes are passed by reference, since passing vectors by value to
+  // functions without their target changes the ABI
+  template <typename Lane>
+  IROHA_SHA3_INLINE void rotate(Lane &x, int n) {
+    x = (x << n) | (x >> ((64 - n) & 63));
+  }
+
+  /**
+   * Keccak-f[1600] permutation of the state. Lane is either a word of a
+   * single state, or a vector of words of several independent states
+   */
+  template <typename Lane>
+  IROHA_SHA3_INLINE void keccakF(Lane (&a)[25]) {
+    for (auto round_constant : kRoundConstants) {
+      // theta
+      Lane c[5];
+      IROHA_SHA3_UNROLL
+      for (int x = 0; x < 5; ++x) {
+        c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+      }
+      IROHA_SHA3_UNROLL
+      for (int x = 0; x < 5; ++x) {
+        Lane d = c[(x + 1) % 5];
+        rotate(d, 1);
+        d ^= c[(x + 4) % 5];
+        IROHA_SHA3_UNROLL
+        for (int y = 0; y < 25; y += 5) {
+          a[x + y] ^= d;
+        }
+      }
+      // rho and pi
+      Lane b[25];
+      IROHA_SHA3_UNROLL
+      for (int i = 0; i < 25; ++i) {
+        b[kPi[i]] = a[i];
+        rotate(b[kPi[i]], kRotations[i]);
+      }
+      // chi
+      IROHA_SHA3_UNROLL
+      for (int y = 0; y < 25; y += 5) {
+        IROHA_SHA3_UNROLL
+        for (int x = 0; x < 5; ++x) {
+          a[x + y] = b[x + y] ^ (~b[(x + 1) % 5 + y] & b[(x + 2) % 5 + y]);
+        }
+      }
+      // iota
+      a[0] ^= round_constant;
+    }
+  }
+
+  uint64_t loadWord(const uint8_t *bytes) {
+    uint64_t word = 0;
+    for (int i = 7; i >= 0; --i) {
+      word = (word << 8) | bytes[i];
+    }
+    return word;
+  }
+
+  /// message to hash and the buffer for its hash
+  struct Job {
+    const uint8_t *data;
+    size_t size;
+    uint8_t *output;
+
+    /// number of blocks of the padded message
+    size_t blocks() const {
+      return size / kRate + 1;
+    }
+
+    /// load words of the padded message block
+    void loadBlock(size_t index, uint64_t (&words)[kRateWords]) const {
+      const auto offset = index * kRate;
+      if (offset + kRate <= size) {
+        for (size_t i = 0; i < kRateWords; ++i) {
+          words[i] = loadWord(data + offset + i * 8);
+        }
+        return;
+      }
+      // the last block is the tail of the message with SHA3 padding
+      uint8_t padded[kRate] = {};
+      if (size > offset) {
+        std::memcpy(padded, data + offset, size - offset);
+      }
+      padded[size - offset] ^= 0x06;
+      padded[kRate - 1] ^= 0x80;
+      for (size_t i = 0; i < kRateWords; ++i) {
+        words[i] = loadWord(padded + i * 8);
+      }
+    }
+  };
+
+  /// absorb the blocks of the job starting from the given one into the
+  /// state and write the hash
+  void finishJob(uint64_t (&state)[25], const Job &job, size_t first_block) {
+    uint64_t words[kRateWords];
+    for (auto block = first_block; block < job.blocks(); ++block) {
+      job.loadBlock(block, words);
+      for (size_t i = 0; i < kRateWords; ++i) {
+        state[i] ^= words[i];
+      }
+      keccakF(state);
+    }
+    for (size_t i = 0; i < kHashWords * 8; ++i) {
+      job.output[i] = static_cast<uint8_t>(state[i / 8] >> (i % 8 * 8));
+    }
+  }
+
+#ifdef IROHA_SHA3_SIMD
+  using Lanes4 = uint64_t __attribute__((vector_size(32)));
+  using Lanes8 = uint64_t __attribute__((vector_size(64)));
+
+  /**
+   * Absorb the blocks, which all the jobs have, in SIMD lanes and finish
+   * each job separately
+   * @param jobs - kLanes jobs, sorted by the number of blocks
+   */
+  template <typename Lane, size_t kLanes>
+  IROHA_SHA3_INLINE void hashLanes(const Job *jobs) {
+    Lane state[25] = {};
+    const auto common_blocks = jobs[0].blocks();
+    uint64_t words[kLanes][kRateWords];
+    for (size_t block = 0; block < common_blocks; ++block) {
+      for (size_t lane = 0; lane < kLanes; ++lane) {
+        jobs[lane].loadBlock(block, words[lane]);
+      }
+      for (size_t i = 0; i < kRateWords; ++i) {
+        Lane word;
+        for (size_t lane = 0; lane < kLanes; ++lane) {
+          word[lane] = words[lane][i];
+        }
+        state[i] ^= word;
+      }
+      keccakF(state);
+    }
+
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      uint64_t lane_state[25];
+      for (size_t i = 0; i < 25; ++i) {
+        lane_state[i] = state[i][lane];
+      }
+      finishJob(lane_state, jobs[lane], common_blocks);
+    }
+  }
+
+  __attribute__((target("avx2"))) void hashLanes4(const Job *jobs) {
+    hashLanes<Lanes4, 4>(jobs);
+  }
+
+  __attribute__((target("avx512f"))) void hashLanes8(const Job *jobs) {
+    hashLanes<Lanes8, 8>(jobs);
+  }
+#endif
+
+}  // namespace
+
+namespace iroha {
+
+  std::vector<hash256_t> sha3_256_batch(
+      const std::vector<Sha3Message> &messages) {
+    std::vector<hash256_t> hashes(messages.size());
+    std::vector<Job> jobs;
+    jobs.reserve(messages.size());
+    for (size_t i = 0; i < messages.size(); ++i) {
+      jobs.push_back(
+          Job{messages[i].first, messages[i].second, hashes[i].data()});
+    }
+    auto job = jobs.begin();
+
+#ifdef IROHA_SHA3_SIMD
+    static const bool avx512 = __builtin_cpu_supports("avx512f");
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    if (avx2 or avx512) {
+      // jobs of similar sizes share most of the blocks
+      std::sort(jobs.begin(), jobs.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.blocks() < rhs.blocks();
+      });
+    }
+    for (; avx512 and jobs.end() - job >= 8; job += 8) {
+      hashLanes8(&*job);
+    }
+    for (; avx2 and jobs.end() - job >= 4; job += 4) {
+      hashLanes4(&*job);
+    }
+#endif
+
+    for (; job != jobs.end(); ++job) {
+      uint64_t state[25] = {};
+      finishJob(state, *job, 0);
+    }
+    return hashes;
+  }
+
+}  // namespace iroha
@@ -0,0 +1,32 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHA3_BATCH_HPP
+#define IROHA_SHA3_BATCH_HPP
+
+#include <utility>
+#include <vector>
+
+#include "crypto/hash_types.hpp"
+
+namespace iroha {
+
+  /// pointer to the bytes of a message and its size
+  using Sha3Message = std::pair<const uint8_t *, size_t>;
+
+  /**
+   * Computes SHA3-256 hashes of independent messages at once. When the CPU
+   * supports AVX-512 or AVX2, blocks of 8 or 4 messages are permuted
+   * together in SIMD lanes, otherwise the messages are hashed one by one.
+   * The hashes are the same as the ones of sha3_256
+   * @param messages - messages to hash
+   * @return hashes in the order of the messages
+   */
+  std::vector<hash256_t> sha3_256_batch(
+      const std::vector<Sha3Message> &messages);
+
+}  // namespace iroha
+
+#endif  // IROHA_SHA3_BATCH_HPP
@@ -0,0 +1,134 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/ed25519_sha3_impl/keypair_signer.hpp"
+
+#include <algorithm>
+#include <new>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "common/blob.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    namespace {
+      /// copies the key bytes without the temporary strings of from_string
+      template <size_t size>
+      void copyKey(const Blob &key, iroha::blob_t<size> &to) {
+        if (key.size() != size) {
+          throw iroha::BadFormatException(
+              "KeypairSigner: key has incorrect length. Found: "
+              + std::to_string(key.size())
+              + ", required: " + std::to_string(size));
+        }
+        std::copy(key.blob().begin(), key.blob().end(), to.begin());
+      }
+    }  // namespace
+
+    /**
+     * Keys of a signer are kept in a page of their own. The page is not
+     * shared with other objects, so it is locked and unlocked exactly once,
+     * and it is excluded from core dumps where the system allows it.
+     */
+    struct KeypairSigner::Impl {
+      struct Keys {
+        iroha::pubkey_t public_key;
+        iroha::privkey_t private_key;
+      };
+
+      explicit Impl(const Keypair &keypair) : Impl() {
+        copyKey(keypair.publicKey(), keys->public_key);
+        copyKey(keypair.privateKey(), keys->private_key);
+      }
+
+      Impl(const Impl &impl) : Impl() {
+        *keys = *impl.keys;
+      }
+
+      ~Impl() {
+        // volatile prevents the compiler from removing the dead stores
+        volatile auto *bytes = reinterpret_cast<unsigned char *>(keys);
+        for (size_t i = 0; i < sizeof(Keys); ++i) {
+          bytes[i] = 0;
+        }
+#ifndef _WIN32
+        if (locked) {
+          munlock(keys, size);
+        }
+        munmap(keys, size);
+#else
+        delete keys;
+#endif
+      }
+
+      Impl &operator=(const Impl &) = delete;
+
+      Keys *keys;
+      size_t size = sizeof(Keys);
+      bool locked = false;
+
+     private:
+      Impl() {
+#ifndef _WIN32
+        size = std::max<size_t>(sysconf(_SC_PAGESIZE), sizeof(Keys));
+        auto memory = mmap(nullptr,
+                           size,
+                           PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS,
+                           -1,
+                           0);
+        if (memory == MAP_FAILED) {
+          throw std::bad_alloc();
+        }
+        keys = new (memory) Keys;
+        // locking is best effort, it fails when RLIMIT_MEMLOCK is exceeded
+        locked = mlock(keys, size) == 0;
+#ifdef MADV_DONTDUMP
+        madvise(keys, size, MADV_DONTDUMP);
+#endif
+#else
+        keys = new Keys;
+#endif
+      }
+    };
+
+    KeypairSigner::KeypairSigner(const Keypair &keypair)
+        : impl_(std::make_unique<Impl>(keypair)),
+          public_key_(keypair.publicKey()) {}
+
+    KeypairSigner::KeypairSigner(const KeypairSigner &signer)
+        : impl_(std::make_unique<Impl>(*signer.impl_)),
+          public_key_(signer.public_key_) {}
+
+    KeypairSigner::KeypairSigner(KeypairSigner &&signer) noexcept = default;
+
+    KeypairSigner &KeypairSigner::operator=(KeypairSigner &&signer) noexcept =
+        default;
+
+    KeypairSigner::~KeypairSigner() = default;
+
+    Signed KeypairSigner::sign(const Blob &blob) const {
+      auto hash = iroha::sha3_256(blob.blob().data(), blob.size());
+      auto signature = iroha::sign(
+          hash.data(),
+          hash.size(),
+          impl_->keys->public_key,
+          impl_->keys->private_key);
+      return Signed(Blob(signature.data(), signature.size()));
+    }
+
+    const PublicKey &KeypairSigner::publicKey() const {
+      return public_key_;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_KEYPAIR_SIGNER_HPP
+#define IROHA_SHARED_MODEL_KEYPAIR_SIGNER_HPP
+
+#include <memory>
+
+#include "cryptography/blob.hpp"
+#include "cryptography/keypair.hpp"
+#include "cryptography/signed.hpp"
+
+namespace shared_model {
+  namespace crypto {
+    /**
+     * Long-lived signer of a single keypair, which is used for the own
+     * signatures of the node. The keys are copied once on construction to a
+     * page owned by the signer, which is locked from swapping when the
+     * memlock limit allows it and wiped on destruction. The keypair passed
+     * to the constructor is not protected, its owner keeps it as before.
+     */
+    class KeypairSigner {
+     public:
+      explicit KeypairSigner(const Keypair &keypair);
+
+      KeypairSigner(const KeypairSigner &signer);
+
+      KeypairSigner(KeypairSigner &&signer) noexcept;
+
+      KeypairSigner &operator=(KeypairSigner &&signer) noexcept;
+
+      ~KeypairSigner();
+
+      /**
+       * Signs provided blob.
+       * @param blob - to sign
+       * @return Signed object with signed data
+       */
+      Signed sign(const Blob &blob) const;
+
+      /**
+       * @return public key of the signatures
+       */
+      const PublicKey &publicKey() const;
+
+     private:
+      struct Impl;
+      std::unique_ptr<Impl> impl_;
+      PublicKey public_key_;
+    };
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_KEYPAIR_SIGNER_HPP
@@ -18,7 +18,8 @@ namespace shared_model {
     class Hash : public Blob {
      public:
       /**
-       * To calculate hash used by some standard containers
+       * To calculate hash used by some standard containers. Bytes of a hash
+       * are uniformly distributed, so its leading bytes are taken as is.
        */
       struct Hasher {
         std::size_t operator()(const Hash &h) const;
@@ -43,4 +44,10 @@ namespace shared_model {
   }  // namespace crypto
 }  // namespace shared_model
 
+namespace std {
+  template <>
+  struct hash<shared_model::crypto::Hash>
+      : shared_model::crypto::Hash::Hasher {};
+}  // namespace std
+
 #endif  // IROHA_SHARED_MODEL_HASH_HPP
@@ -7,6 +7,7 @@
 #define IROHA_SHARED_MODEL_SHA3_256_HPP
 
 #include "crypto/hash_types.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_batch.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 #include "cryptography/hash.hpp"
 
@@ -15,7 +16,28 @@ namespace shared_model {
     class Sha3_256 {
      public:
       static Hash makeHash(const Blob &blob) {
-        return Hash(iroha::sha3_256(blob.blob()).to_string());
+        return makeHash(blob.blob().data(), blob.size());
+      }
+
+      static Hash makeHash(const uint8_t *data, size_t size) {
+        auto hash = iroha::sha3_256(data, size);
+        return Hash(Blob(hash.data(), hash.size()));
+      }
+
+      /**
+       * Hash independent messages at once, which is faster than hashing
+       * them one by one
+       * @param messages - pointers to the bytes of the messages and sizes
+       * @return hashes in the order of the messages
+       */
+      static std::vector<Hash> makeHashes(
+          const std::vector<std::pair<const uint8_t *, size_t>> &messages) {
+        std::vector<Hash> result;
+        result.reserve(messages.size());
+        for (const auto &hash : iroha::sha3_256_batch(messages)) {
+          result.emplace_back(Blob(hash.data(), hash.size()));
+        }
+        return result;
       }
     };
   }  // namespace crypto
@@ -14,7 +14,8 @@ namespace shared_model {
     class Sha3_512 {
      public:
       static Hash makeHash(const Blob &blob) {
-        return Hash(iroha::sha3_512(blob.blob()).to_string());
+        auto hash = iroha::sha3_512(blob.blob().data(), blob.size());
+        return Hash(Blob(hash.data(), hash.size()));
       }
     };
   }  // namespace crypto
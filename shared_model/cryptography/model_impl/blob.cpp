@@ -5,6 +5,9 @@
 
 #include "cryptography/blob.hpp"
 
+#include <cstring>
+
+#include <boost/functional/hash.hpp>
 #include "common/byteutils.hpp"
 
 namespace shared_model {
@@ -14,14 +17,45 @@ namespace shared_model {
       return std::string(b.blob().begin(), b.blob().end());
     }
 
+    std::size_t leadingBytesHash(const Blob &b) {
+      std::size_t result;
+      if (b.size() < sizeof(result)) {
+        return boost::hash_range(b.blob().begin(), b.blob().end());
+      }
+      std::memcpy(&result, b.blob().data(), sizeof(result));
+      return result;
+    }
+
+    Blob::Blob(const Blob &blob)
+        : blob_(blob.blob_), hex_(std::atomic_load(&blob.hex_)) {}
+
+    Blob::Blob(Blob &&blob) noexcept
+        : blob_(std::move(blob.blob_)), hex_(std::move(blob.hex_)) {}
+
+    Blob &Blob::operator=(const Blob &blob) {
+      blob_ = blob.blob_;
+      hex_ = std::atomic_load(&blob.hex_);
+      return *this;
+    }
+
+    Blob &Blob::operator=(Blob &&blob) noexcept {
+      blob_ = std::move(blob.blob_);
+      hex_ = std::move(blob.hex_);
+      return *this;
+    }
+
     Blob::Blob(const std::string &blob)
         : Blob(Bytes(blob.begin(), blob.end())) {}
 
     Blob::Blob(const Bytes &blob) : Blob(Bytes(blob)) {}
 
-    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {
-      hex_ = iroha::bytestringToHexstring(toBinaryString(*this));
-    }
+    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {}
+
+    Blob::Blob(const std::vector<uint8_t> &blob)
+        : Blob(Bytes(blob.begin(), blob.end())) {}
+
+    Blob::Blob(const uint8_t *data, size_t size)
+        : Blob(Bytes(data, data + size)) {}
 
     Blob *Blob::clone() const {
       return new Blob(blob());
@@ -43,7 +77,17 @@ namespace shared_model {
     }
 
     const std::string &Blob::hex() const {
-      return hex_;
+      auto hex = std::atomic_load(&hex_);
+      if (not hex) {
+        // concurrent requests may make the hex several times, only one of
+        // the results is kept
+        auto made = std::make_shared<const std::string>(
+            iroha::bytestringToHexstring(toBinaryString(*this)));
+        if (std::atomic_compare_exchange_strong(&hex_, &hex, made)) {
+          hex = std::move(made);
+        }
+      }
+      return *hex;
     }
 
     size_t Blob::size() const {
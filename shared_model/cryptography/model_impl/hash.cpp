@@ -5,9 +5,8 @@
 
 #include "cryptography/hash.hpp"
 
-#include <boost/functional/hash.hpp>
-
 #include "common/byteutils.hpp"
+
 namespace shared_model {
   namespace crypto {
 
@@ -29,13 +28,7 @@ namespace shared_model {
     }
 
     std::size_t Hash::Hasher::operator()(const Hash &h) const {
-      using boost::hash_combine;
-      using boost::hash_value;
-
-      std::size_t seed = 0;
-      hash_combine(seed, hash_value(h.blob()));
-
-      return seed;
+      return leadingBytesHash(h);
     }
   }  // namespace crypto
 }  // namespace shared_model
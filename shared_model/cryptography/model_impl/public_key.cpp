@@ -12,7 +12,12 @@ namespace shared_model {
 
     PublicKey::PublicKey(const std::string &public_key) : Blob(public_key) {}
 
-    PublicKey::PublicKey(const Blob &blob) : Blob(blob.blob()) {}
+    PublicKey::PublicKey(const Blob &blob) : Blob(blob) {}
+
+    std::size_t PublicKey::Hasher::operator()(
+        const PublicKey &public_key) const {
+      return leadingBytesHash(public_key);
+    }
 
     std::string PublicKey::toString() const {
       return detail::PrettyStringBuilder()
@@ -15,6 +15,14 @@ namespace shared_model {
      */
     class PublicKey : public Blob {
      public:
+      /**
+       * To calculate hash used by some standard containers. Bytes of a key
+       * are uniformly distributed, so its leading bytes are taken as is.
+       */
+      struct Hasher {
+        std::size_t operator()(const PublicKey &public_key) const;
+      };
+
       explicit PublicKey(const std::string &public_key);
 
       explicit PublicKey(const Blob &blob);
@@ -24,4 +32,10 @@ namespace shared_model {
   }  // namespace crypto
 }  // namespace shared_model
 
+namespace std {
+  template <>
+  struct hash<shared_model::crypto::PublicKey>
+      : shared_model::crypto::PublicKey::Hasher {};
+}  // namespace std
+
 #endif  // IROHA_SHARED_MODEL_PUBLIC_KEY_HPP
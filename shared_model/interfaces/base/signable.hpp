@@ -12,6 +12,7 @@
 #include <boost/optional.hpp>
 #include <unordered_set>
 #include "cryptography/default_hash_provider.hpp"
+#include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/range_types.hpp"
 #include "interfaces/common_objects/signature.hpp"
 #include "interfaces/common_objects/types.hpp"
@@ -115,7 +116,7 @@ namespace shared_model {
          */
         template <typename T>
         size_t operator()(const T &sig) const {
-          return std::hash<std::string>{}(sig.publicKey().hex());
+          return std::hash<crypto::PublicKey>{}(sig.publicKey());
         }
 
         /**
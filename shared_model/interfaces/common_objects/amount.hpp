@@ -9,13 +9,15 @@
 #include "interfaces/base/model_primitive.hpp"
 
 #include <boost/multiprecision/cpp_int.hpp>
+#include <boost/optional.hpp>
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
   namespace interface {
 
     /**
-     * Representation of fixed point number
+     * Representation of fixed point number. Values, which fit into 64 bits,
+     * are kept natively and only larger ones are kept as uint256.
      */
     class Amount final : public ModelPrimitive<Amount> {
      public:
@@ -29,7 +31,13 @@ namespace shared_model {
        * Gets integer representation value, which ignores precision
        * @return amount represented as integer value, which ignores precision
        */
-      const boost::multiprecision::uint256_t &intValue() const;
+      boost::multiprecision::uint256_t intValue() const;
+
+      /**
+       * Checks, whether the value is zero
+       * @return true, if the integer representation is zero
+       */
+      bool isZero() const;
 
       /**
        * Gets the position of precision
@@ -41,7 +49,15 @@ namespace shared_model {
        * String representation.
        * @return string representation of the asset.
        */
-      std::string toStringRepr() const;
+      const std::string &toStringRepr() const;
+
+      /**
+       * Compares the values of amounts regardless of their precisions
+       * @param rhs - amount to compare with
+       * @return negative number, zero or positive number, if the value is
+       * less, equal or greater than the value of rhs
+       */
+      int compare(const Amount &rhs) const;
 
       /**
        * Checks equality of objects inside
@@ -59,10 +75,13 @@ namespace shared_model {
       Amount *clone() const override;
 
      private:
-      const std::string amount_;
+      std::string amount_;
 
       interface::types::PrecisionType precision_;
-      const boost::multiprecision::uint256_t multiprecision_repr_;
+      /// integer representation, if it fits into 64 bits
+      uint64_t value_;
+      /// integer representation, if it does not fit into 64 bits
+      boost::optional<boost::multiprecision::uint256_t> big_value_;
     };
   }  // namespace interface
 }  // namespace shared_model
@@ -5,56 +5,120 @@
 
 #include "interfaces/common_objects/amount.hpp"
 
-#include <regex>
+#include <algorithm>
+#include <limits>
 
 #include "utils/string_builder.hpp"
 
+namespace {
+  bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+  }
+
+  /**
+   * Multiplies the value by the power of ten
+   * @param value - value to multiply
+   * @param exponent - power of ten, nothing is done for non-positive ones
+   * @return false, if the result does not fit into 64 bits
+   */
+  bool scale(uint64_t &value, int exponent) {
+    for (; exponent > 0 and value != 0; --exponent) {
+      if (value > std::numeric_limits<uint64_t>::max() / 10) {
+        return false;
+      }
+      value *= 10;
+    }
+    return true;
+  }
+}  // namespace
+
 namespace shared_model {
   namespace interface {
     Amount::Amount(const std::string &amount) : Amount(std::string(amount)) {}
     Amount::Amount(std::string &&amount)
-        : amount_(std::move(amount)),
-          precision_(0),
-          multiprecision_repr_([this] {
-            static const std::regex r("([0-9]+)(\\.([0-9]+))?");
-            // 123.456 will have the following groups:
-            //   [0] -> 123.456, [1] -> 123
-            //   [2] -> .456,    [3] -> 456
-            std::smatch match;
-            if (std::regex_match(this->amount_, match, r)
-                && match.size() == 4) {
-              this->precision_ = match[3].length();
-              auto str = match[0].str();
-              size_t pos = match[1].length();
-              // remove dot if it exist
-              if (pos < str.size()) {
-                str.erase(str.begin() + pos);
-              }
-              // remove leading zeroes
-              str.erase(0,
-                        std::min(str.find_first_not_of('0'), str.size() - 1));
-              return boost::multiprecision::uint256_t(str);
-            }
-            return std::numeric_limits<boost::multiprecision::uint256_t>::min();
-          }()) {}
-
-    Amount::Amount(const Amount &o) : Amount(std::string(o.amount_)) {}
+        : amount_(std::move(amount)), precision_(0), value_(0) {
+      // the amount must match ([0-9]+)(\.([0-9]+))?, otherwise it is zero
+      auto begin = amount_.begin(), end = amount_.end();
+      auto point = std::find(begin, end, '.');
+      if (begin == point or not std::all_of(begin, point, isDigit)
+          or (point != end
+              and (point + 1 == end
+                   or not std::all_of(point + 1, end, isDigit)))) {
+        return;
+      }
+      if (point != end) {
+        precision_ = end - point - 1;
+      }
+
+      for (auto it = begin; it != end; ++it) {
+        if (it == point) {
+          continue;
+        }
+        uint64_t digit = *it - '0';
+        if (value_ > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+          // the value does not fit into 64 bits, so parse it as uint256
+          std::string str(begin, point);
+          if (point != end) {
+            str.append(point + 1, end);
+          }
+          // remove leading zeroes
+          str.erase(0, std::min(str.find_first_not_of('0'), str.size() - 1));
+          value_ = 0;
+          big_value_ = boost::multiprecision::uint256_t(str);
+          return;
+        }
+        value_ = value_ * 10 + digit;
+      }
+    }
+
+    Amount::Amount(const Amount &o)
+        : amount_(o.amount_),
+          precision_(o.precision_),
+          value_(o.value_),
+          big_value_(o.big_value_) {}
 
     Amount::Amount(Amount &&o) noexcept
-        : Amount(std::move(const_cast<std::string &>(o.amount_))) {}
+        : amount_(std::move(o.amount_)),
+          precision_(o.precision_),
+          value_(o.value_),
+          big_value_(std::move(o.big_value_)) {}
 
-    const boost::multiprecision::uint256_t &Amount::intValue() const {
-      return multiprecision_repr_;
+    boost::multiprecision::uint256_t Amount::intValue() const {
+      return big_value_ ? *big_value_
+                        : boost::multiprecision::uint256_t(value_);
+    }
+
+    bool Amount::isZero() const {
+      return big_value_ ? big_value_->is_zero() : value_ == 0;
     }
 
     types::PrecisionType Amount::precision() const {
       return precision_;
     }
 
-    std::string Amount::toStringRepr() const {
+    const std::string &Amount::toStringRepr() const {
       return amount_;
     }
 
+    int Amount::compare(const Amount &rhs) const {
+      int exponent = static_cast<int>(rhs.precision_) - precision_;
+      if (not big_value_ and not rhs.big_value_) {
+        auto lhs_value = value_, rhs_value = rhs.value_;
+        if (scale(lhs_value, exponent) and scale(rhs_value, -exponent)) {
+          return (lhs_value > rhs_value) - (lhs_value < rhs_value);
+        }
+      }
+
+      using boost::multiprecision::cpp_int;
+      cpp_int lhs_value(intValue()), rhs_value(rhs.intValue());
+      if (exponent > 0) {
+        lhs_value *= boost::multiprecision::pow(cpp_int(10), exponent);
+      } else {
+        rhs_value *= boost::multiprecision::pow(cpp_int(10), -exponent);
+      }
+      return lhs_value.compare(rhs_value);
+    }
+
     bool Amount::operator==(const ModelType &rhs) const {
       return amount_ == rhs.amount_;
     }
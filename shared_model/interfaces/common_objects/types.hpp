@@ -75,6 +75,12 @@ namespace shared_model {
       using AccountDetailValueType = std::string;
       /// Type of a number of transactions in block and query response page
       using TransactionsNumberType = uint16_t;
+      /// Type of a number of records in a paginated query response page
+      using PaginationPageSizeType = uint32_t;
+      /// Type of a total number of account assets
+      using AccountAssetsNumberType = uint32_t;
+      /// Type of a total number of account details
+      using AccountDetailsNumberType = uint64_t;
       /// Type of the transfer message
       using DescriptionType = std::string;
       /// Type of peers collection
@@ -12,6 +12,12 @@
 #include "cryptography/hash.hpp"
 #include "interfaces/common_objects/types.hpp"
 
+namespace google {
+  namespace protobuf {
+    class Arena;
+  }
+}  // namespace google
+
 namespace shared_model {
   namespace interface {
 
@@ -26,6 +32,18 @@ namespace shared_model {
       virtual iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
           Transport transport) const = 0;
 
+      /**
+       * Build the object of a transport object allocated in an arena. The
+       * default implementation copies the transport object
+       * @param transport - transport object, owned by the arena
+       * @param arena - arena, which is kept alive by the built object
+       */
+      virtual iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          Transport &transport,
+          std::shared_ptr<google::protobuf::Arena> arena) const {
+        return build(transport);
+      }
+
       virtual ~AbstractTransportFactory() = default;
     };
 
@@ -0,0 +1,18 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "interfaces/iroha_internal/proposal.hpp"
+
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+
+namespace shared_model {
+  namespace interface {
+
+    std::vector<types::TransactionsCollectionType> Proposal::batches() const {
+      return TransactionBatchParserImpl().parseBatches(transactions());
+    }
+
+  }  // namespace interface
+}  // namespace shared_model
@@ -21,6 +21,12 @@ namespace shared_model {
        */
       virtual types::TransactionsCollectionType transactions() const = 0;
 
+      /**
+       * @return transactions of the proposal split into batch candidates,
+       * the way the batch parser splits them
+       */
+      virtual std::vector<types::TransactionsCollectionType> batches() const;
+
       /**
        * @return the height
        */
@@ -8,9 +8,11 @@
 
 #include <memory>
 
+#include <boost/optional.hpp>
 #include "interfaces/common_objects/account.hpp"
 #include "interfaces/common_objects/asset.hpp"
 #include "interfaces/permissions.hpp"
+#include "interfaces/queries/account_detail_record_id.hpp"
 #include "interfaces/query_responses/block_query_response.hpp"
 #include "interfaces/query_responses/error_query_response.hpp"
 #include "interfaces/query_responses/query_response.hpp"
@@ -38,6 +40,9 @@ namespace shared_model {
       /**
        * Create response for account asset query
        * @param assets to be inserted into the response
+       * @param total_assets_number - total number of account assets
+       * @param next_asset_id - id of the first asset of the next page, if
+       * there is one
        * @param query_hash - hash of the query, for which response is created
        * @return account asset response
        */
@@ -45,16 +50,23 @@ namespace shared_model {
           std::vector<std::tuple<types::AccountIdType,
                                  types::AssetIdType,
                                  shared_model::interface::Amount>> assets,
+          types::AccountAssetsNumberType total_assets_number,
+          boost::optional<types::AssetIdType> next_asset_id,
           const crypto::Hash &query_hash) const = 0;
 
       /**
        * Create response for account detail query
        * @param account_detail to be inserted into the response
+       * @param total_number - total number of details matching the query
+       * @param next_record_id - id of the first record of the next page, if
+       * there is one
        * @param query_hash - hash of the query, for which response is created
        * @return account detail response
        */
       virtual std::unique_ptr<QueryResponse> createAccountDetailResponse(
           types::DetailType account_detail,
+          types::AccountDetailsNumberType total_number,
+          boost::optional<const AccountDetailRecordId &> next_record_id,
           const crypto::Hash &query_hash) const = 0;
 
       /**
@@ -199,6 +211,16 @@ namespace shared_model {
           RolePermissionSet role_permissions,
           const crypto::Hash &query_hash) const = 0;
 
+      /**
+       * Create a copy of the response to another query
+       * @param response to be copied
+       * @param query_hash - hash of the query, for which response is created
+       * @return the same response with the query hash replaced
+       */
+      virtual std::unique_ptr<QueryResponse> copyQueryResponse(
+          const QueryResponse &response,
+          const crypto::Hash &query_hash) const = 0;
+
       /**
        * Create response for block query with block
        * @param block to be inserted into the response
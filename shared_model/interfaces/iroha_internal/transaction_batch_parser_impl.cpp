@@ -6,34 +6,41 @@
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 
 #include <boost/range/adaptor/indirected.hpp>
-#include <boost/range/combine.hpp>
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "interfaces/transaction.hpp"
 
 namespace {
   /**
-   * Zips in_range and out_range, where in_range elements are objects, parses
-   * batches based on batchMeta values of in_range, and returns a collection of
-   * corresponding sub-ranges of out_range
+   * Walks in_range and out_range together, where in_range elements are
+   * objects, parses batches based on batchMeta values of in_range, and returns
+   * a collection of corresponding sub-ranges of out_range. Each transaction is
+   * visited once and its batch meta is compared with the one of the batch it
+   * may continue
    */
   template <typename InRange, typename OutRange>
-  auto parseBatchesImpl(InRange in_range, const OutRange &out_range) {
+  auto parseBatchesImpl(const InRange &in_range, const OutRange &out_range) {
     std::vector<OutRange> result;
-    auto meta = [](const auto &tx) { return boost::get<0>(tx).batchMeta(); };
-    auto it = [](auto &p) { return boost::get<1>(p.get_iterator_tuple()); };
+    auto out_it = std::begin(out_range);
+    auto batch_begin = out_it;
+    boost::optional<std::shared_ptr<shared_model::interface::BatchMeta>>
+        batch_meta;
 
-    auto range = boost::combine(in_range, out_range);
-    auto begin = std::begin(range), end = std::end(range);
-    while (begin != end) {
-      const auto beginning_tx_meta_opt = meta(*begin);
-      auto next = std::find_if(std::next(begin), end, [&](const auto &tx) {
-        const auto current_tx_meta_opt = meta(tx);
-        return not(current_tx_meta_opt and beginning_tx_meta_opt)
-            or (**current_tx_meta_opt != **beginning_tx_meta_opt);
-      });
-
-      result.emplace_back(it(begin), it(next));
-      begin = next;
+    for (const auto &tx : in_range) {
+      auto tx_meta = tx.batchMeta();
+      // transactions without batch meta are batches of their own
+      bool continues_batch = out_it != batch_begin and tx_meta and batch_meta
+          and **tx_meta == **batch_meta;
+      if (not continues_batch) {
+        if (out_it != batch_begin) {
+          result.emplace_back(batch_begin, out_it);
+        }
+        batch_begin = out_it;
+        batch_meta = std::move(tx_meta);
+      }
+      ++out_it;
+    }
+    if (out_it != batch_begin) {
+      result.emplace_back(batch_begin, out_it);
     }
 
     return result;
@@ -6,8 +6,11 @@
 #ifndef IROHA_SHARED_MODEL_GET_ACCOUNT_ASSETS_HPP
 #define IROHA_SHARED_MODEL_GET_ACCOUNT_ASSETS_HPP
 
+#include <boost/optional.hpp>
+
 #include "interfaces/base/model_primitive.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "interfaces/queries/asset_pagination_meta.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -21,6 +24,13 @@ namespace shared_model {
        */
       virtual const types::AccountIdType &accountId() const = 0;
 
+      /**
+       * @return optional pagination metadata, all assets of the account
+       * are returned if it is not set
+       */
+      virtual boost::optional<const AssetPaginationMeta &> paginationMeta()
+          const = 0;
+
       std::string toString() const override;
 
       bool operator==(const ModelType &rhs) const override;
@@ -10,6 +10,7 @@
 
 #include "interfaces/base/model_primitive.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "interfaces/queries/account_detail_pagination_meta.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -24,6 +25,8 @@ namespace shared_model {
      *    will be returned
      *  - if there are both key and writer in a query, details written by this
      *    writer AND under this key will be returned
+     * The details are returned by pages ordered by writer and key, if the
+     * query has pagination metadata.
      */
     class GetAccountDetail : public ModelPrimitive<GetAccountDetail> {
      public:
@@ -42,6 +45,12 @@ namespace shared_model {
        */
       virtual boost::optional<types::AccountIdType> writer() const = 0;
 
+      /**
+       * @return optional pagination metadata
+       */
+      virtual boost::optional<const AccountDetailPaginationMeta &>
+      paginationMeta() const = 0;
+
       std::string toString() const override;
 
       bool operator==(const ModelType &rhs) const override;
@@ -0,0 +1,23 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "interfaces/queries/asset_pagination_meta.hpp"
+
+using namespace shared_model::interface;
+
+bool AssetPaginationMeta::operator==(const ModelType &rhs) const {
+  return pageSize() == rhs.pageSize() and firstAssetId() == rhs.firstAssetId();
+}
+
+std::string AssetPaginationMeta::toString() const {
+  auto pretty_builder = detail::PrettyStringBuilder()
+                            .init("AssetPaginationMeta")
+                            .append("page_size", std::to_string(pageSize()));
+  auto first_asset_id = firstAssetId();
+  if (first_asset_id) {
+    pretty_builder.append("first_asset_id", *first_asset_id);
+  }
+  return pretty_builder.finalize();
+}
@@ -9,15 +9,19 @@ namespace shared_model {
   namespace interface {
 
     std::string GetAccountAssets::toString() const {
-      return detail::PrettyStringBuilder()
-          .init("GetAccountAssets")
-          .append("account_id", accountId())
-          .finalize();
+      auto builder = detail::PrettyStringBuilder()
+                         .init("GetAccountAssets")
+                         .append("account_id", accountId());
+      if (auto pagination_meta = paginationMeta()) {
+        builder.append("pagination_meta", pagination_meta->toString());
+      }
+      return builder.finalize();
     }
 
     // TODO 07/06/2018 Akvinikym: types of rhs.accountId() and rhs.assetId() should be different IR-1397
     bool GetAccountAssets::operator==(const ModelType &rhs) const {
-      return accountId() == rhs.accountId();
+      return accountId() == rhs.accountId()
+          and paginationMeta() == rhs.paginationMeta();
     }
 
   }  // namespace interface
@@ -9,17 +9,21 @@ namespace shared_model {
   namespace interface {
 
     std::string GetAccountDetail::toString() const {
-      return detail::PrettyStringBuilder()
-          .init("GetAccountDetail")
-          .append("account_id", accountId())
-          .append("key", key() ? *key() : "")
-          .append("writer", writer() ? *writer() : "")
-          .finalize();
+      auto builder = detail::PrettyStringBuilder()
+                         .init("GetAccountDetail")
+                         .append("account_id", accountId())
+                         .append("key", key() ? *key() : "")
+                         .append("writer", writer() ? *writer() : "");
+      if (auto pagination_meta = paginationMeta()) {
+        builder.append("pagination_meta", pagination_meta->toString());
+      }
+      return builder.finalize();
     }
 
     bool GetAccountDetail::operator==(const ModelType &rhs) const {
       return accountId() == rhs.accountId() and key() == rhs.key()
-          and writer() == rhs.writer();
+          and writer() == rhs.writer()
+          and paginationMeta() == rhs.paginationMeta();
     }
 
   }  // namespace interface
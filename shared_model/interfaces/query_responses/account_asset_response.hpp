@@ -6,6 +6,8 @@
 #ifndef IROHA_SHARED_MODEL_ACCOUNT_ASSET_RESPONSE_HPP
 #define IROHA_SHARED_MODEL_ACCOUNT_ASSET_RESPONSE_HPP
 
+#include <boost/optional/optional_fwd.hpp>
+
 #include "interfaces/base/model_primitive.hpp"
 #include "interfaces/common_objects/account_asset.hpp"
 #include "interfaces/common_objects/range_types.hpp"
@@ -22,6 +24,17 @@ namespace shared_model {
        */
       virtual const types::AccountAssetCollectionType accountAssets() const = 0;
 
+      /**
+       * @return asset id of the first asset from the next page
+       */
+      virtual boost::optional<types::AssetIdType> nextAssetId() const = 0;
+
+      /**
+       * @return total number of assets of the account
+       */
+      virtual types::AccountAssetsNumberType totalAccountAssetsNumber()
+          const = 0;
+
       std::string toString() const override;
 
       bool operator==(const ModelType &rhs) const override;
@@ -6,8 +6,11 @@
 #ifndef IROHA_SHARED_MODEL_ACCOUNT_DETAIL_RESPONSE_HPP
 #define IROHA_SHARED_MODEL_ACCOUNT_DETAIL_RESPONSE_HPP
 
+#include <boost/optional.hpp>
+
 #include "interfaces/base/model_primitive.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "interfaces/queries/account_detail_record_id.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -21,6 +24,17 @@ namespace shared_model {
        */
       virtual const types::DetailType &detail() const = 0;
 
+      /**
+       * @return total number of account details matching the query
+       */
+      virtual types::AccountDetailsNumberType totalNumber() const = 0;
+
+      /**
+       * @return id of the first record from the next page
+       */
+      virtual boost::optional<const AccountDetailRecordId &> nextRecordId()
+          const = 0;
+
       std::string toString() const override;
 
       bool operator==(const ModelType &rhs) const override;
@@ -4,6 +4,8 @@
  */
 
 #include "interfaces/query_responses/account_asset_response.hpp"
+
+#include <boost/optional.hpp>
 #include "utils/string_builder.hpp"
 
 namespace shared_model {
@@ -14,11 +16,18 @@ namespace shared_model {
           detail::PrettyStringBuilder().init("AccountAssetResponse");
       for (const auto &asset : accountAssets())
         response.append(asset.toString());
+      response.append("total number",
+                      std::to_string(totalAccountAssetsNumber()));
+      if (auto next_asset_id = nextAssetId()) {
+        response.append("next asset id", *next_asset_id);
+      }
       return response.finalize();
     }
 
     bool AccountAssetResponse::operator==(const ModelType &rhs) const {
-      return accountAssets() == rhs.accountAssets();
+      return accountAssets() == rhs.accountAssets()
+          and nextAssetId() == rhs.nextAssetId()
+          and totalAccountAssetsNumber() == rhs.totalAccountAssetsNumber();
     }
 
   }  // namespace interface
@@ -10,14 +10,19 @@ namespace shared_model {
   namespace interface {
 
     std::string AccountDetailResponse::toString() const {
-      return detail::PrettyStringBuilder()
-          .init("AccountDetailResponse")
-          .append(detail())
-          .finalize();
+      auto builder = detail::PrettyStringBuilder()
+                         .init("AccountDetailResponse")
+                         .append(detail())
+                         .append("total number", std::to_string(totalNumber()));
+      if (auto next_record_id = nextRecordId()) {
+        builder.append("next record id", next_record_id->toString());
+      }
+      return builder.finalize();
     }
 
     bool AccountDetailResponse::operator==(const ModelType &rhs) const {
-      return detail() == rhs.detail();
+      return detail() == rhs.detail() and totalNumber() == rhs.totalNumber()
+          and nextRecordId() == rhs.nextRecordId();
     }
 
   }  // namespace interface
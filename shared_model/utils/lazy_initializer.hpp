@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_LAZY_INITIALIZER_HPP
+#define IROHA_SHARED_MODEL_LAZY_INITIALIZER_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <boost/optional.hpp>
+
+namespace shared_model {
+  namespace detail {
+
+    /**
+     * Value, which is generated on the first access. Concurrent accesses are
+     * safe, the value is generated once.
+     * @tparam T - type of the value
+     */
+    template <typename T>
+    class LazyInitializer {
+     public:
+      using GeneratorType = std::function<T()>;
+
+      explicit LazyInitializer(GeneratorType generator)
+          : generator_(std::move(generator)),
+            flag_(std::make_unique<std::once_flag>()) {}
+
+      const T &operator*() const {
+        std::call_once(*flag_, [this] { value_ = generator_(); });
+        return *value_;
+      }
+
+      const T *operator->() const {
+        return &**this;
+      }
+
+      /**
+       * Drop the generated value, so it is generated again on the next
+       * access. Must not be called concurrently with the accesses.
+       */
+      void invalidate() {
+        flag_ = std::make_unique<std::once_flag>();
+        value_ = boost::none;
+      }
+
+     private:
+      GeneratorType generator_;
+      std::unique_ptr<std::once_flag> flag_;
+      mutable boost::optional<T> value_;
+    };
+
+  }  // namespace detail
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_LAZY_INITIALIZER_HPP
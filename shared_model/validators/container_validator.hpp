@@ -10,6 +10,7 @@
 #include "datetime/time.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/iroha_internal/proposal.hpp"
 #include "validators/answer.hpp"
 #include "validators/validators_common.hpp"
 
@@ -24,15 +25,22 @@ namespace shared_model {
               typename TransactionsCollectionValidator>
     class ContainerValidator {
      protected:
-      void validateTransactions(
-          ReasonsGroupType &reason,
-          const interface::types::TransactionsCollectionType &transactions,
-          interface::types::TimestampType current_timestamp) const {
-        auto answer = transactions_collection_validator_.validate(
-            transactions, current_timestamp);
-        if (answer.hasErrors()) {
-          reason.second.push_back(answer.reason());
-        }
+      void validateTransactions(ReasonsGroupType &reason,
+                                const interface::Block &block) const {
+        addReason(reason,
+                  transactions_collection_validator_.validate(
+                      block.transactions(), block.createdTime()));
+      }
+
+      /// batches of the proposal are parsed once, when it is made, so they
+      /// are validated without parsing the transactions again
+      void validateTransactions(ReasonsGroupType &reason,
+                                const interface::Proposal &proposal) const {
+        addReason(reason,
+                  transactions_collection_validator_.validate(
+                      proposal.transactions(),
+                      proposal.batches(),
+                      proposal.createdTime()));
       }
 
       explicit ContainerValidator(
@@ -62,7 +70,7 @@ namespace shared_model {
         field_validator_.validateHeight(reason, cont.height());
         std::forward<Validator>(validator)(reason, cont);
 
-        validateTransactions(reason, cont.transactions(), cont.createdTime());
+        validateTransactions(reason, cont);
         if (not reason.second.empty()) {
           answer.addReason(std::move(reason));
         }
@@ -74,6 +82,12 @@ namespace shared_model {
       }
 
      private:
+      static void addReason(ReasonsGroupType &reason, Answer answer) {
+        if (answer.hasErrors()) {
+          reason.second.push_back(answer.reason());
+        }
+      }
+
       TransactionsCollectionValidator transactions_collection_validator_;
 
      protected:
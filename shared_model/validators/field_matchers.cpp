@@ -0,0 +1,137 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <algorithm>
+
+namespace {
+
+  using Iterator = std::string::const_iterator;
+
+  bool isLower(char c) {
+    return c >= 'a' and c <= 'z';
+  }
+
+  bool isAlpha(char c) {
+    return isLower(c) or (c >= 'A' and c <= 'Z');
+  }
+
+  bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+  }
+
+  bool isAlnum(char c) {
+    return isAlpha(c) or isDigit(c);
+  }
+
+  /// [a-z_0-9]{1,32}
+  bool matchName(Iterator begin, Iterator end) {
+    auto size = end - begin;
+    return size >= 1 and size <= 32 and std::all_of(begin, end, [](char c) {
+             return isLower(c) or isDigit(c) or c == '_';
+           });
+  }
+
+  /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?
+  bool matchLabel(Iterator begin, Iterator end) {
+    auto size = end - begin;
+    return size >= 1 and size <= 63 and isAlpha(*begin)
+        and isAlnum(*(end - 1)) and std::all_of(begin, end, [](char c) {
+             return isAlnum(c) or c == '-';
+           });
+  }
+
+  /// labels, separated by dots
+  bool matchDomain(Iterator begin, Iterator end) {
+    while (true) {
+      auto dot = std::find(begin, end, '.');
+      if (not matchLabel(begin, dot)) {
+        return false;
+      }
+      if (dot == end) {
+        return true;
+      }
+      begin = dot + 1;
+    }
+  }
+
+  /// decimal number in range [0, max] without leading zeros
+  bool matchNumber(Iterator begin, Iterator end, unsigned long max) {
+    if (begin == end or (end - begin > 1 and *begin == '0')) {
+      return false;
+    }
+    unsigned long value = 0;
+    for (; begin != end; ++begin) {
+      if (not isDigit(*begin)) {
+        return false;
+      }
+      value = value * 10 + (*begin - '0');
+      if (value > max) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// four numbers in range [0, 255], separated by dots
+  bool matchIpV4(Iterator begin, Iterator end) {
+    for (int i = 0; i < 3; ++i) {
+      auto dot = std::find(begin, end, '.');
+      if (dot == end or not matchNumber(begin, dot, 255)) {
+        return false;
+      }
+      begin = dot + 1;
+    }
+    return matchNumber(begin, end, 255);
+  }
+
+  /// name, separator and domain
+  bool matchQualifiedName(const std::string &str, char separator) {
+    auto position = std::find(str.begin(), str.end(), separator);
+    return position != str.end() and matchName(str.begin(), position)
+        and matchDomain(position + 1, str.end());
+  }
+
+}  // namespace
+
+namespace shared_model {
+  namespace validation {
+
+    bool matchName(const std::string &str) {
+      return ::matchName(str.begin(), str.end());
+    }
+
+    bool matchDomain(const std::string &str) {
+      return ::matchDomain(str.begin(), str.end());
+    }
+
+    bool matchAccountId(const std::string &str) {
+      return matchQualifiedName(str, '@');
+    }
+
+    bool matchAssetId(const std::string &str) {
+      return matchQualifiedName(str, '#');
+    }
+
+    bool matchDetailKey(const std::string &str) {
+      return str.size() >= 1 and str.size() <= 64
+          and std::all_of(str.begin(), str.end(), [](char c) {
+                return isAlnum(c) or c == '_';
+              });
+    }
+
+    bool matchPeerAddress(const std::string &str) {
+      auto colon = std::find(str.begin(), str.end(), ':');
+      if (colon == str.end()) {
+        return false;
+      }
+      auto host_matches = matchIpV4(str.begin(), colon)
+          or ::matchDomain(str.begin(), colon);
+      return host_matches and matchNumber(colon + 1, str.end(), 65535);
+    }
+
+  }  // namespace validation
+}  // namespace shared_model
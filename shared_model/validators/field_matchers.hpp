@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FIELD_MATCHERS_HPP
+#define IROHA_FIELD_MATCHERS_HPP
+
+#include <string>
+
+namespace shared_model {
+  namespace validation {
+
+    /**
+     * Matchers of the identifiers checked by FieldValidator. Each of them
+     * accepts exactly the language of the pattern in its description, but
+     * runs in a single pass over the string without a regex engine.
+     */
+
+    /**
+     * Check account name, asset name and role id
+     * Pattern: [a-z_0-9]{1,32}
+     */
+    bool matchName(const std::string &str);
+
+    /**
+     * Check domain id, which is a hostname following RFC1035 and RFC1123
+     * Pattern: ([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*
+     *          [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?
+     */
+    bool matchDomain(const std::string &str);
+
+    /**
+     * Check account id
+     * Pattern: name\@domain
+     */
+    bool matchAccountId(const std::string &str);
+
+    /**
+     * Check asset id
+     * Pattern: name\#domain
+     */
+    bool matchAssetId(const std::string &str);
+
+    /**
+     * Check account detail key
+     * Pattern: [A-Za-z0-9_]{1,64}
+     */
+    bool matchDetailKey(const std::string &str);
+
+    /**
+     * Check peer address, which is an IPv4 address or a domain with a port
+     * in range [0, 65535], both without leading zeros
+     * Pattern: (ipv4|domain):port
+     */
+    bool matchPeerAddress(const std::string &str);
+
+  }  // namespace validation
+}  // namespace shared_model
+
+#endif  // IROHA_FIELD_MATCHERS_HPP
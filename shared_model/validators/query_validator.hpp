@@ -116,6 +116,9 @@ namespace shared_model {
         reason.first = "GetAccountAssets";
 
         validator_.validateAccountId(reason, qry.accountId());
+        if (auto pagination_meta = qry.paginationMeta()) {
+          validator_.validateAssetPaginationMeta(reason, *pagination_meta);
+        }
         return reason;
       }
 
@@ -131,6 +134,10 @@ namespace shared_model {
         if (qry.writer()) {
           validator_.validateAccountId(reason, *qry.writer());
         }
+        if (auto pagination_meta = qry.paginationMeta()) {
+          validator_.validateAccountDetailPaginationMeta(reason,
+                                                         *pagination_meta);
+        }
 
         return reason;
       }
@@ -19,10 +19,15 @@ namespace shared_model {
 
       Answer validate(const interface::TransactionBatch &batch) const override;
 
-     private:
+      /**
+       * Validate a batch candidate without making the batch of it
+       * @param transactions - transactions of the batch candidate
+       * @return Answer containing found errors if any
+       */
       Answer validate(interface::types::TransactionsForwardCollectionType
                           transactions) const;
 
+     private:
       const uint64_t max_batch_size_;
       const bool partial_ordered_batches_are_valid_;
     };
@@ -10,7 +10,6 @@
 #include <boost/format.hpp>
 #include <boost/range/adaptor/indirected.hpp>
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
-#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "validators/default_validator.hpp"
 #include "validators/field_validator.hpp"
@@ -31,11 +30,12 @@ namespace shared_model {
           batch_validator_(std::make_shared<BatchValidator>(config)) {}
 
     template <typename TransactionValidator, bool CollectionCanBeEmpty>
-    template <typename Validator>
+    template <typename Batches, typename Validator>
     Answer TransactionsCollectionValidator<TransactionValidator,
                                            CollectionCanBeEmpty>::
         validateImpl(const interface::types::TransactionsForwardCollectionType
                          &transactions,
+                     const Batches &batches,
                      Validator &&validator) const {
       Answer res;
       ReasonsGroupType reason;
@@ -61,18 +61,9 @@ namespace shared_model {
         }
       }
 
-      interface::TransactionBatchParserImpl batch_parser;
-      auto batches = batch_parser.parseBatches(transactions);
-      for (auto &batch : batches) {
-        interface::types::SharedTxsCollectionType batch_transactions;
-        for (auto &tx : batch) {
-          batch_transactions.emplace_back(
-              const_cast<interface::Transaction *>(&tx), [](auto) {});
-        }
-        std::unique_ptr<interface::TransactionBatch> batch_ptr =
-            std::make_unique<interface::TransactionBatchImpl>(
-                batch_transactions);
-        if (auto answer = batch_validator_->validate(*batch_ptr)) {
+      // batch candidates are validated in place, without making batches
+      for (const auto &batch : batches) {
+        if (auto answer = batch_validator_->validate(batch)) {
           reason.second.emplace_back(answer.reason());
         }
       }
@@ -88,9 +79,12 @@ namespace shared_model {
                                            CollectionCanBeEmpty>::
         validate(const shared_model::interface::types::
                      TransactionsForwardCollectionType &transactions) const {
-      return validateImpl(transactions, [this](const auto &tx) {
-        return transaction_validator_.validate(tx);
-      });
+      return validateImpl(transactions,
+                          interface::TransactionBatchParserImpl().parseBatches(
+                              transactions),
+                          [this](const auto &tx) {
+                            return transaction_validator_.validate(tx);
+                          });
     }
 
     template <typename TransactionValidator, bool CollectionCanBeEmpty>
@@ -108,7 +102,9 @@ namespace shared_model {
                      &transactions,
                  interface::types::TimestampType current_timestamp) const {
       return validateImpl(
-          transactions, [this, current_timestamp](const auto &tx) {
+          transactions,
+          interface::TransactionBatchParserImpl().parseBatches(transactions),
+          [this, current_timestamp](const auto &tx) {
             return transaction_validator_.validate(tx, current_timestamp);
           });
     }
@@ -122,6 +118,20 @@ namespace shared_model {
                       current_timestamp);
     }
 
+    template <typename TransactionValidator, bool CollectionCanBeEmpty>
+    Answer TransactionsCollectionValidator<TransactionValidator,
+                                           CollectionCanBeEmpty>::
+        validate(const interface::types::TransactionsForwardCollectionType
+                     &transactions,
+                 const std::vector<interface::types::TransactionsCollectionType>
+                     &batches,
+                 interface::types::TimestampType current_timestamp) const {
+      return validateImpl(
+          transactions, batches, [this, current_timestamp](const auto &tx) {
+            return transaction_validator_.validate(tx, current_timestamp);
+          });
+    }
+
     template <typename TransactionValidator, bool CollectionCanBeEmpty>
     const TransactionValidator &TransactionsCollectionValidator<
         TransactionValidator,
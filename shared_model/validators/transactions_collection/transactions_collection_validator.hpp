@@ -6,6 +6,7 @@
 #ifndef IROHA_TRANSACTIONS_COLLECTION_VALIDATOR_HPP
 #define IROHA_TRANSACTIONS_COLLECTION_VALIDATOR_HPP
 
+#include "interfaces/common_objects/range_types.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "validators/answer.hpp"
@@ -22,14 +23,20 @@ namespace shared_model {
     class TransactionsCollectionValidator {
      protected:
       TransactionValidator transaction_validator_;
-      std::shared_ptr<AbstractValidator<interface::TransactionBatch>>
-          batch_validator_;
+      std::shared_ptr<BatchValidator> batch_validator_;
 
      private:
-      template <typename Validator>
+      /**
+       * Validate each transaction and each batch candidate of the collection
+       * @param transactions - collection of transactions
+       * @param batches - transactions split into batch candidates
+       * @param validator - validator of a single transaction
+       */
+      template <typename Batches, typename Validator>
       Answer validateImpl(
           const interface::types::TransactionsForwardCollectionType
               &transactions,
+          const Batches &batches,
           Validator &&validator) const;
 
       explicit TransactionsCollectionValidator(
@@ -63,6 +70,21 @@ namespace shared_model {
           const interface::types::SharedTxsCollectionType &transactions,
           interface::types::TimestampType current_timestamp) const;
 
+      /**
+       * Validates collection of transactions, which is already split into
+       * batch candidates, so it is not parsed again
+       * @param transactions collection of transactions
+       * @param batches batch candidates of the transactions
+       * @param current_timestamp time to check the transactions against
+       * @return Answer containing errors if any
+       */
+      Answer validate(
+          const interface::types::TransactionsForwardCollectionType
+              &transactions,
+          const std::vector<interface::types::TransactionsCollectionType>
+              &batches,
+          interface::types::TimestampType current_timestamp) const;
+
       const TransactionValidator &getTransactionValidator() const;
     };
 
@@ -5,7 +5,7 @@
 
 #include "validators/validators_common.hpp"
 
-#include <regex>
+#include <algorithm>
 
 namespace shared_model {
   namespace validation {
@@ -17,8 +17,10 @@ namespace shared_model {
     }
 
     bool validateHexString(const std::string &str) {
-      static const std::regex hex_regex{R"([0-9a-fA-F]*)"};
-      return std::regex_match(str, hex_regex);
+      return std::all_of(str.begin(), str.end(), [](char c) {
+        return (c >= '0' and c <= '9') or (c >= 'a' and c <= 'f')
+            or (c >= 'A' and c <= 'F');
+      });
     }
 
   }  // namespace validation
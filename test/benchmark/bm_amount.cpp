@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Amount keeps values, which fit into 64 bits, natively and falls back to
+ * uint256 only for larger ones. The benchmarks measure parsing, comparison
+ * and copying of typical balances and of values, which need uint256.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "interfaces/common_objects/amount.hpp"
+
+using shared_model::interface::Amount;
+
+/// typical balance
+const std::string kSmallAmount = "1234567.89";
+/// half of the max value of uint256
+const std::string kLargeAmount =
+    "57896044618658097711785492504343953926634992332820282019728792003956564819"
+    "967.0";
+
+static void BM_ParseAmount(benchmark::State &state, const std::string &str) {
+  while (state.KeepRunning()) {
+    Amount amount(str);
+    benchmark::DoNotOptimize(amount.isZero());
+  }
+}
+BENCHMARK_CAPTURE(BM_ParseAmount, Small, kSmallAmount);
+BENCHMARK_CAPTURE(BM_ParseAmount, Large, kLargeAmount);
+
+static void BM_CompareAmounts(benchmark::State &state,
+                              const std::string &lhs_str,
+                              const std::string &rhs_str) {
+  Amount lhs(lhs_str), rhs(rhs_str);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(lhs.compare(rhs));
+  }
+}
+BENCHMARK_CAPTURE(BM_CompareAmounts, Small, kSmallAmount, "1234567.9");
+BENCHMARK_CAPTURE(BM_CompareAmounts, Large, kLargeAmount, kSmallAmount);
+
+static void BM_CopyAmount(benchmark::State &state, const std::string &str) {
+  Amount amount(str);
+  while (state.KeepRunning()) {
+    Amount copy(amount);
+    benchmark::DoNotOptimize(copy.precision());
+  }
+}
+BENCHMARK_CAPTURE(BM_CopyAmount, Small, kSmallAmount);
+BENCHMARK_CAPTURE(BM_CopyAmount, Large, kLargeAmount);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,184 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Stateless validation checks the identifiers of every command of every
+ * transaction. The field validator used to match them with std::regex, now
+ * it uses hand-written matchers of the same languages.
+ *
+ * The benchmarks check the identifiers of a TxList with 1000 transactions
+ * both ways, so the speedup can be seen, and run the whole stateless
+ * validation of the list.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <regex>
+
+#include "datetime/time.hpp"
+#include "endpoint.pb.h"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/default_validator.hpp"
+#include "validators/field_matchers.hpp"
+
+/// number of transactions in the list
+constexpr int number_of_txs = 1000;
+
+class FieldValidatorBenchmark : public benchmark::Fixture {
+ public:
+  /// identifiers of the list, which are checked by the field validator
+  struct Fields {
+    std::vector<std::string> names;
+    std::vector<std::string> domains;
+    std::vector<std::string> account_ids;
+    std::vector<std::string> asset_ids;
+    std::vector<std::string> detail_keys;
+  };
+
+  void SetUp(benchmark::State &st) override {
+    const std::string domain = "test.domain";
+    const std::string creator = "admin@" + domain;
+    const std::string asset = "coin#" + domain;
+    shared_model::crypto::PublicKey public_key(std::string(32, '0'));
+
+    for (int i = 0; i < number_of_txs; i++) {
+      auto name = "user" + std::to_string(i);
+      auto account = name + "@" + domain;
+      auto key = "key_" + std::to_string(i);
+      auto tx = TestTransactionBuilder()
+                    .createdTime(iroha::time::now())
+                    .creatorAccountId(creator)
+                    .quorum(1)
+                    .createAccount(name, domain, public_key)
+                    .transferAsset(creator, account, asset, "", "5.00")
+                    .setAccountDetail(account, key, "value")
+                    .build();
+      *tx_list.add_transactions() = tx.getTransport();
+
+      fields.names.push_back(name);
+      fields.domains.push_back(domain);
+      fields.account_ids.insert(fields.account_ids.end(),
+                                {creator, creator, creator, account, account});
+      fields.asset_ids.push_back(asset);
+      fields.detail_keys.push_back(key);
+    }
+  }
+
+  void TearDown(benchmark::State &st) override {
+    tx_list.Clear();
+    fields = Fields{};
+  }
+
+  iroha::protocol::TxList tx_list;
+  Fields fields;
+};
+
+/**
+ * Check all the identifiers of the list with the checker of each kind
+ */
+template <typename Name,
+          typename Domain,
+          typename AccountId,
+          typename AssetId,
+          typename DetailKey>
+bool checkFields(const FieldValidatorBenchmark::Fields &fields,
+                 Name &&name,
+                 Domain &&domain,
+                 AccountId &&account_id,
+                 AssetId &&asset_id,
+                 DetailKey &&detail_key) {
+  bool result = true;
+  for (const auto &value : fields.names) {
+    result &= name(value);
+  }
+  for (const auto &value : fields.domains) {
+    result &= domain(value);
+  }
+  for (const auto &value : fields.account_ids) {
+    result &= account_id(value);
+  }
+  for (const auto &value : fields.asset_ids) {
+    result &= asset_id(value);
+  }
+  for (const auto &value : fields.detail_keys) {
+    result &= detail_key(value);
+  }
+  return result;
+}
+
+/**
+ * Benchmark the identifier checks with the regular expressions, which the
+ * field validator used before
+ */
+BENCHMARK_DEFINE_F(FieldValidatorBenchmark, RegexTest)(benchmark::State &st) {
+  const std::string name_pattern = R"#([a-z_0-9]{1,32})#";
+  const std::string domain_pattern =
+      R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*)#"
+      R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#";
+  const std::regex name_regex(name_pattern);
+  const std::regex domain_regex(domain_pattern);
+  const std::regex account_id_regex(name_pattern + R"#(\@)#" + domain_pattern);
+  const std::regex asset_id_regex(name_pattern + R"#(\#)#" + domain_pattern);
+  const std::regex detail_key_regex(R"([A-Za-z0-9_]{1,64})");
+
+  auto matcher = [](const std::regex &regex) {
+    return [&regex](const std::string &value) {
+      return std::regex_match(value, regex);
+    };
+  };
+
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(checkFields(fields,
+                                         matcher(name_regex),
+                                         matcher(domain_regex),
+                                         matcher(account_id_regex),
+                                         matcher(asset_id_regex),
+                                         matcher(detail_key_regex)));
+  }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
+}
+
+/**
+ * Benchmark the identifier checks with the field matchers
+ */
+BENCHMARK_DEFINE_F(FieldValidatorBenchmark, MatcherTest)
+(benchmark::State &st) {
+  using namespace shared_model::validation;
+
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(checkFields(fields,
+                                         matchName,
+                                         matchDomain,
+                                         matchAccountId,
+                                         matchAssetId,
+                                         matchDetailKey));
+  }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
+}
+
+/**
+ * Benchmark stateless validation of all the transactions of the list
+ */
+BENCHMARK_DEFINE_F(FieldValidatorBenchmark, StatelessValidationTest)
+(benchmark::State &st) {
+  shared_model::validation::DefaultUnsignedTransactionValidator validator(
+      iroha::test::kTestsValidatorsConfig);
+  std::vector<shared_model::proto::Transaction> txs(
+      tx_list.transactions().begin(), tx_list.transactions().end());
+
+  while (st.KeepRunning()) {
+    for (const auto &tx : txs) {
+      benchmark::DoNotOptimize(validator.validate(tx));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
+}
+
+BENCHMARK_REGISTER_F(FieldValidatorBenchmark, RegexTest);
+BENCHMARK_REGISTER_F(FieldValidatorBenchmark, MatcherTest);
+BENCHMARK_REGISTER_F(FieldValidatorBenchmark, StatelessValidationTest);
+
+BENCHMARK_MAIN();
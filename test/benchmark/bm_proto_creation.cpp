@@ -14,6 +14,10 @@
  * 
  * Each benchmark runs transaction() and commands() call to 
  * initialize possibly lazy fields.
+ *
+ * Block and proposal benchmarks report the number of processed transactions,
+ * so the construction cost per transaction can be compared with the cost of
+ * a standalone transaction.
  */
 
 #include <benchmark/benchmark.h>
@@ -59,6 +63,23 @@ class BlockBenchmark : public benchmark::Fixture {
   }
 };
 
+class TransactionBenchmark : public benchmark::Fixture {
+ public:
+  iroha::protocol::Transaction proto_tx;
+
+  void SetUp(benchmark::State &st) override {
+    TestTransactionBuilder txbuilder;
+
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+
+    for (int i = 0; i < number_of_commands; i++) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+
+    proto_tx = base_tx.build().getTransport();
+  }
+};
+
 class ProposalBenchmark : public benchmark::Fixture {
  public:
   // Block cannot be copy-assigned, that's why state is kept in a builder
@@ -125,6 +146,7 @@ BENCHMARK_DEFINE_F(BlockBenchmark, TransportCopyTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
 }
 
 /**
@@ -133,13 +155,14 @@ BENCHMARK_DEFINE_F(BlockBenchmark, TransportCopyTest)(benchmark::State &st) {
 BENCHMARK_DEFINE_F(BlockBenchmark, TransportMoveTest)(benchmark::State &st) {
   while (st.KeepRunning()) {
     auto block = complete_builder.build();
-    iroha::protocol::Block proto_block = block.getTransport();
+    iroha::protocol::Block_v1 proto_block = block.getTransport();
 
     runBenchmark(st, [&proto_block] {
       shared_model::proto::Block copy(std::move(proto_block));
       checkLoop(copy);
     });
   }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
 }
 
 /**
@@ -154,6 +177,7 @@ BENCHMARK_DEFINE_F(BlockBenchmark, MoveTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
 }
 
 /**
@@ -168,6 +192,41 @@ BENCHMARK_DEFINE_F(BlockBenchmark, CloneTest)(benchmark::State &st) {
       checkLoop(*copy);
     });
   }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
+}
+
+/**
+ * Benchmark transaction creation by copying protobuf object, only the hash of
+ * the transaction is used
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, TransportCopyTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    runBenchmark(st, [this] {
+      shared_model::proto::Transaction tx(proto_tx);
+      benchmark::DoNotOptimize(tx.hash());
+      benchmark::DoNotOptimize(tx.commands());
+    });
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+
+/**
+ * Benchmark transaction creation by copying protobuf object, when all the
+ * blobs and hashes of the transaction are used
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, AllBlobsTest)(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    runBenchmark(st, [this] {
+      shared_model::proto::Transaction tx(proto_tx);
+      benchmark::DoNotOptimize(tx.hash());
+      benchmark::DoNotOptimize(tx.reducedHash());
+      benchmark::DoNotOptimize(tx.blob());
+      benchmark::DoNotOptimize(tx.payload());
+      benchmark::DoNotOptimize(tx.reducedPayload());
+    });
+  }
+  st.SetItemsProcessed(st.iterations());
 }
 
 /**
@@ -182,6 +241,7 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, TransportCopyTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
 }
 
 /**
@@ -197,6 +257,7 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, TransportMoveTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
 }
 
 /**
@@ -211,6 +272,7 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, MoveTest)(benchmark::State &st) {
       checkLoop(copy);
     });
   }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
 }
 
 /**
@@ -225,12 +287,15 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, CloneTest)(benchmark::State &st) {
       checkLoop(*copy);
     });
   }
+  st.SetItemsProcessed(st.iterations() * number_of_txs);
 }
 
 BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, AllBlobsTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportMoveTest)->UseManualTime();
@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The node signs its votes and blocks with the same keypair all the time.
+ * The benchmarks compare signing with the keypair passed to every call and
+ * with a long-lived signer, which keeps the converted keys.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+
+using namespace shared_model::crypto;
+
+/// size of the signed payload, which is close to the one of a vote
+constexpr size_t kPayloadSize = 128;
+
+static void BM_SignWithKeypair(benchmark::State &state) {
+  auto keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  Blob blob(std::string(kPayloadSize, 'a'));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(CryptoSigner<>::sign(blob, keypair));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SignWithKeypair);
+
+static void BM_SignWithKeypairSigner(benchmark::State &state) {
+  CryptoSigner<>::KeypairSignerType signer(
+      DefaultCryptoAlgorithmType::generateKeypair());
+  Blob blob(std::string(kPayloadSize, 'a'));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(signer.sign(blob));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SignWithKeypairSigner);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,212 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <thread>
+
+#include "ametsuchi/temporary_wsv.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "benchmark/bm_utils.hpp"
+#include "framework/integration_framework/test_irohad.hpp"
+#include "framework/test_logger.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
+
+using namespace benchmark::utils;
+using namespace common_constants;
+
+const auto kTransfersNumber = 10000;
+const std::string kAmount = "1.0";
+
+/**
+ * This benchmark runs stateful validation of a proposal with 10k transfer
+ * transactions in order to measure command execution performance
+ * @param state
+ */
+static void BM_StatefulValidationTransfers(benchmark::State &state) {
+  integration_framework::IntegrationTestFramework itf(1);
+  itf.setInitialState(kAdminKeypair);
+  itf.sendTx(createUserWithPerms(
+                 kUser,
+                 kUserKeypair.publicKey(),
+                 kRole,
+                 {shared_model::interface::permissions::Role::kReceive})
+                 .build()
+                 .signAndAddSignature(kAdminKeypair)
+                 .finish());
+  itf.skipProposal().skipBlock();
+  itf.sendTx(TestUnsignedTransactionBuilder()
+                 .creatorAccountId(kAdminId)
+                 .createdTime(iroha::time::now())
+                 .quorum(1)
+                 .addAssetQuantity(kAssetId, std::to_string(kTransfersNumber))
+                 .build()
+                 .signAndAddSignature(kAdminKeypair)
+                 .finish());
+  itf.skipProposal().skipBlock();
+
+  std::vector<shared_model::proto::Transaction> transactions;
+  transactions.reserve(kTransfersNumber);
+  auto created_time = iroha::time::now();
+  for (int i = 0; i < kTransfersNumber; i++) {
+    transactions.push_back(
+        TestUnsignedTransactionBuilder()
+            .creatorAccountId(kAdminId)
+            .createdTime(created_time + i)
+            .quorum(1)
+            .transferAsset(
+                kAdminId, kUserId, kAssetId, std::to_string(i), kAmount)
+            .build()
+            .signAndAddSignature(kAdminKeypair)
+            .finish());
+  }
+  auto proposal = TestProposalBuilder()
+                      .height(3)
+                      .createdTime(created_time)
+                      .transactions(transactions)
+                      .build();
+
+  // all transfers share the sender, so they can not be validated in parallel
+  iroha::validation::StatefulValidatorImpl validator(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      nullptr,
+      1,
+      getTestLogger("StatefulValidator"));
+  auto &storage = itf.getIrohaInstance().getIrohaInstance()->getStorage();
+
+  while (state.KeepRunning()) {
+    auto validated = storage->createTemporaryWsv().match(
+        [&](auto &&wsv) {
+          auto verified = validator.validate(proposal, *wsv.value);
+          if (not verified->rejected_transactions.empty()) {
+            state.SkipWithError("Some transfers were rejected");
+            return false;
+          }
+          return true;
+        },
+        [&](const auto &error) {
+          state.SkipWithError(error.error.c_str());
+          return false;
+        });
+    if (not validated) {
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kTransfersNumber);
+  itf.done();
+}
+BENCHMARK(BM_StatefulValidationTransfers)->Unit(benchmark::kMillisecond);
+
+const auto kPairsNumber = 64;
+
+/**
+ * This benchmark runs stateful validation of a proposal with 10k transfer
+ * transactions of one asset within 64 pairs of accounts, each sender
+ * transferring to its own receiver. Only the transfers of one pair conflict,
+ * so the pairs are validated on the given number of workers in parallel
+ * @param state - range(0) is the number of workers
+ */
+static void BM_StatefulValidationIndependent(benchmark::State &state) {
+  integration_framework::IntegrationTestFramework itf(1);
+  itf.setInitialState(kAdminKeypair);
+  auto sender = [](int pair) {
+    return "sender" + std::to_string(pair) + "@" + kDomain;
+  };
+  auto receiver = [](int pair) {
+    return "receiver" + std::to_string(pair) + "@" + kDomain;
+  };
+  auto create_accounts =
+      TestUnsignedTransactionBuilder()
+          .creatorAccountId(kAdminId)
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .createRole(kRole,
+                      {shared_model::interface::permissions::Role::kTransfer,
+                       shared_model::interface::permissions::Role::kReceive})
+          .addAssetQuantity(kAssetId,
+                            std::to_string(kTransfersNumber * kPairsNumber));
+  for (int i = 0; i < kPairsNumber; i++) {
+    create_accounts =
+        create_accounts
+            .createAccount(
+                "sender" + std::to_string(i), kDomain, kUserKeypair.publicKey())
+            .appendRole(sender(i), kRole)
+            .createAccount("receiver" + std::to_string(i),
+                           kDomain,
+                           kUserKeypair.publicKey())
+            .appendRole(receiver(i), kRole)
+            .transferAsset(kAdminId,
+                           sender(i),
+                           kAssetId,
+                           "",
+                           std::to_string(kTransfersNumber));
+  }
+  itf.sendTx(
+      create_accounts.build().signAndAddSignature(kAdminKeypair).finish());
+  itf.skipProposal().skipBlock();
+
+  std::vector<shared_model::proto::Transaction> transactions;
+  transactions.reserve(kTransfersNumber);
+  auto created_time = iroha::time::now();
+  for (int i = 0; i < kTransfersNumber; i++) {
+    auto pair = i % kPairsNumber;
+    transactions.push_back(
+        TestUnsignedTransactionBuilder()
+            .creatorAccountId(sender(pair))
+            .createdTime(created_time + i)
+            .quorum(1)
+            .transferAsset(
+                sender(pair), receiver(pair), kAssetId, "", kAmount)
+            .build()
+            .signAndAddSignature(kUserKeypair)
+            .finish());
+  }
+  auto proposal = TestProposalBuilder()
+                      .height(3)
+                      .createdTime(created_time)
+                      .transactions(transactions)
+                      .build();
+
+  auto &storage = itf.getIrohaInstance().getIrohaInstance()->getStorage();
+  iroha::validation::StatefulValidatorImpl validator(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      storage,
+      state.range(0),
+      getTestLogger("StatefulValidator"));
+
+  while (state.KeepRunning()) {
+    auto validated = storage->createTemporaryWsv().match(
+        [&](auto &&wsv) {
+          auto verified = validator.validate(proposal, *wsv.value);
+          if (not verified->rejected_transactions.empty()) {
+            state.SkipWithError("Some transfers were rejected");
+            return false;
+          }
+          return true;
+        },
+        [&](const auto &error) {
+          state.SkipWithError(error.error.c_str());
+          return false;
+        });
+    if (not validated) {
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kTransfersNumber);
+  itf.done();
+}
+BENCHMARK(BM_StatefulValidationIndependent)
+    ->Arg(1)
+    ->Arg(std::max(2u, std::thread::hardware_concurrency()))
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -10,6 +10,7 @@
 
 #include <boost/assert.hpp>
 #include <boost/thread/barrier.hpp>
+#include "ametsuchi/impl/flat_file_wsv_snapshot_storage.hpp"
 #include "ametsuchi/storage.hpp"
 #include "backend/protobuf/block.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
@@ -776,6 +777,9 @@ namespace integration_framework {
         and iroha_instance_->getIrohaInstance()->storage) {
       iroha_instance_->getIrohaInstance()->storage->dropStorage();
       boost::filesystem::remove_all(iroha_instance_->block_store_dir_);
+      boost::filesystem::remove_all(
+          iroha::ametsuchi::FlatFileWsvSnapshotStorage::directoryFor(
+              iroha_instance_->block_store_dir_));
     }
   }
 
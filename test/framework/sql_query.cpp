@@ -136,9 +136,14 @@ namespace framework {
     SqlQuery::getAccount(const AccountIdType &account_id) {
       using T = boost::tuple<DomainIdType, QuorumType, JsonType>;
       auto result = execute<T>([&] {
-        return (sql_.prepare << "SELECT domain_id, quorum, data "
-                                "FROM account WHERE account_id = "
-                                ":account_id",
+        return (sql_.prepare << "SELECT domain_id, quorum, "
+                                "(SELECT COALESCE(jsonb_object_agg(writer, "
+                                "details), '{}'::jsonb) FROM (SELECT writer, "
+                                "jsonb_object_agg(key, to_jsonb(value)) AS "
+                                "details FROM account_detail AS d WHERE "
+                                "d.account_id = a.account_id GROUP BY writer) "
+                                "AS writers) FROM account AS a "
+                                "WHERE account_id = :account_id",
                 soci::use(account_id, "account_id"));
       });
 
@@ -159,37 +164,41 @@ namespace framework {
 
       if (key.empty() and writer.empty()) {
         // retrieve all values for a specified account
-        std::string empty_json = "{}";
         result = execute<T>([&] {
           return (sql_.prepare
-                      << "SELECT data#>>:empty_json FROM account WHERE "
-                         "account_id = "
-                         ":account_id;",
-                  soci::use(empty_json),
+                      << "SELECT (SELECT COALESCE(jsonb_object_agg(writer, "
+                         "details), '{}'::jsonb) FROM (SELECT writer, "
+                         "jsonb_object_agg(key, to_jsonb(value)) AS details "
+                         "FROM account_detail AS d WHERE d.account_id = "
+                         "a.account_id GROUP BY writer) AS writers) #>> '{}' "
+                         "FROM account AS a WHERE account_id = :account_id;",
                   soci::use(account_id));
         });
       } else if (not key.empty() and not writer.empty()) {
         // retrieve values for the account, under the key and added by the
         // writer
-        std::string filled_json = "{\"" + writer + "\"" + ", \"" + key + "\"}";
         result = execute<T>([&] {
           return (sql_.prepare
                       << "SELECT json_build_object(:writer::text, "
-                         "json_build_object(:key::text, (SELECT data #>> "
-                         ":filled_json "
-                         "FROM account WHERE account_id = :account_id)));",
+                         "json_build_object(:key::text, (SELECT value "
+                         "FROM account_detail WHERE account_id = :account_id "
+                         "AND writer = :detail_writer "
+                         "AND key = :detail_key)));",
                   soci::use(writer),
                   soci::use(key),
-                  soci::use(filled_json),
-                  soci::use(account_id));
+                  soci::use(account_id),
+                  soci::use(writer),
+                  soci::use(key));
         });
       } else if (not writer.empty()) {
         // retrieve values added by the writer under all keys
         result = execute<T>([&] {
           return (
               sql_.prepare
-                  << "SELECT json_build_object(:writer::text, (SELECT data -> "
-                     ":writer FROM account WHERE account_id = :account_id));",
+                  << "SELECT json_build_object(:writer::text, (SELECT "
+                     "jsonb_object_agg(key, to_jsonb(value)) FROM "
+                     "account_detail WHERE account_id = :account_id AND "
+                     "writer = :writer));",
               soci::use(writer, "writer"),
               soci::use(account_id, "account_id"));
         });
@@ -198,14 +207,11 @@ namespace framework {
         result = execute<T>([&] {
           return (
               sql_.prepare
-                  << "SELECT json_object_agg(key, value) AS json FROM (SELECT "
-                     "json_build_object(kv.key, json_build_object(:key::text, "
-                     "kv.value -> :key)) FROM jsonb_each((SELECT data FROM "
-                     "account "
-                     "WHERE account_id = :account_id)) kv WHERE kv.value ? "
-                     ":key) "
-                     "AS "
-                     "jsons, json_each(json_build_object);",
+                  << "SELECT json_object_agg(writer, json_build_object("
+                     ":key::text, to_jsonb(value)) ORDER BY "
+                     "octet_length(writer), writer COLLATE \"C\") AS json "
+                     "FROM account_detail WHERE account_id = :account_id AND "
+                     "key = :key;",
               soci::use(key, "key"),
               soci::use(account_id, "account_id"));
         });
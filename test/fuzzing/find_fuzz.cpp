@@ -45,6 +45,7 @@ struct QueryFixture {
         storage_,
         pending_transactions_,
         query_response_factory_,
+        nullptr,
         logger::getDummyLoggerPtr());
 
     std::unique_ptr<shared_model::validation::AbstractValidator<
@@ -12,6 +12,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include "ametsuchi/impl/flat_file_wsv_snapshot_storage.hpp"
 #include "ametsuchi/impl/in_memory_block_storage_factory.hpp"
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
@@ -72,6 +73,8 @@ namespace iroha {
         sql->close();
         storage->dropStorage();
         boost::filesystem::remove_all(block_store_path);
+        boost::filesystem::remove_all(
+            FlatFileWsvSnapshotStorage::directoryFor(block_store_path));
       }
 
       void TearDown() override {
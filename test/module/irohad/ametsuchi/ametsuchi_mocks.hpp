@@ -24,6 +24,7 @@
 #include "module/irohad/ametsuchi/mock_temporary_factory.hpp"
 #include "module/irohad/ametsuchi/mock_tx_presence_cache.hpp"
 #include "module/irohad/ametsuchi/mock_wsv_query.hpp"
+#include "module/irohad/ametsuchi/mock_wsv_snapshot_storage.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -102,6 +103,9 @@ namespace iroha {
       MOCK_METHOD1(apply,
                    expected::Result<void, validation::CommandError>(
                        const shared_model::interface::Transaction &));
+      MOCK_METHOD1(applyValidated,
+                   expected::Result<void, validation::CommandError>(
+                       const shared_model::interface::Transaction &));
       MOCK_METHOD1(
           createSavepoint,
           std::unique_ptr<TemporaryWsv::SavepointWrapper>(const std::string &));
@@ -7,9 +7,11 @@
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
+#include "ametsuchi/wsv_snapshot_storage.hpp"
 #include "builders/default_builders.hpp"
 #include "builders/protobuf/transaction.hpp"
 #include "framework/result_fixture.hpp"
@@ -460,7 +462,9 @@ TEST_F(AmetsuchiTest, TestRestoreWSV) {
   EXPECT_FALSE(res);
 
   // recover storage and check it is recovered
-  WsvRestorerImpl wsvRestorer;
+  WsvRestorerImpl wsvRestorer(
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      getTestLogger("WsvRestorer"));
   wsvRestorer.restoreWsv(*storage).match(
       [](const auto &) {},
       [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
@@ -469,6 +473,164 @@ TEST_F(AmetsuchiTest, TestRestoreWSV) {
   EXPECT_TRUE(res);
 }
 
+/**
+ * Create a block with a transaction creating role "admin" and domain "test"
+ */
+auto createRestoreTestBlock() {
+  return createBlock(
+      {shared_model::proto::TransactionBuilder()
+           .creatorAccountId("admin@test")
+           .createdTime(iroha::time::now())
+           .quorum(1)
+           .createRole("admin", {Role::kCreateDomain})
+           .createDomain("test", "admin")
+           .build()
+           .signAndAddSignature(
+               shared_model::crypto::DefaultCryptoAlgorithmType::
+                   generateKeypair())
+           .finish()});
+}
+
+/**
+ * @given storage with a chain of several blocks
+ * @when WSV is spoiled and restored without snapshots
+ * @then the effects of all the blocks are restored
+ */
+TEST_F(AmetsuchiTest, TestRestoreWsvFromSeveralBlocks) {
+  std::shared_ptr<const shared_model::interface::Block> block =
+      createRestoreTestBlock();
+  apply(storage, block);
+  const size_t kDomains = 10;
+  for (size_t i = 0; i < kDomains; ++i) {
+    block = createBlock(
+        {shared_model::proto::TransactionBuilder()
+             .creatorAccountId("admin@test")
+             .createdTime(iroha::time::now())
+             .quorum(1)
+             .createDomain("domain" + std::to_string(i), "admin")
+             .build()
+             .signAndAddSignature(
+                 shared_model::crypto::DefaultCryptoAlgorithmType::
+                     generateKeypair())
+             .finish()},
+        block->height() + 1,
+        block->hash());
+    apply(storage, block);
+  }
+
+  // spoil WSV
+  *sql << "DELETE FROM domain";
+
+  WsvRestorerImpl wsvRestorer(
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      getTestLogger("WsvRestorer"));
+  wsvRestorer.restoreWsv(*storage).match(
+      [](const auto &) {},
+      [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
+
+  EXPECT_TRUE(sql_query->getDomain("test"));
+  for (size_t i = 0; i < kDomains; ++i) {
+    EXPECT_TRUE(sql_query->getDomain("domain" + std::to_string(i)));
+  }
+}
+
+/**
+ * @given storage with a block @and a snapshot of WSV taken after the block
+ * with extra roles, which are not created by any block and do not fit into
+ * one fetched chunk
+ * @when WSV is spoiled and restored
+ * @then WSV is loaded from the snapshot and contains the extra roles
+ */
+TEST_F(AmetsuchiTest, TestRestoreWsvFromSnapshot) {
+  auto block = createRestoreTestBlock();
+  apply(storage, block);
+
+  const auto extra_roles = PostgresWsvSnapshot::kRowsPerStatement + 1;
+  *sql << "INSERT INTO role SELECT 'snapshot_role_' || n "
+          "FROM generate_series(1, "
+          + std::to_string(extra_roles) + ") AS n";
+  PostgresWsvSnapshot dumper(*sql);
+  (dumper.begin() | [&dumper] { return dumper.dump(); }).match(
+      [&](const auto &data) {
+        ASSERT_TRUE(storage->getWsvSnapshotStorage()->insert(
+            WsvSnapshot{block->height(),
+                        block->hash(),
+                        makeWsvSnapshotHash(data.value),
+                        data.value}));
+      },
+      [](const auto &error) { FAIL() << error.error; });
+
+  // spoil WSV
+  *sql << "DELETE FROM domain";
+  *sql << "DELETE FROM role";
+
+  WsvRestorerImpl wsvRestorer(
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      getTestLogger("WsvRestorer"));
+  wsvRestorer.restoreWsv(*storage).match(
+      [](const auto &) {},
+      [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
+
+  EXPECT_TRUE(sql_query->getDomain("test"));
+  auto roles = sql_query->getRoles();
+  ASSERT_TRUE(roles);
+  EXPECT_EQ(roles->size(), extra_roles + 1);
+  EXPECT_NE(std::find(roles->begin(), roles->end(), "admin"), roles->end());
+  EXPECT_NE(std::find(roles->begin(), roles->end(), "snapshot_role_1"),
+            roles->end());
+}
+
+/**
+ * @given storage with a block @and a snapshot taken on top of another block
+ * @when WSV is spoiled and restored
+ * @then the snapshot is skipped @and WSV is restored by replaying the block
+ */
+TEST_F(AmetsuchiTest, TestRestoreWsvSkipsForeignSnapshot) {
+  auto block = createRestoreTestBlock();
+  apply(storage, block);
+
+  std::string data = "role\n";
+  ASSERT_TRUE(storage->getWsvSnapshotStorage()->insert(WsvSnapshot{
+      block->height(), fake_hash, makeWsvSnapshotHash(data), data}));
+
+  // spoil WSV
+  *sql << "DELETE FROM domain";
+
+  WsvRestorerImpl wsvRestorer(
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      getTestLogger("WsvRestorer"));
+  wsvRestorer.restoreWsv(*storage).match(
+      [](const auto &) {},
+      [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
+
+  EXPECT_TRUE(sql_query->getDomain("test"));
+}
+
+/**
+ * @given storage with a block @and a snapshot taken on top of it @and a next
+ * block, which refers to another block
+ * @when WSV is spoiled and restored
+ * @then the snapshot is skipped @and the restore fails, since the blocks do
+ * not form a chain
+ */
+TEST_F(AmetsuchiTest, TestRestoreWsvSkipsSnapshotNotFollowedByNextBlock) {
+  auto block = createRestoreTestBlock();
+  apply(storage, block);
+
+  std::string data = "role\n";
+  ASSERT_TRUE(storage->getWsvSnapshotStorage()->insert(WsvSnapshot{
+      block->height(), block->hash(), makeWsvSnapshotHash(data), data}));
+
+  apply(storage, createBlock({}, block->height() + 1, fake_hash));
+
+  WsvRestorerImpl wsvRestorer(
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      getTestLogger("WsvRestorer"));
+  wsvRestorer.restoreWsv(*storage).match(
+      [](const auto &) { FAIL() << "WSV is restored from a broken chain"; },
+      [](const auto &) {});
+}
+
 /**
  * @given created storage
  *        @and a subscribed observer on on_commit() event
@@ -697,3 +859,80 @@ TEST_F(PreparedBlockTest, TemporaryWsvUnlocks) {
   ASSERT_TRUE(framework::expected::val(result));
   storage->prepareBlock(std::move(temp_wsv));
 }
+
+/**
+ * @given TemporaryWSV
+ * @when a transaction with a failing second command is applied and then a
+ * valid transaction is applied
+ * @then the failed command is reported @and only the valid transaction
+ * changes the prepared state
+ */
+TEST_F(PreparedBlockTest, FailedTransactionRolledBack) {
+  auto failed_tx =
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId("admin@test")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .addAssetQuantity("coin#test", "5.00")
+          .transferAsset("admin@test", "nobody@test", "coin#test", "", "1.00")
+          .build()
+          .signAndAddSignature(key)
+          .finish();
+
+  auto result = temp_wsv->apply(failed_tx);
+  auto error = framework::expected::err(result);
+  ASSERT_TRUE(error);
+  EXPECT_EQ(error->error.name, "TransferAsset");
+  EXPECT_EQ(error->error.index, 1u);
+  EXPECT_TRUE(error->error.tx_passed_initial_validation);
+
+  result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(framework::expected::val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  auto block = createBlock({*initial_tx}, 2);
+  ASSERT_TRUE(storage->commitPrepared(block));
+
+  shared_model::interface::Amount resulting_balance{"10.00"};
+  validateAccountAsset(sql_query, "admin@test", "coin#test", resulting_balance);
+}
+
+/**
+ * @given TemporaryWSV
+ * @when a validated transaction is applied, whose first command fails with
+ * an SQL error and is followed by two more commands, so that the second of
+ * the four batched statements fails @and then a valid transaction is applied
+ * @then the error code of the failed command is reported @and the session
+ * is usable for the valid transaction
+ */
+TEST_F(PreparedBlockTest, SqlErrorInBatchKeepsSessionUsable) {
+  auto failed_tx = shared_model::proto::TransactionBuilder()
+                       .creatorAccountId("admin@test")
+                       .createdTime(iroha::time::now())
+                       .quorum(1)
+                       .createDomain(default_domain, default_role)
+                       .createDomain("domain1", default_role)
+                       .createDomain("domain2", default_role)
+                       .build()
+                       .signAndAddSignature(key)
+                       .finish();
+
+  auto result = temp_wsv->applyValidated(failed_tx);
+  auto error = framework::expected::err(result);
+  ASSERT_TRUE(error);
+  EXPECT_EQ(error->error.name, "CreateDomain");
+  // domain already exists
+  EXPECT_EQ(error->error.error_code, 3u);
+  EXPECT_EQ(error->error.index, 0u);
+
+  result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(framework::expected::val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  auto block = createBlock({*initial_tx}, 2);
+  ASSERT_TRUE(storage->commitPrepared(block));
+
+  EXPECT_FALSE(sql_query->getDomain("domain1"));
+  shared_model::interface::Amount resulting_balance{"10.00"};
+  validateAccountAsset(sql_query, "admin@test", "coin#test", resulting_balance);
+}
@@ -145,6 +145,25 @@ TEST_F(BlockQueryTest, GetExactlyOneBlock) {
                      });
 }
 
+/**
+ * @given block store with 2 blocks totally containing 3 txs created by
+ * user1@test AND 1 tx created by user2@test
+ * @when serialized block with height=1 is requested
+ * @then the stored representation of the same block is returned
+ */
+TEST_F(BlockQueryTest, GetSerializedBlock) {
+  auto block = framework::expected::val(blocks->getBlock(1));
+  ASSERT_TRUE(block);
+  auto serialized_block =
+      framework::expected::val(blocks->getSerializedBlock(1));
+  ASSERT_TRUE(serialized_block);
+  auto json = framework::expected::val(
+      shared_model::proto::ProtoBlockJsonConverter().serialize(
+          *block->value));
+  ASSERT_TRUE(json);
+  ASSERT_EQ(serialized_block->value, json->value);
+}
+
 /**
  * @given block store with 2 blocks totally containing 3 txs created by
  * user1@test AND 1 tx created by user2@test
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/connection_admission.hpp"
+
+#include <numeric>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+class ConnectionAdmissionTest : public ::testing::Test {
+ public:
+  uint64_t admitted() const {
+    auto counts = admission->histogram().counts;
+    return std::accumulate(counts.begin(), counts.end(), uint64_t{0});
+  }
+
+  std::shared_ptr<ConnectionAdmission> admission =
+      std::make_shared<ConnectionAdmission>(2, 10ms);
+};
+
+/**
+ * @given admission with capacity of 2
+ * @when 3 permits are requested without releasing any of them
+ * @then first 2 permits are given
+ * @and the third request is rejected and counted
+ */
+TEST_F(ConnectionAdmissionTest, RejectsOverCapacity) {
+  auto first = admission->admit();
+  auto second = admission->admit();
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+
+  EXPECT_FALSE(admission->admit());
+
+  auto histogram = admission->histogram();
+  EXPECT_EQ(histogram.rejected, 1);
+  EXPECT_EQ(admitted(), 2);
+  EXPECT_EQ(histogram.counts.size(), histogram.bounds.size() + 1);
+}
+
+/**
+ * @given admission without free permits
+ * @when a permit is released
+ * @then next request is admitted
+ */
+TEST_F(ConnectionAdmissionTest, AdmitsAfterRelease) {
+  auto first = admission->admit();
+  auto second = admission->admit();
+
+  first.reset();
+
+  EXPECT_TRUE(admission->admit());
+  EXPECT_EQ(admission->histogram().rejected, 0);
+}
+
+/**
+ * @given admission without free permits
+ * @when a permit is released by another thread while a request waits
+ * @then the waiting request is admitted
+ */
+TEST_F(ConnectionAdmissionTest, WaitingRequestIsAdmitted) {
+  auto slow_admission = std::make_shared<ConnectionAdmission>(1, 10s);
+  auto permit = slow_admission->admit();
+  ASSERT_TRUE(permit);
+
+  std::thread releaser([&permit] {
+    std::this_thread::sleep_for(5ms);
+    permit.reset();
+  });
+  auto waiting = slow_admission->admit();
+  releaser.join();
+
+  EXPECT_TRUE(waiting);
+  EXPECT_EQ(slow_admission->histogram().rejected, 0);
+}
@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/flat_file_wsv_snapshot_storage.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace boost::filesystem;
+
+class FlatFileWsvSnapshotStorageTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto flat_file =
+        FlatFile::create(snapshots_path_, getTestLogger("FlatFile"));
+    ASSERT_TRUE(flat_file);
+    storage_ = std::make_unique<FlatFileWsvSnapshotStorage>(
+        std::move(*flat_file), getTestLogger("WsvSnapshotStorage"));
+  }
+
+  void TearDown() override {
+    remove_all(snapshots_path_);
+  }
+
+  WsvSnapshot makeSnapshot(shared_model::interface::types::HeightType height,
+                           std::string data) {
+    auto data_hash = makeWsvSnapshotHash(data);
+    return WsvSnapshot{height,
+                       shared_model::crypto::Hash(std::string(32, 'b')),
+                       data_hash,
+                       std::move(data)};
+  }
+
+  const std::string snapshots_path_ =
+      (temp_directory_path() / unique_path()).string();
+  std::unique_ptr<FlatFileWsvSnapshotStorage> storage_;
+};
+
+/**
+ * @given empty snapshot storage
+ * @when a snapshot with data containing line breaks is inserted and fetched
+ * @then the fetched snapshot is equal to the inserted one
+ */
+TEST_F(FlatFileWsvSnapshotStorageTest, InsertAndGet) {
+  auto snapshot = makeSnapshot(10, "{\"role\":\n[]}\n");
+  ASSERT_TRUE(storage_->insert(snapshot));
+  ASSERT_FALSE(storage_->insert(snapshot));
+
+  auto fetched = storage_->get(10);
+  ASSERT_TRUE(fetched);
+  EXPECT_EQ(fetched->height, snapshot.height);
+  EXPECT_EQ(fetched->block_hash, snapshot.block_hash);
+  EXPECT_EQ(fetched->data_hash, snapshot.data_hash);
+  EXPECT_EQ(fetched->data, snapshot.data);
+  EXPECT_FALSE(storage_->get(20));
+}
+
+/**
+ * @given snapshot storage with snapshots at heights 10 and 20
+ * @when the last snapshot height is requested with different upper bounds
+ * @then the latest height not above the bound is returned
+ */
+TEST_F(FlatFileWsvSnapshotStorageTest, LastHeight) {
+  ASSERT_TRUE(storage_->insert(makeSnapshot(10, "{}")));
+  ASSERT_TRUE(storage_->insert(makeSnapshot(20, "{}")));
+
+  EXPECT_FALSE(storage_->lastHeight(9));
+  EXPECT_EQ(storage_->lastHeight(10), boost::make_optional<uint64_t>(10));
+  EXPECT_EQ(storage_->lastHeight(19), boost::make_optional<uint64_t>(10));
+  EXPECT_EQ(storage_->lastHeight(100), boost::make_optional<uint64_t>(20));
+
+  storage_->dropAll();
+  EXPECT_FALSE(storage_->lastHeight(100));
+}
+
+/**
+ * @given snapshot storage with snapshots at heights 10, 20 and 30
+ * @when two latest snapshots are kept
+ * @then the snapshot at height 10 is removed @and the others are available
+ */
+TEST_F(FlatFileWsvSnapshotStorageTest, KeepLatest) {
+  ASSERT_TRUE(storage_->insert(makeSnapshot(10, "{}")));
+  ASSERT_TRUE(storage_->insert(makeSnapshot(20, "{}")));
+  ASSERT_TRUE(storage_->insert(makeSnapshot(30, "{}")));
+
+  storage_->keepLatest(2);
+  EXPECT_FALSE(storage_->get(10));
+  EXPECT_FALSE(storage_->lastHeight(19));
+  EXPECT_TRUE(storage_->get(20));
+  EXPECT_TRUE(storage_->get(30));
+
+  storage_->keepLatest(2);
+  EXPECT_TRUE(storage_->get(20));
+}
@@ -18,6 +18,9 @@ namespace iroha {
       MOCK_METHOD1(
           getBlock,
           BlockQuery::BlockResult(shared_model::interface::types::HeightType));
+      MOCK_METHOD1(getSerializedBlock,
+                   BlockQuery::SerializedBlockResult(
+                       shared_model::interface::types::HeightType));
       MOCK_METHOD1(checkTxPresence,
                    boost::optional<TxCacheStatusType>(
                        const shared_model::crypto::Hash &));
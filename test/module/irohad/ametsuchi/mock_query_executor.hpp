@@ -23,6 +23,18 @@ namespace iroha {
           bool validate_signatories = true) override {
         return QueryExecutorResult(validateAndExecute_(q));
       }
+      MOCK_METHOD2(validateAndExecutePage_,
+                   shared_model::interface::QueryResponse *(
+                       const shared_model::interface::Query &,
+                       const boost::optional<
+                           shared_model::interface::types::HashType> &));
+      QueryExecutorResult validateAndExecutePage(
+          const shared_model::interface::Query &q,
+          bool validate_signatories,
+          const boost::optional<shared_model::interface::types::HashType>
+              &first_tx_hash) override {
+        return QueryExecutorResult(validateAndExecutePage_(q, first_tx_hash));
+      }
       MOCK_METHOD2(validate,
                    bool(const shared_model::interface::BlocksQuery &,
                         const bool validate_signatories));
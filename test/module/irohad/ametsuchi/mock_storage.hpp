@@ -12,6 +12,7 @@
 #include "ametsuchi/block_storage_factory.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
+#include "ametsuchi/wsv_snapshot_storage.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -20,9 +21,15 @@ namespace iroha {
      public:
       MOCK_CONST_METHOD0(getWsvQuery, std::shared_ptr<WsvQuery>(void));
       MOCK_CONST_METHOD0(getBlockQuery, std::shared_ptr<BlockQuery>(void));
+      MOCK_CONST_METHOD0(getWsvSnapshotStorage,
+                         std::shared_ptr<WsvSnapshotStorage>(void));
       MOCK_METHOD0(
           createTemporaryWsv,
           expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(void));
+      MOCK_METHOD1(
+          createTemporaryWsv,
+          expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(
+              std::chrono::milliseconds));
       MOCK_METHOD0(
           createMutableStorage,
           expected::Result<std::unique_ptr<MutableStorage>, std::string>(void));
@@ -52,6 +59,8 @@ namespace iroha {
                        const shared_model::interface::Peer &));
       MOCK_METHOD0(reset, void(void));
       MOCK_METHOD0(resetWsv, expected::Result<void, std::string>());
+      MOCK_METHOD1(loadWsvSnapshot,
+                   expected::Result<void, std::string>(const WsvSnapshot &));
       MOCK_METHOD0(resetPeers, void(void));
       MOCK_METHOD0(dropStorage, void(void));
       MOCK_METHOD0(freeConnections, void(void));
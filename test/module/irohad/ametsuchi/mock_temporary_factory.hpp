@@ -18,6 +18,10 @@ namespace iroha {
       MOCK_METHOD0(
           createTemporaryWsv,
           expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(void));
+      MOCK_METHOD1(
+          createTemporaryWsv,
+          expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(
+              std::chrono::milliseconds));
       MOCK_METHOD1(prepareBlock_, void(std::unique_ptr<TemporaryWsv> &));
 
       void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) override {
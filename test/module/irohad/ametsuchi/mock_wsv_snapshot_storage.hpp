@@ -0,0 +1,34 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MOCK_WSV_SNAPSHOT_STORAGE_HPP
+#define IROHA_MOCK_WSV_SNAPSHOT_STORAGE_HPP
+
+#include "ametsuchi/wsv_snapshot_storage.hpp"
+
+#include <gmock/gmock.h>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class MockWsvSnapshotStorage : public WsvSnapshotStorage {
+     public:
+      MOCK_METHOD1(insert, bool(const WsvSnapshot &));
+      MOCK_CONST_METHOD1(
+          get,
+          boost::optional<WsvSnapshot>(
+              shared_model::interface::types::HeightType));
+      MOCK_CONST_METHOD1(
+          lastHeight,
+          boost::optional<shared_model::interface::types::HeightType>(
+              shared_model::interface::types::HeightType));
+      MOCK_METHOD1(keepLatest, void(size_t));
+      MOCK_METHOD0(dropAll, void());
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_MOCK_WSV_SNAPSHOT_STORAGE_HPP
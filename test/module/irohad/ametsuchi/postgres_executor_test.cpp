@@ -6,6 +6,7 @@
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_query_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/wsv_cache_view.hpp"
 #include "backend/protobuf/proto_permission_to_string.hpp"
 #include "framework/result_fixture.hpp"
 #include "framework/test_logger.hpp"
@@ -141,6 +142,27 @@ namespace iroha {
             true));
       }
 
+      /**
+       * Replace the executor with the one, which takes permissions from a
+       * cache, where the account has all the role permissions, so that the
+       * permission checks of the statements are skipped
+       * @param account_id - account with all the permissions in the cache
+       */
+      void usePermissionsCache(
+          const shared_model::interface::types::AccountIdType &account_id =
+              "id@domain") {
+        auto cache = std::make_shared<WsvCache>();
+        shared_model::interface::RolePermissionSet permissions;
+        permissions.set();
+        cache->putAccountPermissions(
+            account_id, permissions, cache->generation());
+        executor = std::make_unique<PostgresCommandExecutor>(
+            *sql,
+            perm_converter,
+            std::make_shared<WsvCacheView>(
+                cache, *sql, [] {}, getTestLogger("WsvCacheView")));
+      }
+
       /*
        * The functions below create common objects with default parameters
        * without any validation - specifically for SetUp methods
@@ -1279,6 +1301,49 @@ namespace iroha {
       CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 5, query_args);
     }
 
+    /**
+     * @given permissions cache, which knows that the creator is permitted to
+     * remove signatories
+     * @when trying to remove signatory from a non existing account, a
+     * signatory, which is not attached to the account, and a signatory, after
+     * removal of which the account has less signatories than its quorum
+     * @then corresponding error codes are returned
+     */
+    TEST_F(RemoveSignatory, RulesCheckedWithCachedPermissions) {
+      shared_model::interface::types::PubkeyType pk(std::string('5', 32));
+      CHECK_SUCCESSFUL_RESULT(execute(
+          *mock_command_factory->constructAddSignatory(pk, account_id), true));
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructRemoveSignatory(account_id,
+                                                                  *pubkey),
+                  true));
+      usePermissionsCache();
+
+      {
+        auto cmd_result = execute(
+            *mock_command_factory->constructRemoveSignatory("hello", pk));
+        std::vector<std::string> query_args{"hello", pk.hex()};
+        CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 3, query_args);
+      }
+      {
+        auto cmd_result =
+            execute(*mock_command_factory->constructRemoveSignatory(
+                account_id, *another_pubkey));
+        std::vector<std::string> query_args{account_id,
+                                            another_pubkey->hex()};
+        CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 4, query_args);
+      }
+      {
+        auto cmd_result = execute(
+            *mock_command_factory->constructRemoveSignatory(account_id, pk));
+        std::vector<std::string> query_args{account_id, pk.hex()};
+        CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 5, query_args);
+      }
+      auto signatories = wsv_query->getSignatories(account_id);
+      ASSERT_TRUE(signatories);
+      ASSERT_EQ(signatories->size(), 1);
+    }
+
     class RevokePermission : public CommandExecutorTest {
      public:
       void SetUp() override {
@@ -1370,6 +1435,28 @@ namespace iroha {
       ASSERT_EQ(kv.get(), "{\"id@domain\": {\"key\": \"value\"}}");
     }
 
+    /**
+     * @given account with a detail
+     * @when the same writer sets the same key again @and sets another key
+     * @then the value is replaced @and both keys are returned
+     */
+    TEST_F(SetAccountDetail, ValidOverwrite) {
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructSetAccountDetail(
+              account_id, "key", "value")));
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructSetAccountDetail(
+              account_id, "key", "new_value")));
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructSetAccountDetail(
+              account_id, "key2", "value2")));
+      auto kv = sql_query->getAccountDetail(account_id);
+      ASSERT_TRUE(kv);
+      ASSERT_EQ(kv.get(),
+                "{\"id@domain\": {\"key\": \"new_value\", "
+                "\"key2\": \"value2\"}}");
+    }
+
     /**
      * @given command
      * @when trying to set kv when has grantable permission
@@ -1534,6 +1621,32 @@ namespace iroha {
       CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 5, query_args);
     }
 
+    /**
+     * @given permissions cache, which knows that the creator is permitted to
+     * set quorum
+     * @when trying to set quorum of a non existing account and quorum more
+     * than amount of signatories
+     * @then corresponding error codes are returned @and quorum is not set
+     */
+    TEST_F(SetQuorum, RulesCheckedWithCachedPermissions) {
+      usePermissionsCache();
+
+      {
+        auto cmd_result =
+            execute(*mock_command_factory->constructSetQuorum("hello", 1));
+        std::vector<std::string> query_args{"hello", "1"};
+        CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 4, query_args);
+      }
+      {
+        auto cmd_result =
+            execute(*mock_command_factory->constructSetQuorum(account_id, 3));
+        std::vector<std::string> query_args{account_id, "3"};
+        CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 5, query_args);
+      }
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructSetQuorum(account_id, 2)));
+    }
+
     class SubtractAccountAssetTest : public CommandExecutorTest {
       void SetUp() override {
         CommandExecutorTest::SetUp();
@@ -17,7 +17,9 @@
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/mutable_storage.hpp"
+#include "common/visitor.hpp"
 #include "backend/protobuf/proto_query_response_factory.hpp"
+#include "backend/protobuf/queries/proto_account_detail_record_id.hpp"
 #include "datetime/time.hpp"
 #include "framework/result_fixture.hpp"
 #include "framework/test_logger.hpp"
@@ -597,6 +599,67 @@ namespace iroha {
           std::move(result), kNoStatefulError);
     }
 
+    /**
+     * @given initialized storage, permission, account with two assets
+     * @when get account assets page by page
+     * @then the first page contains the first asset and the id of the second
+     * one @and the second page contains the second asset and no next id
+     */
+    TEST_F(GetAccountAssetExecutorTest, ValidPagination) {
+      const std::string asset_id2 = "coin2#domain";
+      execute(
+          *mock_command_factory->constructCreateAsset("coin2", domain_id, 1),
+          true);
+      execute(*mock_command_factory->constructAddAssetQuantity(
+                  asset_id2, shared_model::interface::Amount{"2.0"}),
+              true);
+      addPerms({shared_model::interface::permissions::Role::kGetMyAccAst});
+
+      auto first_page = TestQueryBuilder()
+                            .creatorAccountId(account_id)
+                            .getAccountAssets(account_id, 1)
+                            .build();
+      checkSuccessfulResult<shared_model::interface::AccountAssetResponse>(
+          executeQuery(first_page), [&](const auto &cast_resp) {
+            ASSERT_EQ(cast_resp.accountAssets().size(), 1);
+            ASSERT_EQ(cast_resp.accountAssets()[0].assetId(), asset_id);
+            ASSERT_EQ(cast_resp.totalAccountAssetsNumber(), 2);
+            ASSERT_TRUE(cast_resp.nextAssetId());
+            ASSERT_EQ(*cast_resp.nextAssetId(), asset_id2);
+          });
+
+      auto second_page = TestQueryBuilder()
+                             .creatorAccountId(account_id)
+                             .getAccountAssets(account_id, 1, asset_id2)
+                             .build();
+      checkSuccessfulResult<shared_model::interface::AccountAssetResponse>(
+          executeQuery(second_page), [&](const auto &cast_resp) {
+            ASSERT_EQ(cast_resp.accountAssets().size(), 1);
+            ASSERT_EQ(cast_resp.accountAssets()[0].assetId(), asset_id2);
+            ASSERT_EQ(cast_resp.totalAccountAssetsNumber(), 2);
+            ASSERT_FALSE(cast_resp.nextAssetId());
+          });
+    }
+
+    /**
+     * @given initialized storage, permission
+     * @when get account assets starting from an asset, which the account
+     * does not have
+     * @then Return error
+     */
+    TEST_F(GetAccountAssetExecutorTest, InvalidPaginationAssetId) {
+      addPerms({shared_model::interface::permissions::Role::kGetMyAccAst});
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getAccountAssets(account_id,
+                                         1,
+                                         types::AssetIdType("money#domain"))
+                       .build();
+      auto result = executeQuery(query);
+      checkStatefulError<shared_model::interface::StatefulFailedErrorResponse>(
+          std::move(result), kInvalidPagination);
+    }
+
     class GetAccountDetailExecutorTest : public QueryExecutorTest {
      public:
       void SetUp() override {
@@ -781,6 +844,72 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given details, inserted into one account by two writers
+     * @when performing query to retrieve the details page by page
+     * @then the first page contains the details up to the page size, the
+     * total number of details and the id of the first record of the next
+     * page @and the last page does not have the next record id
+     */
+    TEST_F(GetAccountDetailExecutorTest, ValidPagination) {
+      addPerms({shared_model::interface::permissions::Role::kGetAllAccDetail});
+      auto first_page = TestQueryBuilder()
+                            .creatorAccountId(account_id)
+                            .getAccountDetail(3, account_id2)
+                            .build();
+      checkSuccessfulResult<shared_model::interface::AccountDetailResponse>(
+          executeQuery(first_page), [](const auto &cast_resp) {
+            ASSERT_EQ(cast_resp.detail(),
+                      R"({"id@domain": {"key": "value"}, )"
+                      R"("id2@domain": {"key": "value", "key2": "value2"}})");
+            ASSERT_EQ(cast_resp.totalNumber(), 4);
+            ASSERT_TRUE(cast_resp.nextRecordId());
+            ASSERT_EQ(cast_resp.nextRecordId()->writer(), account_id);
+            ASSERT_EQ(cast_resp.nextRecordId()->key(), "key2");
+          });
+
+      iroha::protocol::AccountDetailRecordId proto_record_id;
+      proto_record_id.set_writer(account_id);
+      proto_record_id.set_key("key2");
+      const shared_model::proto::AccountDetailRecordId first_record_id{
+          proto_record_id};
+      auto last_page = TestQueryBuilder()
+                           .creatorAccountId(account_id)
+                           .getAccountDetail(
+                               3, account_id2, "", "", first_record_id)
+                           .build();
+      checkSuccessfulResult<shared_model::interface::AccountDetailResponse>(
+          executeQuery(last_page), [](const auto &cast_resp) {
+            ASSERT_EQ(cast_resp.detail(),
+                      R"({"id@domain": {"key2": "value2"}})");
+            ASSERT_EQ(cast_resp.totalNumber(), 4);
+            ASSERT_FALSE(cast_resp.nextRecordId());
+          });
+    }
+
+    /**
+     * @given details, inserted into one account by two writers
+     * @when performing query to retrieve the details starting from a record,
+     * which does not exist
+     * @then Return error
+     */
+    TEST_F(GetAccountDetailExecutorTest, InvalidPaginationRecordId) {
+      addPerms({shared_model::interface::permissions::Role::kGetAllAccDetail});
+      iroha::protocol::AccountDetailRecordId proto_record_id;
+      proto_record_id.set_writer(account_id);
+      proto_record_id.set_key("key3");
+      const shared_model::proto::AccountDetailRecordId first_record_id{
+          proto_record_id};
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getAccountDetail(
+                           3, account_id2, "", "", first_record_id)
+                       .build();
+      auto result = executeQuery(query);
+      checkStatefulError<shared_model::interface::StatefulFailedErrorResponse>(
+          std::move(result), kInvalidPagination);
+    }
+
     class GetBlockExecutorTest : public QueryExecutorTest {
      public:
       // TODO [IR-257] Akvinikym 30.01.19: remove the method and use mocks
@@ -1180,6 +1309,34 @@ namespace iroha {
         return executeQuery(query);
       }
 
+      /**
+       * Execute streamed query and collect the parts of its response
+       * @param max_parts - number of parts, after which the stream is stopped
+       */
+      auto streamPages(types::TransactionsNumberType page_size,
+                       size_t max_parts) {
+        auto query = Impl::makeQuery(page_size);
+        std::vector<QueryExecutorResult> parts;
+        boost::optional<types::HashType> first_tx_hash;
+        do {
+          auto executor = query_executor->createQueryExecutor(
+              pending_txs_storage, query_response_factory);
+          if (not executor) {
+            break;
+          }
+          parts.push_back(
+              (*executor)->validateAndExecutePage(query, false, first_tx_hash));
+          first_tx_hash = boost::none;
+          iroha::visit_in_place(
+              parts.back()->get(),
+              [&first_tx_hash](const TransactionsPageResponse &page) {
+                first_tx_hash = page.nextTxHash();
+              },
+              [](const auto &) {});
+        } while (first_tx_hash and parts.size() < max_parts);
+        return parts;
+      }
+
       /**
        * Check the transactions pagination response compliance to general rules:
        * - total transactions number is equal to the number of target
@@ -1395,6 +1552,36 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given initialized storage with transactions of the account in several
+     * blocks, permissioned account
+     * @when get account transactions starting from a transaction of the last
+     * block
+     * @then Return transactions starting from the requested one
+     * @and total number of transactions counts transactions of all blocks
+     */
+    TEST_F(GetAccountTransactionsExecutorTest, ValidTotalSizeOfSeveralBlocks) {
+      addPerms({shared_model::interface::permissions::Role::kGetMyAccTxs});
+
+      commitBlocks();
+      auto hashes = commitAdditionalBlocks(kTxPageSize);
+
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getAccountTransactions(account_id, 1, hashes.front())
+                       .build();
+      auto result = executeQuery(query);
+      checkSuccessfulResult<shared_model::interface::TransactionsPageResponse>(
+          std::move(result), [&hashes](const auto &cast_resp) {
+            ASSERT_EQ(cast_resp.transactions().size(), 1);
+            EXPECT_EQ(cast_resp.transactions()[0].hash(), hashes.front());
+            ASSERT_TRUE(cast_resp.nextTxHash());
+            EXPECT_EQ(*cast_resp.nextTxHash(), hashes.at(1));
+            // 3 transactions of the account are in the first two blocks
+            EXPECT_EQ(cast_resp.allTransactionsSize(), 3 + hashes.size());
+          });
+    }
+
     /**
      * @given initialized storage, global permission
      * @when get account transactions of other user
@@ -1585,6 +1772,48 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given initialized storage, user has 5 transactions committed
+     * @when the query with 2 transactions page size is streamed
+     * @then 3 pages are streamed
+     * @and each page starts from the next transaction hash of the previous one
+     */
+    TYPED_TEST(GetPagedTransactionsExecutorTest, StreamsAllPages) {
+      this->createTransactionsAndCommit(5);
+      auto size = 2;
+      auto pages = this->streamPages(size, 10);
+
+      ASSERT_EQ(pages.size(), 3);
+      boost::optional<types::HashType> first_hash;
+      for (auto &page : pages) {
+        checkSuccessfulResult<TransactionsPageResponse>(
+            std::move(page), [&](const auto &tx_page_response) {
+              this->generalTransactionsPageResponseCheck(
+                  tx_page_response, size, first_hash);
+              first_hash = tx_page_response.nextTxHash();
+            });
+      }
+      EXPECT_FALSE(first_hash);
+    }
+
+    /**
+     * @given initialized storage, user has 5 transactions committed
+     * @when the query with 2 transactions page size is streamed
+     * @and the consumer stops the stream after the first page
+     * @then only the first page is streamed
+     */
+    TYPED_TEST(GetPagedTransactionsExecutorTest, StreamStopsOnRequest) {
+      this->createTransactionsAndCommit(5);
+      auto size = 2;
+      auto pages = this->streamPages(size, 1);
+
+      ASSERT_EQ(pages.size(), 1);
+      checkSuccessfulResult<TransactionsPageResponse>(
+          std::move(pages.front()), [&](const auto &tx_page_response) {
+            this->generalTransactionsPageResponseCheck(tx_page_response, size);
+          });
+    }
+
     // --------------------\ end of tx pagination tests /-------------------- //
 
     class GetTransactionsHashExecutorTest : public GetTransactionsExecutorTest {
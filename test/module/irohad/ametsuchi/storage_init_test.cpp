@@ -11,6 +11,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include "ametsuchi/impl/flat_file_wsv_snapshot_storage.hpp"
 #include "ametsuchi/impl/in_memory_block_storage_factory.hpp"
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
@@ -78,6 +79,8 @@ class StorageInitTest : public ::testing::Test {
     std::string query = "DROP DATABASE IF EXISTS " + dbname_;
     sql << query;
     boost::filesystem::remove_all(block_store_path);
+    boost::filesystem::remove_all(
+        FlatFileWsvSnapshotStorage::directoryFor(block_store_path));
   }
 
   logger::LoggerManagerTreePtr storage_log_manager_{
@@ -133,3 +136,30 @@ TEST_F(StorageInitTest, CreateStorageWithInvalidPgOpt) {
       .match([](const auto &) { FAIL() << "storage created, but should not"; },
              [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given pool options with no connections in the pool
+ * @when Create storage using these options
+ * @then Database is not created and error case is executed
+ */
+TEST_F(StorageInitTest, CreateStorageWithEmptyPool) {
+  PoolOptions pool_options;
+  pool_options.pool_size = 0;
+  StorageImpl::create(block_store_path,
+                      pgopt_,
+                      factory,
+                      converter,
+                      perm_converter_,
+                      std::move(block_storage_factory_),
+                      std::move(reconnection_strategy_factory_),
+                      storage_log_manager_,
+                      pool_options)
+      .match([](const auto &) { FAIL() << "storage created, but should not"; },
+             [](const auto &) { SUCCEED(); });
+  soci::session sql(*soci::factory_postgresql(), pg_opt_without_dbname_);
+  int size;
+  sql << "SELECT COUNT(datname) FROM pg_catalog.pg_database WHERE datname = "
+         ":dbname",
+      soci::into(size), soci::use(dbname_);
+  ASSERT_EQ(size, 0);
+}
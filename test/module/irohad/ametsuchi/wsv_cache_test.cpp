@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::GrantablePermissionSet;
+using shared_model::interface::RolePermissionSet;
+using shared_model::interface::permissions::Grantable;
+using shared_model::interface::permissions::Role;
+
+class WsvCacheTest : public ::testing::Test {
+ public:
+  WsvCache cache;
+  const std::string account_id = "user@domain";
+  const std::string permittee_id = "admin@domain";
+};
+
+/**
+ * @given empty cache
+ * @when account permissions are stored with the current generation
+ * @then they are returned by the cache
+ */
+TEST_F(WsvCacheTest, StoresAccountPermissions) {
+  ASSERT_FALSE(cache.getAccountPermissions(account_id));
+
+  cache.putAccountPermissions(
+      account_id, RolePermissionSet{Role::kReceive}, cache.generation());
+
+  auto permissions = cache.getAccountPermissions(account_id);
+  ASSERT_TRUE(permissions);
+  EXPECT_TRUE(permissions->test(Role::kReceive));
+  EXPECT_FALSE(permissions->test(Role::kTransfer));
+}
+
+/**
+ * @given cache with permissions and signatories
+ * @when the cache is invalidated
+ * @then all entries are dropped
+ */
+TEST_F(WsvCacheTest, InvalidateDropsEntries) {
+  auto generation = cache.generation();
+  cache.putAccountPermissions(
+      account_id, RolePermissionSet{Role::kReceive}, generation);
+  cache.putGrantablePermissions(permittee_id,
+                                account_id,
+                                GrantablePermissionSet{Grantable::kSetMyQuorum},
+                                generation);
+  cache.putSignatories(account_id, {1, {"key"}}, generation);
+
+  cache.invalidate();
+
+  EXPECT_NE(generation, cache.generation());
+  EXPECT_FALSE(cache.getAccountPermissions(account_id));
+  EXPECT_FALSE(cache.getGrantablePermissions(permittee_id, account_id));
+  EXPECT_FALSE(cache.getSignatories(account_id));
+}
+
+/**
+ * @given generation read before the cache was invalidated
+ * @when the entries loaded with it are stored
+ * @then they are not stored, because they may be outdated
+ */
+TEST_F(WsvCacheTest, OutdatedEntriesAreNotStored) {
+  auto generation = cache.generation();
+  cache.invalidate();
+
+  cache.putAccountPermissions(
+      account_id, RolePermissionSet{Role::kReceive}, generation);
+  cache.putSignatories(account_id, {1, {"key"}}, generation);
+
+  EXPECT_FALSE(cache.getAccountPermissions(account_id));
+  EXPECT_FALSE(cache.getSignatories(account_id));
+}
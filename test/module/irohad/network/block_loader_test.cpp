@@ -8,6 +8,7 @@
 #include <grpc++/server_builder.h>
 #include <gtest/gtest.h>
 
+#include "backend/protobuf/proto_block_json_converter.hpp"
 #include "builders/protobuf/builder_templates/transaction_template.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
@@ -104,6 +105,13 @@ class BlockLoaderTest : public testing::Test {
         .transactions(txs);
   }
 
+  /// block in the format it is kept in block storage
+  BlockQuery::SerializedBlockResult serialize(
+      const shared_model::interface::Block &block) const {
+    return json_converter.serialize(block);
+  }
+
+  shared_model::proto::ProtoBlockJsonConverter json_converter;
   std::shared_ptr<MockPeer> peer;
   std::string address;
   PublicKey peer_key =
@@ -166,9 +174,8 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getTopBlockHeight())
       .WillOnce(Return(top_block.height()));
-  EXPECT_CALL(*storage, getBlock(top_block.height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(top_block)))));
+  EXPECT_CALL(*storage, getSerializedBlock(top_block.height()))
+      .WillOnce(Return(serialize(top_block)));
   auto wrapper =
       make_test_subscriber<CallExact>(loader->retrieveBlocks(1, peer_key), 1);
   wrapper.subscribe([&top_block](auto block) { ASSERT_EQ(*block, top_block); });
@@ -203,9 +210,8 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
                    .signAndAddSignature(key)
                    .finish();
 
-    EXPECT_CALL(*storage, getBlock(i))
-        .WillOnce(Return(ByMove(iroha::expected::makeValue(
-            clone<shared_model::interface::Block>(blk)))));
+    EXPECT_CALL(*storage, getSerializedBlock(i))
+        .WillOnce(Return(serialize(blk)));
   }
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
@@ -219,6 +225,47 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given block loader, a block, and additional blocks in the storage
+ * @when retrieveBlocks is called with an upper bound below the top height
+ * @then only the blocks up to the bound are returned
+ */
+TEST_F(BlockLoaderTest, ValidWhenBlocksRange) {
+  auto block = getBaseBlockBuilder()
+                   .createdTime(1337)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+
+  auto num_blocks = 2;
+  auto next_height = block.height() + 1;
+  auto to_height = block.height() + num_blocks;
+
+  EXPECT_CALL(*storage, getTopBlockHeight())
+      .WillOnce(Return(to_height + num_blocks));
+  for (auto i = next_height; i <= to_height; ++i) {
+    auto blk = getBaseBlockBuilder()
+                   .height(i)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+
+    EXPECT_CALL(*storage, getSerializedBlock(i))
+        .WillOnce(Return(serialize(blk)));
+  }
+  EXPECT_CALL(*storage, getSerializedBlock(to_height + 1)).Times(0);
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlocks(1, to_height, peer_key), num_blocks);
+  auto height = next_height;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 MATCHER_P(RefAndPointerEq, arg1, "") {
   return arg == *arg1;
 }
@@ -238,7 +285,7 @@ TEST_F(BlockLoaderTest, ValidWhenBlockPresent) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*validator, validate(RefAndPointerEq(block)))
       .WillOnce(Return(Answer{}));
-  EXPECT_CALL(*storage, getBlock(_)).Times(0);
+  EXPECT_CALL(*storage, getSerializedBlock(_)).Times(0);
   auto retrieved_block = loader->retrieveBlock(peer_key, block->height());
 
   ASSERT_TRUE(retrieved_block);
@@ -264,9 +311,8 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{peer}));
-  EXPECT_CALL(*storage, getBlock(prev_block->height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(*prev_block)))));
+  EXPECT_CALL(*storage, getSerializedBlock(prev_block->height()))
+      .WillOnce(Return(serialize(*prev_block)));
 
   auto block = loader->retrieveBlock(peer_key, prev_block->height());
   ASSERT_TRUE(block);
@@ -290,9 +336,8 @@ TEST_F(BlockLoaderTest, ValidWithEmptyCache) {
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{peer}));
-  EXPECT_CALL(*storage, getBlock(prev_block->height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(*prev_block)))));
+  EXPECT_CALL(*storage, getSerializedBlock(prev_block->height()))
+      .WillOnce(Return(serialize(*prev_block)));
 
   auto block = loader->retrieveBlock(peer_key, prev_block->height());
   ASSERT_TRUE(block);
@@ -308,7 +353,7 @@ TEST_F(BlockLoaderTest, ValidWithEmptyCache) {
 TEST_F(BlockLoaderTest, NoBlocksInStorage) {
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{peer}));
-  EXPECT_CALL(*storage, getBlock(1))
+  EXPECT_CALL(*storage, getSerializedBlock(1))
       .WillOnce(Return(ByMove(iroha::expected::makeError("no block"))));
 
   auto block = loader->retrieveBlock(peer_key, 1);
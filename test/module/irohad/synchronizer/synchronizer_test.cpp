@@ -619,3 +619,53 @@ TEST_F(SynchronizerTest, OneRoundDifference) {
 
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given Peers top block height is kHeight - 1
+ * @when gate has voted for other block several chunks of blocks ahead
+ * @then the missing blocks are requested in ranges from several peers @and
+ * applied in height order
+ */
+TEST_F(SynchronizerTest, ParallelDownloadOfManyBlocks) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
+
+  const shared_model::interface::types::HeightType num_blocks = 250;
+  const auto target_height = kHeight + num_blocks - 1;
+  std::vector<std::shared_ptr<shared_model::interface::Block>> commits;
+  for (auto height = kHeight; height <= target_height; ++height) {
+    commits.push_back(makeCommit(height));
+  }
+  EXPECT_CALL(*mutable_factory, commit_(_))
+      .WillOnce(Return(ByMove(std::make_unique<LedgerState>(
+          ledger_peers, target_height, commits.back()->hash()))));
+  EXPECT_CALL(*chain_validator, validateAndApply(ChainEq(commits), _))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
+      .WillRepeatedly(::testing::Invoke(
+          [&commits](auto height, auto to_height, const auto &) {
+            return rxcpp::observable<>::iterate(
+                std::vector<std::shared_ptr<shared_model::interface::Block>>(
+                    commits.begin() + (height - kHeight + 1),
+                    commits.begin() + (to_height - kHeight + 1)));
+          }));
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe([this, target_height](auto commit_event) {
+    EXPECT_EQ(this->ledger_peers, commit_event.ledger_state->ledger_peers);
+    ASSERT_EQ(commit_event.round.block_round, target_height);
+    ASSERT_EQ(commit_event.sync_outcome, SynchronizationOutcomeType::kCommit);
+  });
+
+  gate_outcome.get_subscriber().on_next(
+      consensus::VoteOther(consensus::Round{target_height, 1},
+                           ledger_state,
+                           public_keys,
+                           commits.back()->hash()));
+
+  ASSERT_TRUE(wrapper.validate());
+}
@@ -18,6 +18,9 @@ namespace iroha {
       MOCK_METHOD1(queryHandle,
                    std::unique_ptr<shared_model::interface::QueryResponse>(
                        const shared_model::interface::Query &));
+      MOCK_METHOD2(queryHandleStream,
+                   void(const shared_model::interface::Query &,
+                        const QueryResponseSink &));
       MOCK_METHOD1(
           blocksQueryHandle,
           rxcpp::observable<
@@ -47,6 +47,7 @@ class QueryProcessorTest : public ::testing::Test {
         storage,
         nullptr,
         query_response_factory,
+        nullptr,
         getTestLogger("QueryProcessor"));
     EXPECT_CALL(*storage, getBlockQuery())
         .WillRepeatedly(Return(block_queries));
@@ -94,7 +95,8 @@ TEST_F(QueryProcessorTest, QueryProcessorWhereInvokeInvalidQuery) {
                  .signAndAddSignature(keypair)
                  .finish();
   auto *qry_resp =
-      query_response_factory->createAccountDetailResponse("", qry.hash())
+      query_response_factory
+          ->createAccountDetailResponse("", 0, boost::none, qry.hash())
           .release();
 
   EXPECT_CALL(*qry_exec, validateAndExecute_(_)).WillOnce(Return(qry_resp));
@@ -139,6 +141,87 @@ TEST_F(QueryProcessorTest, QueryProcessorWithWrongKey) {
       response->get()));
 }
 
+/**
+ * @given QueryProcessorImpl with a result cache and GetAccountAssets query
+ * @when the same query is handled twice with different meta
+ * @then the query is executed once
+ * @and the second response is the cached one with the second query hash
+ */
+TEST_F(QueryProcessorTest, CachedQueryIsNotExecuted) {
+  auto cached_qpi = std::make_shared<torii::QueryProcessorImpl>(
+      storage,
+      storage,
+      nullptr,
+      query_response_factory,
+      std::make_shared<torii::QueryResultCache>(1),
+      getTestLogger("QueryProcessor"));
+  auto make_query = [this](auto counter) {
+    return TestUnsignedQueryBuilder()
+        .creatorAccountId(kAccountId)
+        .queryCounter(counter)
+        .getAccountAssets(kAccountId)
+        .build()
+        .signAndAddSignature(keypair)
+        .finish();
+  };
+  auto first_query = make_query(1);
+  auto second_query = make_query(2);
+  auto *qry_resp = query_response_factory
+                       ->createAccountAssetResponse(
+                           {}, 0, boost::none, first_query.hash())
+                       .release();
+
+  EXPECT_CALL(*qry_exec, validateAndExecute_(_)).WillOnce(Return(qry_resp));
+
+  ASSERT_TRUE(cached_qpi->queryHandle(first_query));
+  auto response = cached_qpi->queryHandle(second_query);
+  ASSERT_TRUE(response);
+  EXPECT_EQ(response->queryHash(), second_query.hash());
+  ASSERT_NO_THROW(
+      boost::get<const shared_model::interface::AccountAssetResponse &>(
+          response->get()));
+}
+
+/**
+ * @given QueryProcessorImpl and GetAccountTransactions query with two pages
+ * @when the query is handled as a stream
+ * @then an executor is created for each page
+ * @and the executor is released before its page is passed to the sink
+ */
+TEST_F(QueryProcessorTest, StreamCreatesExecutorPerPage) {
+  auto query = TestUnsignedQueryBuilder()
+                   .creatorAccountId(kAccountId)
+                   .getAccountTransactions(kAccountId, 1)
+                   .build()
+                   .signAndAddSignature(keypair)
+                   .finish();
+  shared_model::crypto::Hash next_tx_hash("next_tx_hash");
+  auto *first_page =
+      query_response_factory
+          ->createTransactionsPageResponse({}, next_tx_hash, 2, query.hash())
+          .release();
+  auto *last_page =
+      query_response_factory
+          ->createTransactionsPageResponse({}, 2, query.hash())
+          .release();
+
+  EXPECT_CALL(*storage, createQueryExecutor(_, _))
+      .Times(2)
+      .WillRepeatedly(Return(
+          boost::make_optional(std::shared_ptr<QueryExecutor>(qry_exec))));
+  EXPECT_CALL(*qry_exec, validateAndExecutePage_(_, _))
+      .WillOnce(Return(first_page))
+      .WillOnce(Return(last_page));
+
+  size_t pages = 0;
+  qpi->queryHandleStream(query, [this, &pages](auto response) {
+    EXPECT_EQ(1, qry_exec.use_count());
+    ++pages;
+    return true;
+  });
+  EXPECT_EQ(2, pages);
+}
+
 /**
  * @given account, ametsuchi queries
  * @when valid block query is sent
@@ -0,0 +1,172 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/processor/query_result_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_query_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::torii;
+using namespace std::chrono_literals;
+
+class QueryResultCacheTest : public ::testing::Test {
+ public:
+  auto makeQuery(const std::string &account_id,
+                 const shared_model::crypto::Keypair &keypair) {
+    return TestUnsignedQueryBuilder()
+        .creatorAccountId(kCreatorId)
+        .getAccountAssets(account_id)
+        .build()
+        .signAndAddSignature(keypair)
+        .finish();
+  }
+
+  auto makeQuery(const std::string &account_id) {
+    return makeQuery(account_id, keypair);
+  }
+
+  auto makeResponse(const shared_model::interface::Query &query) {
+    return response_factory.createAccountAssetResponse(
+        {}, 0, boost::none, query.hash());
+  }
+
+  auto makeBlock(shared_model::proto::Transaction tx) {
+    return TestBlockBuilder()
+        .height(2)
+        .transactions(std::vector<shared_model::proto::Transaction>{tx})
+        .build();
+  }
+
+  /// Store response to the query in the cache
+  void insert(const shared_model::interface::Query &query) {
+    cache.insert(query, *makeResponse(query), 1ms, cache.generation());
+  }
+
+  const std::string kCreatorId = "admin@domain";
+  const std::string kAccountId = "user@domain";
+  const std::string kOtherAccountId = "other@domain";
+  shared_model::crypto::Keypair keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  shared_model::proto::ProtoQueryResponseFactory response_factory;
+  QueryResultCache cache{10};
+};
+
+/**
+ * @given cache with a response to a query
+ * @when the same query with another meta is looked up
+ * @then the response is found
+ * @and the hit and the saved time are counted
+ */
+TEST_F(QueryResultCacheTest, FindsSameQuery) {
+  auto query = makeQuery(kAccountId);
+  EXPECT_FALSE(cache.find(query));
+  insert(query);
+
+  auto response = cache.find(makeQuery(kAccountId));
+  ASSERT_TRUE(response);
+  EXPECT_EQ(*response, *makeResponse(query));
+
+  auto statistics = cache.statistics();
+  EXPECT_EQ(statistics.hits, 1);
+  EXPECT_EQ(statistics.misses, 1);
+  EXPECT_EQ(statistics.saved_time, 1ms);
+}
+
+/**
+ * @given cache with a response to a query
+ * @when the same query signed by another key is looked up
+ * @then the response is not found
+ */
+TEST_F(QueryResultCacheTest, DoesNotFindOtherSignatories) {
+  insert(makeQuery(kAccountId));
+
+  EXPECT_FALSE(cache.find(makeQuery(
+      kAccountId,
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair())));
+}
+
+/**
+ * @given generation of the cache
+ * @when the cache is invalidated before a response is stored
+ * @then the response is not stored
+ */
+TEST_F(QueryResultCacheTest, IgnoresStaleGeneration) {
+  auto query = makeQuery(kAccountId);
+  auto generation = cache.generation();
+  cache.invalidate(makeBlock(TestTransactionBuilder().build()));
+
+  cache.insert(query, *makeResponse(query), 1ms, generation);
+
+  EXPECT_FALSE(cache.find(query));
+}
+
+/**
+ * @given cache with responses to queries about two accounts
+ * @when a block with a transfer to one of the accounts is committed
+ * @then only the response about that account is dropped
+ */
+TEST_F(QueryResultCacheTest, InvalidatesChangedAccounts) {
+  auto query = makeQuery(kAccountId);
+  auto other_query = makeQuery(kOtherAccountId);
+  insert(query);
+  insert(other_query);
+
+  cache.invalidate(
+      makeBlock(TestTransactionBuilder()
+                    .creatorAccountId(kOtherAccountId)
+                    .transferAsset(
+                        "third@domain", kAccountId, "coin#domain", "", "1.0")
+                    .build()));
+
+  EXPECT_FALSE(cache.find(query));
+  EXPECT_TRUE(cache.find(other_query));
+}
+
+/**
+ * @given cache with a response to a query
+ * @when a block, which changes the roles of an unrelated account, is
+ * committed
+ * @then the response is dropped
+ */
+TEST_F(QueryResultCacheTest, InvalidatesEverythingOnRoleChange) {
+  auto query = makeQuery(kAccountId);
+  insert(query);
+
+  cache.invalidate(makeBlock(TestTransactionBuilder()
+                                 .creatorAccountId(kCreatorId)
+                                 .appendRole("third@domain", "user")
+                                 .build()));
+
+  EXPECT_FALSE(cache.find(query));
+}
+
+/**
+ * @given full cache
+ * @when another response is stored
+ * @then the least recently used response is dropped
+ */
+TEST_F(QueryResultCacheTest, DropsLeastRecentlyUsed) {
+  QueryResultCache small_cache{2};
+  auto insert_to = [&](const auto &query) {
+    small_cache.insert(
+        query, *makeResponse(query), 1ms, small_cache.generation());
+  };
+  auto first_query = makeQuery("first@domain");
+  auto second_query = makeQuery("second@domain");
+  auto third_query = makeQuery("third@domain");
+  insert_to(first_query);
+  insert_to(second_query);
+  ASSERT_TRUE(small_cache.find(first_query));
+
+  insert_to(third_query);
+
+  EXPECT_TRUE(small_cache.find(first_query));
+  EXPECT_FALSE(small_cache.find(second_query));
+  EXPECT_TRUE(small_cache.find(third_query));
+}
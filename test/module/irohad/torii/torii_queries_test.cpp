@@ -80,6 +80,7 @@ class ToriiQueriesTest : public testing::Test {
         storage,
         pending_txs_storage,
         query_response_factory,
+        nullptr,
         getTestLogger("QueryProcessor"));
 
     //----------- Server run ----------------
@@ -407,7 +408,8 @@ TEST_F(ToriiQueriesTest, FindAccountAssetWhenHasRolePermissions) {
       assets;
   assets.push_back(std::make_tuple(account_id, asset_id, amount));
   auto *r = query_response_factory
-                ->createAccountAssetResponse(assets, model_query.hash())
+                ->createAccountAssetResponse(
+                    assets, assets.size(), boost::none, model_query.hash())
                 .release();
 
   EXPECT_CALL(*query_executor, validateAndExecute_(_))
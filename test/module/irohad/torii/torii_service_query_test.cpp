@@ -169,3 +169,60 @@ TEST_F(ToriiQueryServiceTest, FetchBlocksWhenInvalidQuery) {
   auto response = responses.at(0);
   ASSERT_TRUE(response.has_block_error_response());
 }
+
+/**
+ * @given valid query
+ * @when the query is streamed
+ * @and query processor produces 2 parts of the response
+ * @then both parts are received in order
+ */
+TEST_F(ToriiQueryServiceTest, FindStreamWritesAllParts) {
+  auto query = TestUnsignedQueryBuilder()
+                   .creatorAccountId("user@domain")
+                   .createdTime(iroha::time::now())
+                   .queryCounter(1)
+                   .getRoles()
+                   .build()
+                   .signAndAddSignature(keypair)
+                   .finish();
+
+  EXPECT_CALL(*query_processor, queryHandleStream(_, _))
+      .WillOnce(Invoke([](const auto &qry, const auto &sink) {
+        shared_model::proto::ProtoQueryResponseFactory factory;
+        sink(factory.createRolesResponse({"first"}, qry.hash()));
+        sink(factory.createRolesResponse({"second"}, qry.hash()));
+      }));
+
+  auto client = torii_utils::QuerySyncClient(ip, port);
+  auto responses = client.FindStream(query.getTransport());
+
+  ASSERT_EQ(responses.size(), 2);
+  ASSERT_TRUE(responses.at(0).has_roles_response());
+  ASSERT_TRUE(responses.at(1).has_roles_response());
+  EXPECT_EQ(responses.at(0).roles_response().roles(0), "first");
+  EXPECT_EQ(responses.at(1).roles_response().roles(0), "second");
+}
+
+/**
+ * @given stateless invalid query
+ * @when the query is streamed
+ * @then single error response is received
+ */
+TEST_F(ToriiQueryServiceTest, FindStreamWhenInvalidQuery) {
+  EXPECT_CALL(*query_processor, queryHandleStream(_, _)).Times(0);
+
+  auto query = TestUnsignedQueryBuilder()
+                   .creatorAccountId("asd@@domain")  // invalid account id name
+                   .createdTime(iroha::time::now())
+                   .queryCounter(1)
+                   .getRoles()
+                   .build()
+                   .signAndAddSignature(keypair)
+                   .finish();
+
+  auto client = torii_utils::QuerySyncClient(ip, port);
+  auto responses = client.FindStream(query.getTransport());
+
+  ASSERT_EQ(responses.size(), 1);
+  ASSERT_TRUE(responses.at(0).has_error_response());
+}
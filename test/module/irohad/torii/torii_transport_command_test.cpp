@@ -19,6 +19,7 @@
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "module/irohad/network/network_mocks.hpp"
 #include "module/irohad/torii/torii_mocks.hpp"
@@ -241,6 +242,59 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
   transport_grpc->ListTorii(&context, &request, &response);
 }
 
+/**
+ * @given torii service and a list of transactions, which is validated in
+ *        several chunks
+ * @when calling ListTorii
+ * @then handleTransactionBatch is called for every transaction in the order
+ *       of the list
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiLargeKeepsOrder) {
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+  const size_t kLargeTimes = 1000;
+
+  iroha::protocol::TxList request;
+  for (size_t i = 0; i < kLargeTimes; ++i) {
+    request.add_transactions()
+        ->mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_created_time(i);
+  }
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .Times(kLargeTimes)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .Times(kLargeTimes)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(kLargeTimes)
+      .WillRepeatedly(Invoke([](const auto &txs) {
+        return iroha::expected::makeValue(
+            std::unique_ptr<shared_model::interface::TransactionBatch>(
+                std::make_unique<
+                    shared_model::interface::TransactionBatchImpl>(txs)));
+      }));
+
+  std::vector<shared_model::interface::types::TimestampType> handled;
+  EXPECT_CALL(*command_service, handleTransactionBatch(_))
+      .Times(kLargeTimes)
+      .WillRepeatedly(Invoke([&handled](const auto &batch) {
+        handled.push_back(batch->transactions().front()->createdTime());
+      }));
+
+  transport_grpc->ListTorii(&context, &request, &response);
+
+  ASSERT_EQ(handled.size(), kLargeTimes);
+  for (size_t i = 0; i < kLargeTimes; ++i) {
+    EXPECT_EQ(handled[i], i);
+  }
+}
+
 /**
  * @given torii service and command_service with empty status stream
  * @when calling StatusStream on transport
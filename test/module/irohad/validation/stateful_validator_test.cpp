@@ -13,9 +13,9 @@
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
-#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "interfaces/transaction.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/ametsuchi/mock_temporary_factory.hpp"
 #include "module/irohad/common/validators_config.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
@@ -103,11 +103,10 @@ class Validator : public testing::Test {
     factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
         shared_model::validation::DefaultProposalValidator>>(
         iroha::test::kTestsValidatorsConfig);
-    parser =
-        std::make_shared<shared_model::interface::TransactionBatchParserImpl>();
     sfv = std::make_shared<StatefulValidatorImpl>(
         std::move(factory),
-        std::move(parser),
+        nullptr,
+        1,
         getTestLogger("StatefulValidator"));
     temp_wsv_mock = std::make_shared<iroha::ametsuchi::MockTemporaryWsv>();
   }
@@ -143,7 +142,6 @@ class Validator : public testing::Test {
   std::shared_ptr<StatefulValidator> sfv;
   std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory;
   std::shared_ptr<iroha::ametsuchi::MockTemporaryWsv> temp_wsv_mock;
-  std::shared_ptr<shared_model::interface::TransactionBatchParser> parser;
 
   const uint32_t sample_error_code = 2;
   const std::string sample_error_extra = "account_id: doge@account";
@@ -340,3 +338,115 @@ TEST_F(Validator, Batches) {
   EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[1].tx_hash,
             txs[4].hash());
 }
+
+/**
+ * @given three transactions of different creators @and validator with two
+ * workers
+ * @when the second transaction is validated on a worker temporary wsv @and
+ * the third one fails
+ * @then the second transaction is applied to the proposal wsv without
+ * validation @and the results are the same as for serial validation
+ */
+TEST_F(Validator, IndependentTxsInParallel) {
+  auto temporary_factory =
+      std::make_shared<iroha::ametsuchi::MockTemporaryFactory>();
+  sfv = std::make_shared<StatefulValidatorImpl>(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      temporary_factory,
+      2,
+      getTestLogger("StatefulValidator"));
+
+  std::vector<shared_model::proto::Transaction> txs;
+  for (auto creator : {"a@domain", "b@domain", "c@domain"}) {
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId(creator)
+                      .createdTime(iroha::time::now())
+                      .quorum(1)
+                      .setAccountDetail(creator, "key", "value")
+                      .build());
+  }
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  auto worker_wsv = std::make_unique<iroha::ametsuchi::MockTemporaryWsv>();
+  EXPECT_CALL(*worker_wsv, apply(Eq(ByRef(txs[1]))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*temporary_factory, createTemporaryWsv(_))
+      .WillOnce(Return(ByMove(
+          iroha::expected::makeValue<
+              std::unique_ptr<iroha::ametsuchi::TemporaryWsv>>(
+              std::move(worker_wsv)))));
+
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[0]))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[2]))))
+      .WillOnce(Return(iroha::expected::makeError(
+          CommandError{"", sample_error_code, sample_error_extra, true})));
+  EXPECT_CALL(*temp_wsv_mock, applyValidated(Eq(ByRef(txs[1]))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  const auto &verified_txs =
+      verified_proposal_and_errors->verified_proposal->transactions();
+  ASSERT_EQ(verified_txs.size(), 2);
+  EXPECT_EQ(verified_txs[0].hash(), txs[0].hash());
+  EXPECT_EQ(verified_txs[1].hash(), txs[1].hash());
+  ASSERT_EQ(verified_proposal_and_errors->rejected_transactions.size(), 1);
+  EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[0].tx_hash,
+            txs[2].hash());
+}
+
+/**
+ * @given three transactions of different creators @and validator with two
+ * workers
+ * @when no database session gets free for the worker in time
+ * @then all transactions are validated serially on the proposal wsv
+ */
+TEST_F(Validator, SerialWithoutWorkerSession) {
+  auto temporary_factory =
+      std::make_shared<iroha::ametsuchi::MockTemporaryFactory>();
+  sfv = std::make_shared<StatefulValidatorImpl>(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      temporary_factory,
+      2,
+      getTestLogger("StatefulValidator"));
+
+  std::vector<shared_model::proto::Transaction> txs;
+  for (auto creator : {"a@domain", "b@domain", "c@domain"}) {
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId(creator)
+                      .createdTime(iroha::time::now())
+                      .quorum(1)
+                      .setAccountDetail(creator, "key", "value")
+                      .build());
+  }
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  EXPECT_CALL(*temporary_factory, createTemporaryWsv(_))
+      .WillOnce(Return(ByMove(iroha::expected::makeError(
+          std::string{"No database session got free"}))));
+  EXPECT_CALL(*temporary_factory, createTemporaryWsv()).Times(0);
+
+  for (const auto &tx : txs) {
+    EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(tx))))
+        .WillOnce(Return(iroha::expected::Value<void>({})));
+  }
+  EXPECT_CALL(*temp_wsv_mock, applyValidated(_)).Times(0);
+
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  ASSERT_EQ(
+      verified_proposal_and_errors->verified_proposal->transactions().size(),
+      3);
+  EXPECT_TRUE(verified_proposal_and_errors->rejected_transactions.empty());
+}
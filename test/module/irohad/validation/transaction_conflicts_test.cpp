@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/transaction_conflicts.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::validation;
+using ::testing::Contains;
+using ::testing::ElementsAre;
+using ::testing::UnorderedElementsAre;
+
+/**
+ * @given transfer transaction
+ * @when its keys are collected
+ * @then the creator, both accounts and the asset are read @and only the
+ * balances of both accounts in the asset are written
+ */
+TEST(TransactionConflictsTest, TransferKeys) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("admin@test")
+                .createdTime(iroha::time::now())
+                .quorum(1)
+                .transferAsset("a@test", "b@test", "coin#test", "", "1.0")
+                .build();
+
+  auto keys = transactionKeys(tx);
+
+  EXPECT_THAT(keys.reads, Contains("account:admin@test"));
+  EXPECT_THAT(keys.reads, Contains("account:a@test"));
+  EXPECT_THAT(keys.reads, Contains("account:b@test"));
+  EXPECT_THAT(keys.reads, Contains("asset:coin#test"));
+  EXPECT_THAT(keys.writes,
+              UnorderedElementsAre("balance:a@test/coin#test",
+                                   "balance:b@test/coin#test"));
+}
+
+/**
+ * @given transfers of one asset between different pairs of accounts @and
+ * creation of the asset
+ * @when they are grouped
+ * @then the transfers are independent of each other @and all of them
+ * conflict with the creation of the asset
+ */
+TEST(TransactionConflictsTest, TransfersOfOneAsset) {
+  auto transfer = [](const std::string &src, const std::string &dest) {
+    return transactionKeys(
+        TestTransactionBuilder()
+            .creatorAccountId(src)
+            .createdTime(iroha::time::now())
+            .quorum(1)
+            .transferAsset(src, dest, "coin#test", "", "1.0")
+            .build());
+  };
+  auto create_asset = transactionKeys(TestTransactionBuilder()
+                                          .creatorAccountId("admin@test")
+                                          .createdTime(iroha::time::now())
+                                          .quorum(1)
+                                          .createAsset("coin", "test", 1)
+                                          .build());
+
+  EXPECT_THAT(groupByConflicts({transfer("a@test", "b@test"),
+                                transfer("c@test", "d@test")}),
+              ElementsAre(ElementsAre(0), ElementsAre(1)));
+  EXPECT_THAT(groupByConflicts({transfer("a@test", "b@test"),
+                                transfer("c@test", "d@test"),
+                                create_asset}),
+              ElementsAre(ElementsAre(0, 1, 2)));
+}
+
+/**
+ * @given items, where the first and the fourth ones share no keys, but are
+ * connected through the third one, which writes "b" read by the first and
+ * "d" written by the fourth, @and the fifth one only reads "a" like the first
+ * @when they are grouped
+ * @then the connected items form one group @and the rest are in their own
+ * groups in order
+ */
+TEST(TransactionConflictsTest, TransitiveConflicts) {
+  std::vector<KeySet> key_sets{{{"a", "b"}, {}},
+                               {{}, {"c"}},
+                               {{}, {"d", "b"}},
+                               {{"e"}, {"d"}},
+                               {{"a"}, {"f"}}};
+
+  auto groups = groupByConflicts(key_sets);
+
+  EXPECT_THAT(
+      groups,
+      ElementsAre(ElementsAre(0, 2, 3), ElementsAre(1), ElementsAre(4)));
+}
+
+/**
+ * @given item, which joins two previously independent groups
+ * @when items are grouped
+ * @then all of them form one group
+ */
+TEST(TransactionConflictsTest, JoinedGroups) {
+  std::vector<KeySet> key_sets{{{}, {"a"}}, {{}, {"b"}}, {{"b", "a"}, {}}};
+
+  auto groups = groupByConflicts(key_sets);
+
+  EXPECT_THAT(groups, ElementsAre(ElementsAre(0, 1, 2)));
+}
+
+/**
+ * @given items, which only read the same key, and an item writing it
+ * @when they are grouped
+ * @then the readers are independent until the writer joins all of them
+ */
+TEST(TransactionConflictsTest, ReadersJoinedByWriter) {
+  std::vector<KeySet> key_sets{{{"a"}, {"b"}}, {{"a"}, {"c"}}};
+
+  EXPECT_THAT(groupByConflicts(key_sets),
+              ElementsAre(ElementsAre(0), ElementsAre(1)));
+
+  key_sets.push_back({{}, {"a"}});
+  key_sets.push_back({{"a"}, {}});
+
+  EXPECT_THAT(groupByConflicts(key_sets), ElementsAre(ElementsAre(0, 1, 2, 3)));
+}
@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/ordered_pipeline.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <set>
+
+#include <gtest/gtest.h>
+
+using namespace iroha;
+
+/**
+ * @given a source of integers and a transform with varying latency
+ * @when they are run through the ordered pipeline with several workers
+ * @then the sink receives all transformed items in the source order
+ */
+TEST(OrderedPipelineTest, PreservesOrder) {
+  ThreadPool pool(4);
+  const int kItems = 1000;
+  int next = 0;
+  std::vector<int> received;
+
+  runOrderedPipeline<int>(
+      [&next]() -> boost::optional<int> {
+        if (next == kItems) {
+          return boost::none;
+        }
+        return next++;
+      },
+      [](int item) {
+        std::this_thread::sleep_for(std::chrono::microseconds(item % 7));
+        return item * 2;
+      },
+      [&received](int item) {
+        received.push_back(item);
+        return true;
+      },
+      pool,
+      16);
+
+  ASSERT_EQ(received.size(), kItems);
+  for (int i = 0; i < kItems; ++i) {
+    ASSERT_EQ(received[i], i * 2);
+  }
+}
+
+/**
+ * @given an endless source
+ * @when the sink stops the pipeline after several items
+ * @then the pipeline returns @and no more than max_in_flight items are read
+ * ahead of the sink
+ */
+TEST(OrderedPipelineTest, StopsOnSinkRequest) {
+  const size_t kMaxInFlight = 8;
+  const size_t kTaken = 10;
+  ThreadPool pool(3);
+  std::atomic<size_t> pulled{0};
+  size_t received = 0;
+
+  runOrderedPipeline<size_t>(
+      [&pulled]() -> boost::optional<size_t> { return pulled++; },
+      [](size_t item) { return item; },
+      [&received, kTaken](size_t item) {
+        EXPECT_EQ(item, received);
+        return ++received < kTaken;
+      },
+      pool,
+      kMaxInFlight);
+
+  ASSERT_EQ(received, kTaken);
+  ASSERT_LE(pulled, kTaken + kMaxInFlight);
+}
+
+/**
+ * @given an empty source
+ * @when it is run through the ordered pipeline
+ * @then the sink is never called
+ */
+TEST(OrderedPipelineTest, EmptySource) {
+  ThreadPool pool(2);
+  runOrderedPipeline<int>([]() -> boost::optional<int> { return boost::none; },
+                          [](int item) { return item; },
+                          [](int) {
+                            ADD_FAILURE() << "sink must not be called";
+                            return true;
+                          },
+                          pool,
+                          4);
+}
+
+/**
+ * @given a pool of two threads
+ * @when several pipelines are run through it concurrently
+ * @then each sink receives its items in order @and all the transforms run
+ * on the threads of the pool
+ */
+TEST(OrderedPipelineTest, PipelinesSharePool) {
+  const int kPipelines = 4;
+  const int kItems = 200;
+  ThreadPool pool(2);
+  std::mutex mutex;
+  std::set<std::thread::id> transform_threads;
+  std::vector<std::vector<int>> received(kPipelines);
+
+  std::vector<std::thread> callers;
+  for (int i = 0; i < kPipelines; ++i) {
+    callers.emplace_back([&, i] {
+      int next = 0;
+      runOrderedPipeline<int>(
+          [&next]() -> boost::optional<int> {
+            if (next == kItems) {
+              return boost::none;
+            }
+            return next++;
+          },
+          [&](int item) {
+            std::lock_guard<std::mutex> lock(mutex);
+            transform_threads.insert(std::this_thread::get_id());
+            return item + i;
+          },
+          [&received, i](int item) {
+            received[i].push_back(item);
+            return true;
+          },
+          pool,
+          8);
+    });
+  }
+  for (auto &caller : callers) {
+    caller.join();
+  }
+
+  ASSERT_LE(transform_threads.size(), pool.size());
+  for (int i = 0; i < kPipelines; ++i) {
+    ASSERT_EQ(received[i].size(), kItems);
+    for (int j = 0; j < kItems; ++j) {
+      ASSERT_EQ(received[i][j], j + i);
+    }
+  }
+}
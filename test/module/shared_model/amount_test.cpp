@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "interfaces/common_objects/amount.hpp"
+
+#include <gtest/gtest.h>
+
+using shared_model::interface::Amount;
+using boost::multiprecision::uint256_t;
+
+/// max value of uint256, which needs the multiprecision representation
+const std::string kUint256Max =
+    "115792089237316195423570985008687907853269984665640564039457584007913129"
+    "639935";
+
+/**
+ * @given amounts with and without the point and with leading zeroes
+ * @when they are parsed
+ * @then integer values and precisions are correct
+ */
+TEST(AmountTest, ParsesSmallValues) {
+  Amount amount("123.456");
+  EXPECT_EQ(amount.intValue(), 123456);
+  EXPECT_EQ(amount.precision(), 3);
+  EXPECT_EQ(amount.toStringRepr(), "123.456");
+
+  Amount integer("42");
+  EXPECT_EQ(integer.intValue(), 42);
+  EXPECT_EQ(integer.precision(), 0);
+
+  Amount leading_zeroes("000123.40");
+  EXPECT_EQ(leading_zeroes.intValue(), 12340);
+  EXPECT_EQ(leading_zeroes.precision(), 2);
+}
+
+/**
+ * @given amounts around the max value of 64 bits and the max value of uint256
+ * @when they are parsed
+ * @then integer values are the same as parsed by uint256
+ */
+TEST(AmountTest, ParsesLargeValues) {
+  for (const auto &str : {std::string("18446744073709551615"),
+                          std::string("18446744073709551616"),
+                          std::string("0000018446744073709551616"),
+                          kUint256Max}) {
+    Amount amount(str);
+    EXPECT_EQ(amount.intValue(), uint256_t(str.substr(str.find('1'))))
+        << str;
+    EXPECT_EQ(amount.precision(), 0);
+    EXPECT_FALSE(amount.isZero());
+  }
+
+  Amount amount(kUint256Max.substr(0, 20) + "." + kUint256Max.substr(20));
+  EXPECT_EQ(amount.intValue(), uint256_t(kUint256Max));
+  EXPECT_EQ(amount.precision(), kUint256Max.size() - 20);
+}
+
+/**
+ * @given strings, which are not amounts
+ * @when they are parsed
+ * @then the amounts are zero with zero precision
+ */
+TEST(AmountTest, ParsesInvalidValuesAsZero) {
+  for (const auto &str : {"", ".", "1.", ".1", "1.2.3", "a", "-1", "1,5"}) {
+    Amount amount(str);
+    EXPECT_TRUE(amount.isZero()) << str;
+    EXPECT_EQ(amount.precision(), 0) << str;
+  }
+  EXPECT_TRUE(Amount("0.000").isZero());
+  EXPECT_FALSE(Amount("0.001").isZero());
+}
+
+/**
+ * @given pairs of amounts with different precisions and sizes
+ * @when they are compared
+ * @then the values are compared regardless of the precisions
+ */
+TEST(AmountTest, ComparesValues) {
+  EXPECT_EQ(Amount("1.5").compare(Amount("1.50")), 0);
+  EXPECT_LT(Amount("1.5").compare(Amount("2")), 0);
+  EXPECT_GT(Amount("2").compare(Amount("1.99")), 0);
+  EXPECT_GT(Amount("0.1").compare(Amount("0.0999999")), 0);
+
+  // scaling overflows 64 bits
+  const auto tiny = "0." + std::string(30, '0') + "1";
+  EXPECT_GT(Amount("1").compare(Amount(tiny)), 0);
+  EXPECT_LT(Amount(tiny).compare(Amount("1")), 0);
+  EXPECT_EQ(Amount("0").compare(Amount("0." + std::string(40, '0'))), 0);
+
+  // multiprecision values
+  EXPECT_GT(Amount(kUint256Max).compare(Amount("18446744073709551615")), 0);
+  EXPECT_LT(Amount("18446744073709551615.0").compare(Amount(kUint256Max)), 0);
+  const auto large = kUint256Max.substr(0, 70);
+  EXPECT_EQ(Amount(large + ".00").compare(Amount(large)), 0);
+  EXPECT_GT(Amount(large + ".01").compare(Amount(large)), 0);
+}
+
+/**
+ * @given small and large amounts
+ * @when they are copied and moved
+ * @then the values, precisions and strings are kept
+ */
+TEST(AmountTest, CopiesValues) {
+  for (const auto &str :
+       {std::string("12.34"), kUint256Max.substr(1) + ".5"}) {
+    Amount amount(str);
+    Amount copy(amount);
+    EXPECT_EQ(copy, amount);
+    EXPECT_EQ(copy.intValue(), amount.intValue());
+    EXPECT_EQ(copy.precision(), amount.precision());
+
+    Amount moved(std::move(copy));
+    EXPECT_EQ(moved.toStringRepr(), str);
+    EXPECT_EQ(moved.intValue(), amount.intValue());
+    EXPECT_EQ(moved.compare(amount), 0);
+  }
+}
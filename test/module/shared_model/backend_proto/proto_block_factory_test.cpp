@@ -6,7 +6,9 @@
 #include <gtest/gtest.h>
 
 #include "backend/protobuf/proto_block_factory.hpp"
+#include "backend/protobuf/block.hpp"
 #include "datetime/time.hpp"
+#include "framework/result_fixture.hpp"
 #include "module/shared_model/validators/validators.hpp"
 #include "validators/default_validator.hpp"
 
@@ -50,3 +52,33 @@ TEST_F(ProtoBlockFactoryTest, UnsafeBlockCreation) {
   ASSERT_EQ(block->prevHash().hex(), prev_hash.hex());
   ASSERT_EQ(block->transactions(), txs);
 }
+
+/**
+ * @given proto block allocated in an arena
+ * @when block is created of it using createBlock function
+ * @then block references the proto block without copying
+ * @and keeps the arena alive after the other references are released
+ */
+TEST_F(ProtoBlockFactoryTest, ArenaBlockCreation) {
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  auto &proto_block =
+      *google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+          arena.get());
+  auto *payload = proto_block.mutable_block_v1()->mutable_payload();
+  payload->set_height(3);
+  payload->add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id("admin@test");
+  const auto *transport = &proto_block.block_v1();
+
+  auto result = factory->createBlock(std::move(arena), proto_block);
+
+  auto value = framework::expected::val(std::move(result));
+  ASSERT_TRUE(value);
+  auto &block = value->value;
+  EXPECT_EQ(&static_cast<proto::Block &>(*block).getTransport(), transport);
+  EXPECT_EQ(block->height(), 3);
+  ASSERT_EQ(boost::size(block->transactions()), 1);
+  EXPECT_EQ(block->transactions().front().creatorAccountId(), "admin@test");
+}
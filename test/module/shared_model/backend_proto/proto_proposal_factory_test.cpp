@@ -73,3 +73,38 @@ TEST_F(ProposalFactoryTest, InvalidProposalTest) {
   proposal.match([&](const auto &) { FAIL() << "unexpected value case"; },
                  [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given a transaction, two batches of two transactions and another
+ * transaction
+ * @when proposal is created using factory
+ * @then batches of the proposal are parsed @and they reference the
+ * transactions of the proposal
+ */
+TEST_F(ProposalFactoryTest, BatchesOfProposal) {
+  iroha::protocol::Transaction first_batch_tx;
+  auto batch_meta = first_batch_tx.mutable_payload()->mutable_batch();
+  batch_meta->add_reduced_hashes(std::string(64, 'a'));
+  batch_meta->add_reduced_hashes(std::string(64, 'b'));
+  auto second_batch_tx = first_batch_tx;
+  second_batch_tx.mutable_payload()->mutable_batch()->set_reduced_hashes(
+      1, std::string(64, 'c'));
+  std::vector<proto::Transaction> txs;
+  txs.emplace_back(iroha::protocol::Transaction{});
+  txs.emplace_back(first_batch_tx);
+  txs.emplace_back(first_batch_tx);
+  txs.emplace_back(second_batch_tx);
+  txs.emplace_back(second_batch_tx);
+  txs.emplace_back(iroha::protocol::Transaction{});
+  auto proposal =
+      std::move(val(valid_factory.createProposal(height, time, txs))->value);
+
+  auto batches = proposal->batches();
+  std::vector<size_t> sizes;
+  for (const auto &batch : batches) {
+    sizes.push_back(batch.size());
+  }
+  ASSERT_EQ(sizes, (std::vector<size_t>{1, 2, 2, 1}));
+  EXPECT_EQ(&*batches[1].begin(), &proposal->transactions()[1]);
+  EXPECT_EQ(&*proposal->batches()[2].begin(), &proposal->transactions()[3]);
+}
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <boost/optional.hpp>
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "backend/protobuf/queries/proto_account_detail_record_id.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "interfaces/query_responses/account_asset_response.hpp"
 #include "interfaces/query_responses/account_detail_response.hpp"
@@ -92,8 +93,9 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAccountAssetResponse) {
                         shared_model::interface::Amount(std::to_string(i))));
   }
 
-  query_responses.push_back(
-      response_factory->createAccountAssetResponse(assets, kQueryHash));
+  const std::string kNextAssetId = "memecoin#iroha";
+  query_responses.push_back(response_factory->createAccountAssetResponse(
+      assets, kAccountAssetsNumber, kNextAssetId, kQueryHash));
 
   for (auto &query_response : query_responses) {
     ASSERT_TRUE(query_response);
@@ -104,6 +106,10 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAccountAssetResponse) {
               query_response->get());
       ASSERT_EQ(response.accountAssets().front().accountId(), kAccountId);
       ASSERT_EQ(response.accountAssets().front().assetId(), kAssetId);
+      ASSERT_EQ(response.totalAccountAssetsNumber(),
+                static_cast<uint32_t>(kAccountAssetsNumber));
+      ASSERT_TRUE(response.nextAssetId());
+      ASSERT_EQ(*response.nextAssetId(), kNextAssetId);
       for (auto i = 1; i < kAccountAssetsNumber; i++) {
         ASSERT_EQ(response.accountAssets()[i - 1].balance(),
                   assets_test_copy[i - 1]->balance());
@@ -122,8 +128,14 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAccountDetailResponse) {
   const HashType kQueryHash{"my_super_hash"};
 
   const DetailType account_details = "{ fav_meme : doge }";
+  constexpr size_t kTotalNumber = 2;
+  iroha::protocol::AccountDetailRecordId next_record_id;
+  next_record_id.set_writer("doge@meme");
+  next_record_id.set_key("fav_coin");
+  const shared_model::proto::AccountDetailRecordId next_record{
+      next_record_id};
   auto query_response = response_factory->createAccountDetailResponse(
-      account_details, kQueryHash);
+      account_details, kTotalNumber, next_record, kQueryHash);
 
   ASSERT_TRUE(query_response);
   ASSERT_EQ(query_response->queryHash(), kQueryHash);
@@ -132,6 +144,10 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAccountDetailResponse) {
         boost::get<const shared_model::interface::AccountDetailResponse &>(
             query_response->get());
     ASSERT_EQ(response.detail(), account_details);
+    ASSERT_EQ(response.totalNumber(), kTotalNumber);
+    ASSERT_TRUE(response.nextRecordId());
+    ASSERT_EQ(response.nextRecordId()->writer(), next_record_id.writer());
+    ASSERT_EQ(response.nextRecordId()->key(), next_record_id.key());
   });
 }
 
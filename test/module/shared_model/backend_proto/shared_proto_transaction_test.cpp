@@ -4,8 +4,10 @@
  */
 
 #include "backend/protobuf/transaction.hpp"
+#include "block.pb.h"
 #include "builders/protobuf/transaction.hpp"
 #include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/default_hash_provider.hpp"
 #include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
 
 #include <gtest/gtest.h>
@@ -102,3 +104,71 @@ TEST(ProtoTransaction, BuilderWithInvalidTx) {
                    .build(),
                std::invalid_argument);
 }
+
+/**
+ * @given transaction
+ * @when its blobs and hashes are taken
+ * @then they match the serialized parts of the transport object
+ * @and the blob of the transaction includes a signature added later
+ */
+TEST(ProtoTransaction, BlobsAndHashes) {
+  auto proto_tx = generateEmptyTransaction();
+  proto_tx.mutable_payload()
+      ->mutable_reduced_payload()
+      ->add_commands()
+      ->mutable_add_asset_quantity()
+      ->CopyFrom(generateAddAssetQuantity("coin#test"));
+  shared_model::proto::Transaction tx(proto_tx);
+  const auto &payload = proto_tx.payload();
+  using shared_model::crypto::Blob;
+  using shared_model::crypto::DefaultHashProvider;
+
+  EXPECT_EQ(tx.payload(), Blob(payload.SerializeAsString()));
+  EXPECT_EQ(tx.reducedPayload(),
+            Blob(payload.reduced_payload().SerializeAsString()));
+  EXPECT_EQ(tx.hash(), DefaultHashProvider::makeHash(tx.payload()));
+  EXPECT_EQ(tx.reducedHash(),
+            DefaultHashProvider::makeHash(tx.reducedPayload()));
+  EXPECT_EQ(tx.blob(), Blob(proto_tx.SerializeAsString()));
+
+  auto keypair =
+      shared_model::crypto::CryptoProviderEd25519Sha3::generateKeypair();
+  tx.addSignature(
+      shared_model::crypto::CryptoSigner<>::sign(tx.payload(), keypair),
+      keypair.publicKey());
+
+  EXPECT_EQ(tx.blob(), Blob(tx.getTransport().SerializeAsString()));
+}
+
+/**
+ * @given serialized block payload with transactions
+ * @when the transactions are created from the payload bytes
+ * @then they have the same hashes and blobs as standalone transactions
+ */
+TEST(ProtoTransaction, EmbeddedTransactions) {
+  iroha::protocol::Block_v1::Payload block_payload;
+  for (auto asset_id : {"coin#test", "money#test"}) {
+    auto &proto_tx = *block_payload.add_transactions();
+    proto_tx = generateEmptyTransaction();
+    proto_tx.mutable_payload()
+        ->mutable_reduced_payload()
+        ->add_commands()
+        ->mutable_add_asset_quantity()
+        ->CopyFrom(generateAddAssetQuantity(asset_id));
+  }
+  auto bytes = block_payload.SerializeAsString();
+
+  auto txs = shared_model::proto::makeEmbeddedTransactions(
+      *block_payload.mutable_transactions(),
+      bytes,
+      iroha::protocol::Block_v1::Payload::kTransactionsFieldNumber);
+
+  ASSERT_EQ(txs.size(), 2);
+  for (int i = 0; i < 2; ++i) {
+    shared_model::proto::Transaction standalone(block_payload.transactions(i));
+    EXPECT_EQ(txs[i].hash(), standalone.hash());
+    EXPECT_EQ(txs[i].reducedHash(), standalone.reducedHash());
+    EXPECT_EQ(txs[i].payload(), standalone.payload());
+    EXPECT_EQ(txs[i].reducedPayload(), standalone.reducedPayload());
+  }
+}
@@ -25,3 +25,61 @@ TEST(UtilTest, StringFromMakeBlob) {
   ASSERT_TRUE(deserialized.ParseFromString(toBinaryString(blob)));
   ASSERT_EQ(deserialized.quorum(), base.quorum());
 }
+
+/**
+ * @given serialized message with repeated embedded messages
+ * @when looking for the embedded messages of the field
+ * @then the found bytes are the serialized embedded messages
+ */
+TEST(UtilTest, FindEmbeddedMessages) {
+  protocol::Command base;
+  base.mutable_set_account_quorum()->set_quorum(100);
+  auto bytes = base.SerializeAsString();
+  const auto *data = reinterpret_cast<const uint8_t *>(bytes.data());
+
+  auto ranges = findEmbeddedMessages(
+      data, bytes.size(), protocol::Command::kSetAccountQuorumFieldNumber);
+
+  ASSERT_EQ(ranges.size(), 1);
+  EXPECT_EQ(bytes.substr(ranges[0].offset, ranges[0].size),
+            base.set_account_quorum().SerializeAsString());
+  EXPECT_TRUE(findEmbeddedMessages(
+                  data, bytes.size(), protocol::Command::kAddPeerFieldNumber)
+                  .empty());
+}
+
+/**
+ * @given serialized message, which is cut in the middle of a field
+ * @when looking for the embedded messages of the field
+ * @then nothing is found
+ */
+TEST(UtilTest, FindEmbeddedMessagesInMalformedData) {
+  protocol::Command base;
+  base.mutable_set_account_quorum()->set_quorum(100);
+  auto bytes = base.SerializeAsString();
+
+  EXPECT_TRUE(findEmbeddedMessages(
+                  reinterpret_cast<const uint8_t *>(bytes.data()),
+                  bytes.size() - 1,
+                  protocol::Command::kSetAccountQuorumFieldNumber)
+                  .empty());
+}
+
+/**
+ * @given protobuf object
+ * @when it is copied and moved to an arena
+ * @then the copy is allocated in the arena
+ * @and both objects keep the value
+ */
+TEST(UtilTest, PlaceToArena) {
+  google::protobuf::Arena arena;
+  protocol::SetAccountQuorum base;
+  base.set_quorum(100);
+
+  auto &copy = copyToArena(arena, base);
+  auto &moved = moveToArena(arena, std::move(base));
+
+  EXPECT_EQ(copy.GetArena(), &arena);
+  EXPECT_EQ(copy.quorum(), 100);
+  EXPECT_EQ(moved.quorum(), 100);
+}
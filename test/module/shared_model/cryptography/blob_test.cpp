@@ -6,6 +6,8 @@
 #include "cryptography/blob.hpp"
 #include <gtest/gtest.h>
 #include <memory>
+#include "cryptography/hash.hpp"
+#include "cryptography/public_key.hpp"
 
 using namespace shared_model::crypto;
 using namespace std::literals::string_literals;
@@ -43,3 +45,36 @@ TEST_F(BlobMock, BlobIsString) {
     ASSERT_EQ(binary[i], bin_str[i]);
   }
 }
+
+/**
+ * @given blob, which hex representation was requested
+ * @when the blob is copied and assigned
+ * @then the copies have the same hex representation
+ */
+TEST_F(BlobMock, HexOfCopies) {
+  auto hex = blob->hex();
+  Blob copy(*blob);
+  Blob assigned;
+  assigned = copy;
+
+  ASSERT_EQ(hex, copy.hex());
+  ASSERT_EQ(hex, assigned.hex());
+  ASSERT_EQ(*blob, assigned);
+}
+
+/**
+ * @given hashes and public keys with the same bytes
+ * @when they are hashed for the standard containers
+ * @then their hash values are equal
+ */
+TEST(BlobHashTest, EqualBlobsHaveEqualHashValues) {
+  std::string bytes(32, 'a');
+  bytes[7] = 'b';
+
+  ASSERT_EQ(std::hash<Hash>{}(Hash(bytes)), std::hash<Hash>{}(Hash(bytes)));
+  ASSERT_EQ(std::hash<PublicKey>{}(PublicKey(bytes)),
+            std::hash<PublicKey>{}(PublicKey(bytes)));
+  ASSERT_EQ(std::hash<Hash>{}(Hash("short")), std::hash<Hash>{}(Hash("short")));
+  ASSERT_NE(std::hash<Hash>{}(Hash(bytes)),
+            std::hash<Hash>{}(Hash(std::string(32, 'a'))));
+}
@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+
+using namespace shared_model::crypto;
+
+class KeypairSignerTest : public ::testing::Test {
+ public:
+  Keypair keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  Blob blob{std::string("message to sign")};
+};
+
+/**
+ * @given signer of a keypair
+ * @when a blob is signed
+ * @then the signature is the same as the one made with the keypair
+ * directly, and it is valid
+ */
+TEST_F(KeypairSignerTest, SameAsKeypairSignature) {
+  CryptoSigner<>::KeypairSignerType signer(keypair);
+
+  auto signature = signer.sign(blob);
+
+  EXPECT_EQ(signer.publicKey(), keypair.publicKey());
+  EXPECT_EQ(signature, CryptoSigner<>::sign(blob, keypair));
+  EXPECT_TRUE(CryptoVerifier<>::verify(signature, blob, signer.publicKey()));
+}
+
+/**
+ * @given signer of a keypair
+ * @when it is copied and moved
+ * @then the new signers make the same signatures
+ */
+TEST_F(KeypairSignerTest, CopiedAndMoved) {
+  CryptoSigner<>::KeypairSignerType signer(keypair);
+  auto signature = signer.sign(blob);
+
+  auto copy = signer;
+  EXPECT_EQ(copy.sign(blob), signature);
+
+  auto moved = std::move(signer);
+  EXPECT_EQ(moved.sign(blob), signature);
+  EXPECT_EQ(moved.publicKey(), keypair.publicKey());
+}
+
+/**
+ * @given keypair with a private key of a wrong size
+ * @when a signer of it is created
+ * @then the creation fails
+ */
+TEST_F(KeypairSignerTest, WrongKeySizeRejected) {
+  Keypair wrong_keypair(keypair.publicKey(),
+                        PrivateKey(std::string("short key")));
+
+  EXPECT_THROW(CryptoSigner<>::KeypairSignerType{wrong_keypair},
+               std::invalid_argument);
+}
@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/ed25519_sha3_impl/internal/sha3_batch.hpp"
+
+#include <gtest/gtest.h>
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+
+using namespace iroha;
+
+/**
+ * Make messages of the sizes around the block size of SHA3-256, filled with
+ * different bytes
+ */
+std::vector<std::vector<uint8_t>> makeMessages(size_t count) {
+  const size_t sizes[] = {0, 1, 7, 8, 135, 136, 137, 200, 271, 272, 273, 1000};
+  std::vector<std::vector<uint8_t>> messages;
+  for (size_t i = 0; i < count; ++i) {
+    messages.emplace_back(sizes[i * 7 % (sizeof(sizes) / sizeof(*sizes))]);
+    for (size_t j = 0; j < messages.back().size(); ++j) {
+      messages.back()[j] = static_cast<uint8_t>(i * 31 + j);
+    }
+  }
+  return messages;
+}
+
+/**
+ * @given batches of messages of different sizes and numbers, so that they
+ * are hashed both in SIMD lanes and one by one
+ * @when the batches are hashed
+ * @then the hashes are the same as the hashes of the messages one by one
+ */
+TEST(Sha3BatchTest, SameAsSingleHashes) {
+  for (size_t count : {0, 1, 3, 4, 5, 8, 9, 12, 17, 40}) {
+    auto messages = makeMessages(count);
+    std::vector<Sha3Message> batch;
+    for (const auto &message : messages) {
+      batch.emplace_back(message.data(), message.size());
+    }
+
+    auto hashes = sha3_256_batch(batch);
+
+    ASSERT_EQ(hashes.size(), count);
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(hashes[i], sha3_256(messages[i])) << "message " << i
+                                                  << " of " << count;
+    }
+  }
+}
+
+/**
+ * @given standard test message "abc"
+ * @when it is hashed in a batch
+ * @then the hash is the one from FIPS 202 examples
+ */
+TEST(Sha3BatchTest, KnownAnswer) {
+  const std::string message = "abc";
+  auto hashes = sha3_256_batch(
+      {{reinterpret_cast<const uint8_t *>(message.data()), message.size()}});
+
+  ASSERT_EQ(hashes.size(), 1);
+  EXPECT_EQ(hashes[0].to_hexstring(),
+            "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532");
+}
@@ -0,0 +1,203 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <functional>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace shared_model::validation;
+
+/**
+ * Differential test of the field matchers against the regular expressions,
+ * which defined the languages of the fields before the matchers
+ */
+class FieldMatchersTest : public ::testing::Test {
+ public:
+  using Matcher = std::function<bool(const std::string &)>;
+  using Generator = std::function<std::string()>;
+
+  const std::string name_pattern = R"#([a-z_0-9]{1,32})#";
+  const std::string label_pattern =
+      R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#";
+  const std::string domain_pattern =
+      "(" + label_pattern + R"#(\.)*)#" + label_pattern;
+  const std::string ip_v4_pattern =
+      R"#(^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
+      R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))#";
+  const std::string peer_address_pattern = "((" + ip_v4_pattern + ")|("
+      + domain_pattern + ")):"
+      + R"#((6553[0-5]|655[0-2]\d|65[0-4]\d\d|6[0-4]\d{3}|[1-5]\d{4})#"
+      + R"#(|[1-9]\d{0,3}|0)$)#";
+  const std::string account_id_pattern =
+      name_pattern + R"#(\@)#" + domain_pattern;
+  const std::string asset_id_pattern =
+      name_pattern + R"#(\#)#" + domain_pattern;
+  const std::string detail_key_pattern = R"([A-Za-z0-9_]{1,64})";
+
+  /// number of checked strings of each generator
+  static constexpr int kIterations = 20000;
+
+  std::mt19937 random{42};
+
+  size_t randomNumber(size_t max) {
+    return std::uniform_int_distribution<size_t>(0, max)(random);
+  }
+
+  std::string randomString(const std::string &alphabet, size_t max_size) {
+    std::string result(randomNumber(max_size), ' ');
+    for (auto &c : result) {
+      c = alphabet[randomNumber(alphabet.size() - 1)];
+    }
+    return result;
+  }
+
+  /// characters of all the fields, separators and some foreign ones
+  std::string anyString() {
+    static const std::string alphabet =
+        std::string("azAZbY09_-.@#: /") + '\0' + '\xff';
+    return randomString(alphabet, 80);
+  }
+
+  /// string with a few characters of names and labels of every length
+  std::string nameString() {
+    return randomString("ab_Z9-", 70);
+  }
+
+  /// dot separated labels, which are close to the valid ones
+  std::string domainString() {
+    std::string result;
+    auto labels = randomNumber(4);
+    for (size_t i = 0; i <= labels; ++i) {
+      if (i > 0) {
+        result += '.';
+      }
+      result += randomString("aZ", 1) + randomString("b0-", 66)
+          + randomString("c9-", 1);
+    }
+    return result;
+  }
+
+  /// numbers around the limits of the address parts, some of them with
+  /// leading zeros
+  std::string numberString(size_t max) {
+    auto number = std::to_string(randomNumber(max));
+    return randomNumber(5) == 0 ? "0" + number : number;
+  }
+
+  std::string peerAddressString() {
+    std::string host;
+    if (randomNumber(1) == 0) {
+      host = domainString();
+    } else {
+      auto parts = 3 + randomNumber(2);
+      for (size_t i = 0; i < parts; ++i) {
+        host += (i > 0 ? "." : "") + numberString(300);
+      }
+    }
+    return host + ":" + numberString(70000);
+  }
+
+  std::string qualifiedString(char separator) {
+    auto name =
+        randomNumber(3) == 0 ? nameString() : randomString("az_09", 34);
+    auto separators = std::string(randomNumber(2), separator);
+    return name + separators + domainString();
+  }
+
+  /**
+   * Check, that the matcher accepts exactly the strings of the pattern
+   */
+  void checkMatcher(const Matcher &matcher,
+                    const std::string &pattern,
+                    const std::vector<Generator> &generators) {
+    const std::regex regex(pattern);
+    for (const auto &generator : generators) {
+      for (int i = 0; i < kIterations; ++i) {
+        auto str = generator();
+        ASSERT_EQ(std::regex_match(str, regex), matcher(str))
+            << "string '" << str << "', pattern '" << pattern << "'";
+      }
+    }
+  }
+};
+
+/**
+ * @given random strings
+ * @when they are checked by the name matcher and its regex
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, Name) {
+  checkMatcher(matchName,
+               name_pattern,
+               {[this] { return anyString(); },
+                [this] { return randomString("az09_", 40); },
+                [this] { return nameString(); }});
+}
+
+/**
+ * @given random strings
+ * @when they are checked by the domain matcher and its regex
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, Domain) {
+  checkMatcher(matchDomain,
+               domain_pattern,
+               {[this] { return anyString(); },
+                [this] { return domainString(); }});
+}
+
+/**
+ * @given random strings
+ * @when they are checked by the account id matcher and its regex
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, AccountId) {
+  checkMatcher(matchAccountId,
+               account_id_pattern,
+               {[this] { return anyString(); },
+                [this] { return qualifiedString('@'); }});
+}
+
+/**
+ * @given random strings
+ * @when they are checked by the asset id matcher and its regex
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, AssetId) {
+  checkMatcher(matchAssetId,
+               asset_id_pattern,
+               {[this] { return anyString(); },
+                [this] { return qualifiedString('#'); }});
+}
+
+/**
+ * @given random strings
+ * @when they are checked by the detail key matcher and its regex
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, DetailKey) {
+  checkMatcher(matchDetailKey,
+               detail_key_pattern,
+               {[this] { return anyString(); },
+                [this] { return randomString("aZ9_", 70); }});
+}
+
+/**
+ * @given random strings
+ * @when they are checked by the peer address matcher and its regex
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, PeerAddress) {
+  checkMatcher(matchPeerAddress,
+               peer_address_pattern,
+               {[this] { return anyString(); },
+                [this] { return peerAddressString(); }});
+}
@@ -230,6 +230,8 @@ DROP TABLE IF EXISTS position_by_hash;
 DROP TABLE IF EXISTS height_by_account_set;
 DROP TABLE IF EXISTS index_by_creator_height;
 DROP TABLE IF EXISTS position_by_account_asset;
+DROP TABLE IF EXISTS tx_count_by_creator;
+DROP TABLE IF EXISTS tx_count_by_account_asset;
 )";
 
     soci::session sql(*soci::factory_postgresql(), pgopts_);